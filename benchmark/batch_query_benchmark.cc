@@ -0,0 +1,141 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/road_network.h>
+
+#include "maliput_geopackage/builder/batch_query_runner.h"
+#include "maliput_geopackage/builder/road_network_builder.h"
+#include "city_grid_map.h"
+
+namespace maliput_geopackage {
+namespace builder {
+namespace benchmark {
+namespace {
+
+// City grid the batches are converted on, of about 100k lanes.
+const tools::CityGridOptions& MapOptions() {
+  static const tools::CityGridOptions options = maliput_geopackage::benchmark::CityGridOptionsForLanes(100000);
+  return options;
+}
+
+// Points converted by every batch.
+constexpr size_t kBatchSize{1 << 16};
+
+// @returns The RoadNetwork of the city grid and its RoadPositionIndex, built on first use.
+const IndexedRoadNetwork& CityGridRoadNetwork() {
+  static const IndexedRoadNetwork indexed =
+      RoadNetworkBuilder({{"gpkg_file", maliput_geopackage::benchmark::CityGridMapPath(MapOptions())},
+                          {"linear_tolerance", "0.01"},
+                          {"angular_tolerance", "0.01"}})
+          .BuildIndexed();
+  return indexed;
+}
+
+// A batch of random locations on the road lanes of the city grid, both as inertial positions and as lane
+// positions.
+struct Batch {
+  std::vector<maliput::api::InertialPosition> inertial_positions;
+  std::vector<LanePositionQuery> lane_positions;
+};
+
+const Batch& MakeBatch() {
+  static const Batch batch = [] {
+    const maliput::api::RoadGeometry* road_geometry = CityGridRoadNetwork().road_network->road_geometry();
+    std::mt19937 generator(42);
+    Batch result;
+    for (size_t i = 0; i < kBatchSize; ++i) {
+      const maliput_geopackage::benchmark::RoadLanePoint point =
+          maliput_geopackage::benchmark::RandomRoadLanePoint(MapOptions(), &generator);
+      result.inertial_positions.emplace_back(point.x, point.y, 0.);
+      result.lane_positions.push_back({road_geometry->ById().GetLane(maliput::api::LaneId(point.lane_id)),
+                                       maliput::api::LanePosition(point.s, point.r, 0.)});
+    }
+    return result;
+  }();
+  return batch;
+}
+
+// Converts a batch of inertial positions on `state.range(0)` threads. Items are points. The scratch_allocations
+// counter is the number of queries that grew the query buffers of a thread after a first, untimed batch.
+void BM_BatchToRoadPosition(::benchmark::State& state) {
+  const Batch& batch = MakeBatch();
+  BatchQueryRunner runner(CityGridRoadNetwork().road_position_index.get(), static_cast<int>(state.range(0)));
+  std::vector<maliput::api::RoadPositionResult> results(kBatchSize);
+  runner.ToRoadPosition(batch.inertial_positions.data(), kBatchSize, results.data());
+  const int64_t warm_allocations = runner.num_scratch_allocations();
+  for (auto _ : state) {
+    runner.ToRoadPosition(batch.inertial_positions.data(), kBatchSize, results.data());
+    ::benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize);
+  state.counters["scratch_allocations"] = static_cast<double>(runner.num_scratch_allocations() - warm_allocations);
+}
+
+// Converts a batch of lane positions on `state.range(0)` threads. Items are points.
+void BM_BatchToInertialPosition(::benchmark::State& state) {
+  const Batch& batch = MakeBatch();
+  BatchQueryRunner runner(CityGridRoadNetwork().road_position_index.get(), static_cast<int>(state.range(0)));
+  std::vector<maliput::api::InertialPosition> results(kBatchSize);
+  for (auto _ : state) {
+    runner.ToInertialPosition(batch.lane_positions.data(), kBatchSize, results.data());
+    ::benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+
+// The baseline: one RoadGeometry::ToRoadPosition() call per point, on the calling thread.
+void BM_SequentialToRoadPosition(::benchmark::State& state) {
+  const Batch& batch = MakeBatch();
+  const maliput::api::RoadGeometry* road_geometry = CityGridRoadNetwork().road_network->road_geometry();
+  size_t i{0};
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(road_geometry->ToRoadPosition(batch.inertial_positions[i++ % kBatchSize]));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_BatchToRoadPosition)->ArgNames({"threads"})->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK(BM_BatchToInertialPosition)->ArgNames({"threads"})->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK(BM_SequentialToRoadPosition);
+
+}  // namespace
+}  // namespace benchmark
+}  // namespace builder
+}  // namespace maliput_geopackage
@@ -0,0 +1,102 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "city_grid_map.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+namespace maliput_geopackage {
+namespace benchmark {
+
+tools::CityGridOptions CityGridOptionsForLanes(int num_lanes) {
+  // A block of a city grid with turns holds about 16 lanes of one lane per direction: four on its two roads,
+  // four straight through and eight turning at its intersection.
+  const int blocks = std::max(1, static_cast<int>(std::lround(std::sqrt(num_lanes / 16.))));
+  tools::CityGridOptions options;
+  options.blocks_x = blocks;
+  options.blocks_y = blocks;
+  options.lanes_per_direction = 1;
+  options.intersection_style = tools::IntersectionStyle::kTurns;
+  return options;
+}
+
+std::string CityGridMapPath(const tools::CityGridOptions& options) {
+  const std::filesystem::path directory = std::filesystem::temp_directory_path() / "maliput_geopackage_benchmark";
+  std::filesystem::create_directories(directory);
+  char file_name[256];
+  std::snprintf(file_name, sizeof(file_name),
+                "city_grid_v%d_%dx%d_blocks_%d_lanes_%d_points_%d_%gx%gx%g_m_%d_%d%d.gpkg", tools::kCityGridVersion,
+                options.blocks_x, options.blocks_y, options.lanes_per_direction, options.points_per_boundary,
+                static_cast<int>(options.intersection_style), options.block_size, options.lane_width,
+                options.elevation, static_cast<int>(options.geometry_format), options.build_spatial_index,
+                options.shared_boundaries);
+  const std::string path = (directory / file_name).string();
+  if (!std::filesystem::exists(path)) {
+    tools::GenerateCityGrid(options, path);
+  }
+  return path;
+}
+
+RoadLanePoint RandomRoadLanePoint(const tools::CityGridOptions& options, std::mt19937* generator) {
+  // Roads run between intersections extending one lane width beyond them, see tools::GenerateCityGrid().
+  const double half_size = (options.lanes_per_direction + 1) * options.lane_width;
+  const int num_east_roads = options.blocks_x * (options.blocks_y + 1);
+  const int num_north_roads = (options.blocks_x + 1) * options.blocks_y;
+  const int road = std::uniform_int_distribution<int>(0, num_east_roads + num_north_roads - 1)(*generator);
+  const int lane = std::uniform_int_distribution<int>(0, 2 * options.lanes_per_direction - 1)(*generator);
+
+  RoadLanePoint point;
+  point.s = std::uniform_real_distribution<double>(0., options.block_size - 2. * half_size)(*generator);
+  point.r = std::uniform_real_distribution<double>(-0.4 * options.lane_width, 0.4 * options.lane_width)(*generator);
+  // Lanes are numbered right to left, and their centerlines are offset to the left of the road's.
+  const double t = (lane + 0.5 - options.lanes_per_direction) * options.lane_width + point.r;
+  std::string road_id;
+  if (road < num_east_roads) {
+    const int i = road % options.blocks_x;
+    const int j = road / options.blocks_x;
+    road_id = "h_" + std::to_string(i) + "_" + std::to_string(j);
+    point.x = i * options.block_size + half_size + point.s;
+    point.y = j * options.block_size + t;
+  } else {
+    const int i = (road - num_east_roads) % (options.blocks_x + 1);
+    const int j = (road - num_east_roads) / (options.blocks_x + 1);
+    road_id = "v_" + std::to_string(i) + "_" + std::to_string(j);
+    point.x = i * options.block_size - t;
+    point.y = j * options.block_size + half_size + point.s;
+  }
+  point.lane_id = road_id + "_s_l" + std::to_string(lane);
+  return point;
+}
+
+}  // namespace benchmark
+}  // namespace maliput_geopackage
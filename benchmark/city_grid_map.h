@@ -0,0 +1,68 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <random>
+#include <string>
+
+#include "tools/city_grid.h"
+
+namespace maliput_geopackage {
+namespace benchmark {
+
+/// @returns The options of a square city grid of about `num_lanes` lanes, with one lane per travel direction
+/// and turns at every intersection.
+tools::CityGridOptions CityGridOptionsForLanes(int num_lanes);
+
+/// @returns The path of a GeoPackage holding the city grid of `options`.
+///
+/// Maps are generated on first use into a directory under the system temporary directory, and reused by
+/// later runs. The file name holds tools::kCityGridVersion and every option, so a map is only reused by a
+/// generator that would write the same one.
+/// @throws std::runtime_error if the GeoPackage cannot be written.
+std::string CityGridMapPath(const tools::CityGridOptions& options);
+
+/// A point on a road lane of a city grid.
+struct RoadLanePoint {
+  /// ID of the lane.
+  std::string lane_id;
+  /// Lane coordinates of the point.
+  double s{0.};
+  double r{0.};
+  /// Inertial coordinates of the point, on the ground of a flat city.
+  double x{0.};
+  double y{0.};
+};
+
+/// @returns A random point of a random road lane of the city grid of `options`, away from its boundaries.
+RoadLanePoint RandomRoadLanePoint(const tools::CityGridOptions& options, std::mt19937* generator);
+
+}  // namespace benchmark
+}  // namespace maliput_geopackage
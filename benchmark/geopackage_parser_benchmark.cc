@@ -0,0 +1,93 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "maliput_geopackage/geopackage/geopackage_parser.h"
+#include "city_grid_map.h"
+
+namespace maliput_geopackage {
+namespace geopackage {
+namespace benchmark {
+namespace {
+
+// Parses the city grid of about `state.range(0)` lanes with `state.range(1)` decoding threads.
+void BM_GeoPackageParser(::benchmark::State& state) {
+  const std::string path = maliput_geopackage::benchmark::CityGridMapPath(
+      maliput_geopackage::benchmark::CityGridOptionsForLanes(static_cast<int>(state.range(0))));
+  ParserConfiguration config;
+  config.parser_threads = static_cast<int>(state.range(1));
+  ParserStats stats;
+  for (auto _ : state) {
+    const GeoPackageParser parser(path, config);
+    stats = parser.stats();
+    ::benchmark::DoNotOptimize(parser.GetJunctions().size());
+  }
+  state.counters["lanes"] = static_cast<double>(stats.lanes);
+  state.counters["points"] = static_cast<double>(stats.points_decoded);
+  state.counters["lanes_per_second"] =
+      ::benchmark::Counter(static_cast<double>(stats.lanes), ::benchmark::Counter::kIsIterationInvariantRate);
+  state.SetBytesProcessed(state.iterations() * stats.geometry_bytes_read);
+}
+
+// Loads a region covering the southern tenth of the city grid of about `state.range(0)` lanes.
+void BM_GeoPackageParserLoadRegion(::benchmark::State& state) {
+  const tools::CityGridOptions options =
+      maliput_geopackage::benchmark::CityGridOptionsForLanes(static_cast<int>(state.range(0)));
+  const std::string path = maliput_geopackage::benchmark::CityGridMapPath(options);
+  ParserConfiguration config;
+  config.load_region = Region2d{0., 0., options.blocks_x * options.block_size,
+                                options.block_size * std::max(1, options.blocks_y / 10)};
+  ParserStats stats;
+  for (auto _ : state) {
+    const GeoPackageParser parser(path, config);
+    stats = parser.stats();
+    ::benchmark::DoNotOptimize(parser.GetJunctions().size());
+  }
+  state.counters["lanes"] = static_cast<double>(stats.lanes);
+}
+
+BENCHMARK(BM_GeoPackageParser)
+    ->ArgNames({"lanes", "threads"})
+    ->ArgsProduct({::benchmark::CreateRange(100, 1000000, 10), {1, 0}})
+    ->Unit(::benchmark::kMillisecond);
+BENCHMARK(BM_GeoPackageParserLoadRegion)
+    ->ArgNames({"lanes"})
+    ->RangeMultiplier(10)
+    ->Range(100, 1000000)
+    ->Unit(::benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace benchmark
+}  // namespace geopackage
+}  // namespace maliput_geopackage
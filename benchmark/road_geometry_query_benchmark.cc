@@ -0,0 +1,229 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/road_network.h>
+
+#include "maliput_geopackage/builder/road_network_builder.h"
+#include "maliput_geopackage/builder/road_position_index.h"
+#include "maliput_geopackage/builder/road_position_query_session.h"
+#include "city_grid_map.h"
+
+namespace maliput_geopackage {
+namespace builder {
+namespace benchmark {
+namespace {
+
+// Number of query positions cycled through by each benchmark.
+constexpr int kNumQueries{1024};
+
+// @returns The RoadNetwork of the city grid of about `num_lanes` lanes and its RoadPositionIndex, built on first
+// use and kept for the remaining benchmarks, since building large maps dominates the run time otherwise.
+const IndexedRoadNetwork& CityGridRoadNetwork(int num_lanes) {
+  static std::map<int, IndexedRoadNetwork> road_networks;
+  auto it = road_networks.find(num_lanes);
+  if (it == road_networks.end()) {
+    const std::map<std::string, std::string> builder_config{
+        {"gpkg_file", maliput_geopackage::benchmark::CityGridMapPath(
+                          maliput_geopackage::benchmark::CityGridOptionsForLanes(num_lanes))},
+        {"linear_tolerance", "0.01"},
+        {"angular_tolerance", "0.01"},
+    };
+    it = road_networks.emplace(num_lanes, RoadNetworkBuilder(builder_config).BuildIndexed()).first;
+  }
+  return it->second;
+}
+
+const maliput::api::RoadGeometry* CityGridRoadGeometry(int num_lanes) {
+  return CityGridRoadNetwork(num_lanes).road_network->road_geometry();
+}
+
+const RoadPositionIndex* CityGridRoadPositionIndex(int num_lanes) {
+  return CityGridRoadNetwork(num_lanes).road_position_index.get();
+}
+
+// A query location: a road lane of the city grid and an inertial position on it.
+struct Query {
+  std::string lane_id;
+  maliput::api::LanePosition lane_position;
+  maliput::api::InertialPosition inertial_position;
+};
+
+// @returns `kNumQueries` random locations spread over the road lanes of the city grid of about `num_lanes` lanes.
+std::vector<Query> MakeQueries(int num_lanes) {
+  const tools::CityGridOptions options = maliput_geopackage::benchmark::CityGridOptionsForLanes(num_lanes);
+  std::mt19937 generator(42);
+  std::vector<Query> queries;
+  queries.reserve(kNumQueries);
+  for (int i = 0; i < kNumQueries; ++i) {
+    const maliput_geopackage::benchmark::RoadLanePoint point =
+        maliput_geopackage::benchmark::RandomRoadLanePoint(options, &generator);
+    queries.push_back({point.lane_id, maliput::api::LanePosition(point.s, point.r, 0.),
+                       maliput::api::InertialPosition(point.x, point.y, 0.)});
+  }
+  return queries;
+}
+
+// @returns `kNumQueries` positions 5 cm apart along the first road of the city grid of about `num_lanes` lanes,
+// weaving across both of its lanes, as a vehicle localizing itself would query them.
+std::vector<maliput::api::InertialPosition> MakeTrajectory(int num_lanes) {
+  const tools::CityGridOptions options = maliput_geopackage::benchmark::CityGridOptionsForLanes(num_lanes);
+  // The road runs along the x axis, between the intersections at both ends of the first block.
+  const double half_size = (options.lanes_per_direction + 1) * options.lane_width;
+  const double road_length = options.block_size - 2. * half_size;
+  std::vector<maliput::api::InertialPosition> trajectory;
+  trajectory.reserve(kNumQueries);
+  for (int i = 0; i < kNumQueries; ++i) {
+    trajectory.emplace_back(half_size + std::fmod(0.05 * i, road_length),
+                            0.8 * options.lane_width * std::sin(0.01 * i), 0.);
+  }
+  return trajectory;
+}
+
+void BM_ToRoadPosition(::benchmark::State& state) {
+  const maliput::api::RoadGeometry* road_geometry = CityGridRoadGeometry(static_cast<int>(state.range(0)));
+  const std::vector<Query> queries = MakeQueries(static_cast<int>(state.range(0)));
+  size_t i{0};
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(road_geometry->ToRoadPosition(queries[i++ % queries.size()].inertial_position));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_FindRoadPositions(::benchmark::State& state) {
+  constexpr double kRadius{5.};
+  const maliput::api::RoadGeometry* road_geometry = CityGridRoadGeometry(static_cast<int>(state.range(0)));
+  const std::vector<Query> queries = MakeQueries(static_cast<int>(state.range(0)));
+  size_t i{0};
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(
+        road_geometry->FindRoadPositions(queries[i++ % queries.size()].inertial_position, kRadius));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Same queries as BM_ToRoadPosition, through the RoadPositionIndex.
+void BM_IndexedToRoadPosition(::benchmark::State& state) {
+  const RoadPositionIndex* index = CityGridRoadPositionIndex(static_cast<int>(state.range(0)));
+  const std::vector<Query> queries = MakeQueries(static_cast<int>(state.range(0)));
+  size_t i{0};
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(index->ToRoadPosition(queries[i++ % queries.size()].inertial_position));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Same queries as BM_FindRoadPositions, through the RoadPositionIndex.
+void BM_IndexedFindRoadPositions(::benchmark::State& state) {
+  constexpr double kRadius{5.};
+  const RoadPositionIndex* index = CityGridRoadPositionIndex(static_cast<int>(state.range(0)));
+  const std::vector<Query> queries = MakeQueries(static_cast<int>(state.range(0)));
+  size_t i{0};
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(index->FindRoadPositions(queries[i++ % queries.size()].inertial_position, kRadius));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Positions along a trajectory through the RoadPositionIndex, for comparison with BM_SessionToRoadPosition.
+void BM_IndexedToRoadPositionAlongTrajectory(::benchmark::State& state) {
+  const RoadPositionIndex* index = CityGridRoadPositionIndex(static_cast<int>(state.range(0)));
+  const std::vector<maliput::api::InertialPosition> trajectory = MakeTrajectory(static_cast<int>(state.range(0)));
+  size_t i{0};
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(index->ToRoadPosition(trajectory[i++ % trajectory.size()]));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Same queries as BM_IndexedToRoadPositionAlongTrajectory, through a RoadPositionQuerySession.
+void BM_SessionToRoadPosition(::benchmark::State& state) {
+  RoadPositionQuerySession session(CityGridRoadPositionIndex(static_cast<int>(state.range(0))));
+  const std::vector<maliput::api::InertialPosition> trajectory = MakeTrajectory(static_cast<int>(state.range(0)));
+  size_t i{0};
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(session.ToRoadPosition(trajectory[i++ % trajectory.size()]));
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["hit_rate"] = session.stats().hit_rate();
+}
+
+void BM_GetLaneById(::benchmark::State& state) {
+  const maliput::api::RoadGeometry* road_geometry = CityGridRoadGeometry(static_cast<int>(state.range(0)));
+  std::vector<maliput::api::LaneId> lane_ids;
+  for (const auto& query : MakeQueries(static_cast<int>(state.range(0)))) {
+    lane_ids.emplace_back(query.lane_id);
+  }
+  size_t i{0};
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(road_geometry->ById().GetLane(lane_ids[i++ % lane_ids.size()]));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_LaneToInertialPosition(::benchmark::State& state) {
+  const maliput::api::RoadGeometry* road_geometry = CityGridRoadGeometry(static_cast<int>(state.range(0)));
+  std::vector<std::pair<const maliput::api::Lane*, maliput::api::LanePosition>> lane_positions;
+  for (const auto& query : MakeQueries(static_cast<int>(state.range(0)))) {
+    lane_positions.emplace_back(road_geometry->ById().GetLane(maliput::api::LaneId(query.lane_id)),
+                                query.lane_position);
+  }
+  size_t i{0};
+  for (auto _ : state) {
+    const auto& [lane, lane_position] = lane_positions[i++ % lane_positions.size()];
+    ::benchmark::DoNotOptimize(lane->ToInertialPosition(lane_position));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_ToRoadPosition)->ArgNames({"lanes"})->RangeMultiplier(10)->Range(100, 1000000);
+BENCHMARK(BM_FindRoadPositions)->ArgNames({"lanes"})->RangeMultiplier(10)->Range(100, 1000000);
+BENCHMARK(BM_IndexedToRoadPosition)->ArgNames({"lanes"})->RangeMultiplier(10)->Range(100, 1000000);
+BENCHMARK(BM_IndexedFindRoadPositions)->ArgNames({"lanes"})->RangeMultiplier(10)->Range(100, 1000000);
+BENCHMARK(BM_IndexedToRoadPositionAlongTrajectory)->ArgNames({"lanes"})->RangeMultiplier(10)->Range(100, 1000000);
+BENCHMARK(BM_SessionToRoadPosition)->ArgNames({"lanes"})->RangeMultiplier(10)->Range(100, 1000000);
+BENCHMARK(BM_GetLaneById)->ArgNames({"lanes"})->RangeMultiplier(10)->Range(100, 1000000);
+BENCHMARK(BM_LaneToInertialPosition)->ArgNames({"lanes"})->RangeMultiplier(10)->Range(100, 1000000);
+
+}  // namespace
+}  // namespace benchmark
+}  // namespace builder
+}  // namespace maliput_geopackage
@@ -0,0 +1,77 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <map>
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/road_network.h>
+
+#include "maliput_geopackage/builder/road_network_builder.h"
+#include "city_grid_map.h"
+
+namespace maliput_geopackage {
+namespace builder {
+namespace benchmark {
+namespace {
+
+// Builds a RoadNetwork out of the city grid of about `state.range(0)` lanes.
+void BM_RoadNetworkBuilder(::benchmark::State& state) {
+  const std::map<std::string, std::string> builder_config{
+      {"gpkg_file", maliput_geopackage::benchmark::CityGridMapPath(
+                        maliput_geopackage::benchmark::CityGridOptionsForLanes(static_cast<int>(state.range(0))))},
+      {"linear_tolerance", "0.01"},
+      {"angular_tolerance", "0.01"},
+  };
+  LoadStats stats;
+  for (auto _ : state) {
+    const std::unique_ptr<maliput::api::RoadNetwork> road_network = RoadNetworkBuilder(builder_config)(&stats);
+    ::benchmark::DoNotOptimize(road_network->road_geometry()->num_junctions());
+  }
+  state.counters["lanes"] = static_cast<double>(stats.parser.lanes);
+  state.counters["lanes_per_second"] =
+      ::benchmark::Counter(static_cast<double>(stats.parser.lanes), ::benchmark::Counter::kIsIterationInvariantRate);
+  state.counters["process_peak_rss_mb"] = static_cast<double>(stats.process_peak_rss_bytes) / (1024. * 1024.);
+  for (const auto& phase : stats.phases) {
+    state.counters[phase.name + "_ms"] = 1e3 * phase.seconds;
+  }
+}
+
+BENCHMARK(BM_RoadNetworkBuilder)
+    ->ArgNames({"lanes"})
+    ->RangeMultiplier(10)
+    ->Range(100, 1000000)
+    ->Unit(::benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace benchmark
+}  // namespace builder
+}  // namespace maliput_geopackage
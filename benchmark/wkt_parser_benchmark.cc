@@ -0,0 +1,184 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <maliput/math/vector.h>
+
+#include "maliput_geopackage/geopackage/compact_parser.h"
+#include "maliput_geopackage/geopackage/wkb_parser.h"
+#include "maliput_geopackage/geopackage/wkt_parser.h"
+#include "tools/geometry_encoding.h"
+
+namespace maliput_geopackage {
+namespace geopackage {
+namespace benchmark {
+namespace {
+
+// Reference implementation: the istringstream based parser ParseLineStringZ used to be.
+std::vector<maliput::math::Vector3> LegacyParseLineStringZ(const std::string& wkt) {
+  std::string upper_wkt = wkt;
+  std::transform(upper_wkt.begin(), upper_wkt.end(), upper_wkt.begin(), ::toupper);
+  if (upper_wkt.find("LINESTRING") == std::string::npos) {
+    throw std::runtime_error("WKT string is not a LINESTRING: '" + wkt + "'");
+  }
+  const auto open_paren = wkt.find('(');
+  const auto close_paren = wkt.rfind(')');
+  const std::string content = wkt.substr(open_paren + 1, close_paren - open_paren - 1);
+
+  std::vector<maliput::math::Vector3> points;
+  std::istringstream iss(content);
+  std::string point_str;
+  while (std::getline(iss, point_str, ',')) {
+    std::istringstream point_iss(point_str);
+    double x, y, z;
+    if (!(point_iss >> x >> y >> z)) {
+      throw std::runtime_error("Malformed WKT point: '" + point_str + "'");
+    }
+    points.push_back(maliput::math::Vector3(x, y, z));
+  }
+  return points;
+}
+
+// Builds a LINESTRINGZ with `num_points` points sampled along a gentle curve.
+std::string MakeLineStringZ(int num_points) {
+  std::ostringstream oss;
+  oss.precision(15);
+  oss << "LINESTRINGZ(";
+  for (int i = 0; i < num_points; ++i) {
+    const double x = 0.1 * i;
+    oss << (i == 0 ? "" : ", ") << x << " " << (3.5 + 1e-3 * x * x) << " " << (0.01 * x);
+  }
+  oss << ")";
+  return oss.str();
+}
+
+void BM_LegacyParseLineStringZ(::benchmark::State& state) {
+  const std::string wkt = MakeLineStringZ(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(LegacyParseLineStringZ(wkt));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(wkt.size()));
+}
+
+void BM_ParseLineStringZ(::benchmark::State& state) {
+  const std::string wkt = MakeLineStringZ(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    ::benchmark::DoNotOptimize(ParseLineStringZ(wkt));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(wkt.size()));
+}
+
+void BM_ParseLineStringZIntoBuffer(::benchmark::State& state) {
+  const std::string wkt = MakeLineStringZ(static_cast<int>(state.range(0)));
+  std::vector<maliput::math::Vector3> points;
+  for (auto _ : state) {
+    points.clear();
+    ParseLineStringZ(wkt, &points);
+    ::benchmark::DoNotOptimize(points.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(wkt.size()));
+}
+
+// @returns `num_points` points along the curve MakeLineStringZ() samples.
+std::vector<maliput::math::Vector3> MakePoints(int num_points) {
+  std::vector<maliput::math::Vector3> points;
+  for (int i = 0; i < num_points; ++i) {
+    const double x = 0.1 * i;
+    points.emplace_back(x, 3.5 + 1e-3 * x * x, 0.01 * x);
+  }
+  return points;
+}
+
+void BM_ParseGeoPackageBinaryLineStringZ(::benchmark::State& state) {
+  std::string blob;
+  tools::AppendGeoPackageBinaryLineStringZ(MakePoints(static_cast<int>(state.range(0))), &blob);
+  const auto* data = reinterpret_cast<const uint8_t*>(blob.data());
+  std::vector<maliput::math::Vector3> points;
+  for (auto _ : state) {
+    points.clear();
+    ParseGeoPackageBinaryLineStringZ(data, blob.size(), &points);
+    ::benchmark::DoNotOptimize(points.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(blob.size()));
+}
+
+// Millimetre-quantized compact geometry, with varint deltas when `state.range(1)` is non-zero.
+void BM_ParseCompactLineStringZ(::benchmark::State& state) {
+  std::string blob;
+  tools::AppendCompactLineStringZ(MakePoints(static_cast<int>(state.range(0))),
+                                  tools::CompactEncoding{1e-3, state.range(1) != 0}, &blob);
+  const auto* data = reinterpret_cast<const uint8_t*>(blob.data());
+  std::vector<maliput::math::Vector3> points;
+  for (auto _ : state) {
+    points.clear();
+    ParseCompactLineStringZ(data, blob.size(), &points);
+    ::benchmark::DoNotOptimize(points.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(blob.size()));
+}
+
+// Parses `state.range(0)` distinct POINTZ strings per iteration.
+void BM_ParsePointZ(::benchmark::State& state) {
+  std::vector<std::string> wkts;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    std::ostringstream oss;
+    oss.precision(15);
+    oss << "POINTZ(" << 0.1 * i << " " << (3.5 + 1e-3 * i * i) << " " << 0.01 * i << ")";
+    wkts.push_back(oss.str());
+  }
+  for (auto _ : state) {
+    for (const auto& wkt : wkts) {
+      ::benchmark::DoNotOptimize(ParsePointZ(wkt));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_LegacyParseLineStringZ)->RangeMultiplier(8)->Range(2, 32768);
+BENCHMARK(BM_ParseLineStringZ)->RangeMultiplier(8)->Range(2, 32768);
+BENCHMARK(BM_ParseLineStringZIntoBuffer)->RangeMultiplier(8)->Range(2, 32768);
+BENCHMARK(BM_ParseGeoPackageBinaryLineStringZ)->RangeMultiplier(8)->Range(2, 32768);
+BENCHMARK(BM_ParseCompactLineStringZ)->ArgsProduct({::benchmark::CreateRange(2, 32768, 8), {0, 1}});
+BENCHMARK(BM_ParsePointZ)->RangeMultiplier(8)->Range(1, 4096);
+
+}  // namespace
+}  // namespace benchmark
+}  // namespace geopackage
+}  // namespace maliput_geopackage
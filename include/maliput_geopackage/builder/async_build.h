@@ -0,0 +1,117 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <maliput/api/road_network.h>
+
+#include "maliput_geopackage/builder/load_stats.h"
+
+namespace maliput_geopackage {
+namespace builder {
+
+class RoadNetworkBuilder;
+
+/// Progress of a build started by RoadNetworkBuilder::BuildAsync().
+struct BuildProgress {
+  /// Name of the phase that just started, as in LoadStats::phases.
+  std::string phase;
+  /// Rows read from the GeoPackage so far, over every table.
+  int64_t rows{0};
+};
+
+/// Receives the BuildProgress of a build, on the thread running it: as every phase starts and every thousand or so
+/// rows while reading the GeoPackage.
+using ProgressCallback = std::function<void(const BuildProgress&)>;
+
+/// Thrown by AsyncBuild::Get() when the build was cancelled before it completed.
+class BuildCancelled : public std::runtime_error {
+ public:
+  BuildCancelled() : std::runtime_error("The RoadNetwork build was cancelled.") {}
+};
+
+/// Handle to a RoadNetwork being built on its own thread, see RoadNetworkBuilder::BuildAsync().
+///
+/// Cancel() stops the build at the next row or phase it reaches while reading the GeoPackage, closing it, or before
+/// the next phase after that. The maliput_sparse loader itself cannot be interrupted, so a build cancelled while
+/// it runs completes that phase first.
+///
+/// Destroying an unfinished build cancels it and waits for its thread to stop.
+class AsyncBuild {
+ public:
+  AsyncBuild(const AsyncBuild&) = delete;
+  AsyncBuild& operator=(const AsyncBuild&) = delete;
+  AsyncBuild(AsyncBuild&&) = default;
+  AsyncBuild& operator=(AsyncBuild&&) = delete;
+
+  ~AsyncBuild();
+
+  /// Asks the build to stop. It has no effect once the build completed.
+  void Cancel();
+
+  /// @returns True when the build completed, failed or stopped after Cancel(), so that Get() does not block.
+  bool IsReady() const;
+
+  /// Blocks until IsReady().
+  void Wait() const;
+
+  /// Blocks until IsReady() and returns the built RoadNetwork. It can only be called once.
+  /// @param load_stats When not nullptr, it is filled with the load statistics.
+  /// @return A maliput_geopackage RoadNetwork.
+  /// @throws BuildCancelled if the build was cancelled before it completed.
+  /// @throws std::runtime_error if the build failed, as RoadNetworkBuilder::operator()() would.
+  std::unique_ptr<maliput::api::RoadNetwork> Get(LoadStats* load_stats = nullptr);
+
+ private:
+  friend class RoadNetworkBuilder;
+
+  // What the build thread hands back.
+  struct Result {
+    std::unique_ptr<maliput::api::RoadNetwork> road_network;
+    LoadStats load_stats;
+  };
+
+  AsyncBuild(std::shared_ptr<std::atomic<bool>> cancelled, std::future<Result> result)
+      : cancelled_(std::move(cancelled)), result_(std::move(result)) {}
+
+  // Shared with the build thread, which polls it.
+  std::shared_ptr<std::atomic<bool>> cancelled_;
+  std::future<Result> result_;
+};
+
+}  // namespace builder
+}  // namespace maliput_geopackage
@@ -0,0 +1,109 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/common/maliput_copyable.h>
+
+#include "maliput_geopackage/builder/road_position_index.h"
+
+namespace maliput_geopackage {
+namespace geopackage {
+class WorkStealingPool;
+}  // namespace geopackage
+
+namespace builder {
+
+/// A position in the frame of a lane, to convert into the inertial frame.
+struct LanePositionQuery {
+  const maliput::api::Lane* lane{nullptr};
+  maliput::api::LanePosition lane_position;
+};
+
+/// Converts large batches of positions, e.g. every point of recorded trajectories, on several threads.
+///
+/// Each batch is first ordered by spatial locality, inertial positions along a Z-order curve and lane positions by
+/// lane and `s`, so that the queries a thread runs back to back touch the same lanes. The ordered queries are
+/// then run in chunks on a work-stealing thread pool, and every result is written at the index of its query in
+/// the caller's output array. The pool, the ordering buffers and a RoadPositionIndex::Scratch per thread are reused
+/// by every batch, so once the buffers fit the queries neither the runner nor the index allocate per query;
+/// num_scratch_allocations() tells when that is the case.
+///
+/// Results are the same as those of one query at a time. A runner runs one batch at a time; use a runner per
+/// thread submitting batches.
+class BatchQueryRunner {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(BatchQueryRunner);
+
+  /// Constructs the runner and starts its threads.
+  /// @param index Index answering the road position queries. It must outlive the runner.
+  /// @param num_threads Number of threads running the queries, including the calling one. Zero uses one thread
+  ///        per hardware thread.
+  explicit BatchQueryRunner(const RoadPositionIndex* index, int num_threads = 0);
+
+  ~BatchQueryRunner();
+
+  /// Sets `results[i]` to RoadPositionIndex::ToRoadPosition(`inertial_positions[i]`) for every i in [0, `count`).
+  /// @throws std::runtime_error if the RoadGeometry has no lanes or a coordinate of an inertial position is not
+  ///         finite.
+  void ToRoadPosition(const maliput::api::InertialPosition* inertial_positions, size_t count,
+                      maliput::api::RoadPositionResult* results);
+
+  /// Sets `results[i]` to `queries[i].lane->ToInertialPosition(queries[i].lane_position)` for every i in
+  /// [0, `count`).
+  /// @throws std::runtime_error if a query has no lane.
+  void ToInertialPosition(const LanePositionQuery* queries, size_t count, maliput::api::InertialPosition* results);
+
+  /// @returns The number of threads running the queries, including the calling one.
+  int num_threads() const;
+
+  /// @returns The number of queries, over every batch so far, that grew the query buffers of a thread. It stops
+  ///          increasing once the buffers of every thread fit the queries.
+  int64_t num_scratch_allocations() const;
+
+ private:
+  const RoadPositionIndex* index_;
+  std::unique_ptr<geopackage::WorkStealingPool> pool_;
+  // Query buffers of every thread of `pool_`, by thread index.
+  std::vector<RoadPositionIndex::Scratch> scratches_;
+  // Indices of the queries of the current batch, in the order they are run.
+  std::vector<size_t> order_;
+  // Z-order keys of the inertial positions of the current batch.
+  std::vector<uint64_t> keys_;
+};
+
+}  // namespace builder
+}  // namespace maliput_geopackage
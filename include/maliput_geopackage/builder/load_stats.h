@@ -0,0 +1,79 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "maliput_geopackage/geopackage/parser_stats.h"
+
+namespace maliput_geopackage {
+namespace builder {
+
+/// Timings and counters describing how a RoadNetwork was loaded from a GeoPackage.
+///
+/// It is filled by RoadNetworkBuilder, and written as JSON to the file named by the
+/// @ref builder_configuration_keys "load_stats_file" parameter when it is set.
+struct LoadStats {
+  /// Wall-clock duration of a loading phase, e.g. "parse_segments_and_lanes" or "road_network_loader".
+  using Phase = geopackage::PhaseDuration;
+
+  /// Serializes these stats as a JSON object.
+  std::string ToJson() const;
+
+  /// Path of the loaded GeoPackage. Empty when it was loaded from memory or a file descriptor.
+  std::string gpkg_file;
+
+  /// Phases in the order they ran: the GeoPackage parser phases first, then the maliput_sparse
+  /// RoadNetwork loading.
+  std::vector<Phase> phases;
+
+  /// Wall-clock duration of the whole load, in seconds.
+  double total_seconds{0.};
+
+  /// Whether the parsed data was shared by an earlier load of the process, see params::kSharedCache. Phases
+  /// then only account for waiting on the cache and building the RoadNetwork, while `parser` is that of the
+  /// earlier load.
+  bool loaded_from_shared_cache{false};
+
+  /// Measurements of the GeoPackage parser: rows read, points decoded and the junctions, segments, lanes and
+  /// connections handed to the RoadNetwork loader. Its phases also lead `phases`, unless the parsed data came
+  /// from the shared cache.
+  geopackage::ParserStats parser;
+
+  /// Peak resident set size of the process over its whole lifetime, as of the end of the load, in bytes, or 0
+  /// when unavailable. It is not a measure of this load: it also accounts for memory used before the load
+  /// started, so a load following a larger one reports the peak of the larger one.
+  int64_t process_peak_rss_bytes{0};
+};
+
+}  // namespace builder
+}  // namespace maliput_geopackage
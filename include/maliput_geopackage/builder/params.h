@@ -62,6 +62,134 @@ static constexpr char const* kRoadGeometryId{maliput_sparse::loader::config::kRo
 ///   - Default: ""
 static constexpr char const* kGpkgFile{"gpkg_file"};
 
+/// File descriptor of an open GeoPackage to load instead of @ref kGpkgFile, e.g. a shared memory object
+/// received from another process. The file is memory-mapped and read in place; the descriptor is not
+/// closed. The snapshot cache and @ref kBuildSpatialIndex do not apply, as they need a file path.
+///   - Default: "" (load @ref kGpkgFile)
+static constexpr char const* kGpkgFd{"gpkg_fd"};
+
+/// Number of worker threads decoding lane geometry while the GeoPackage is read.
+/// A value of "0" uses one worker per hardware thread, while "1" decodes every lane on the
+/// loading thread. The resulting RoadNetwork does not depend on this value.
+///   - Default: @e "1"
+static constexpr char const* kParserThreads{"parser_threads"};
+
+/// Restricts loading to the lanes whose extent intersects an axis-aligned region of the inertial
+/// frame. The expected format is "{min_x, min_y, max_x, max_y}", in meters. An empty string
+/// loads every lane. The region is moved by @ref kInertialToBackendFrameTranslation before it is
+/// compared with the coordinates stored in the GeoPackage, which are in the backend frame.
+/// Lane extents are looked up in the `rtree_lanes` R*Tree table when the GeoPackage has one (see
+/// @ref kBuildSpatialIndex), or read from the optional `bbox_min_x`, `bbox_max_x`, `bbox_min_y` and
+/// `bbox_max_y` columns of the `lanes` table. When neither is available, every boundary is decoded
+/// once to compute them.
+///   - Default: @e ""
+static constexpr char const* kLoadRegion{"load_region"};
+
+/// Restricts loading to the lanes of the listed junctions, given as comma-separated junction IDs,
+/// e.g. "j1, j2". Combined with @ref kLoadRegion, only the lanes of these junctions intersecting the
+/// region are loaded. An empty string loads every junction.
+///   - Default: @e ""
+static constexpr char const* kLoadJunctions{"load_junctions"};
+
+/// Restricts loading to the lanes whose `lane_type` is listed, given as comma-separated types,
+/// e.g. "driving, parking". It also applies to the lanes added by @ref kExpansionHops and
+/// @ref kBoundaryPolicy. Lanes of other types are never read, and connections and adjacencies
+/// involving them are dropped. An empty string loads every type.
+///   - Default: @e ""
+static constexpr char const* kLoadLaneTypes{"load_lane_types"};
+
+/// Number of branch point hops the lanes selected by @ref kLoadRegion and @ref kLoadJunctions are
+/// expanded by, e.g. "2" also loads the lanes connected to them and the lanes connected to those.
+/// The expansion runs in SQL before any geometry is read. It has no effect without a selection.
+///   - Default: @e "0"
+static constexpr char const* kExpansionHops{"expansion_hops"};
+
+/// How connectivity is handled at the border of the lanes selected by @ref kLoadRegion,
+/// @ref kLoadJunctions and @ref kExpansionHops.
+///   - "truncate": Only the selected lanes are loaded. Connections and adjacencies involving other
+///     lanes are dropped, so lanes leaving the selection become dead ends.
+///   - "closure": Lanes sharing a branch point with a selected lane are loaded too, and loaded
+///     segments are completed with all their lanes. Connections leading further out of the
+///     selection are dropped.
+///   - Default: @e "truncate"
+static constexpr char const* kBoundaryPolicy{"boundary_policy"};
+
+/// Whether to build the `rtree_lanes` spatial index of lane extents when the GeoPackage lacks it.
+/// The index is written back to the file, so it is built only once; this requires write access to
+/// the file. Failing to build it is not an error, loading then proceeds without it.
+///   - Default: @e "false"
+static constexpr char const* kBuildSpatialIndex{"build_spatial_index"};
+
+/// Whether to cache the parsed GeoPackage in a binary snapshot.
+/// When "true", the first load writes a snapshot of the parsed data and later loads of the same,
+/// unchanged file with the same parsing parameters memory-map it instead of querying the GeoPackage.
+/// Snapshots are keyed by the file size, modification time and content hash; a missing, stale or
+/// corrupt snapshot falls back to parsing and is then rewritten.
+///   - Default: @e "false"
+static constexpr char const* kSnapshotCache{"snapshot_cache"};
+
+/// Directory holding the snapshots written when @ref kSnapshotCache is enabled. When empty, they are
+/// written next to the GeoPackage file as "<gpkg_file>.<options hash>.snapshot".
+///   - Default: @e ""
+static constexpr char const* kSnapshotCacheDir{"snapshot_cache_dir"};
+
+/// Whether to open the GeoPackage as immutable: SQLite then skips file locking and change detection,
+/// which saves a few system calls per query. Only enable it for files nothing writes to while they
+/// are loaded; a concurrent writer may otherwise yield corrupt results.
+///   - Default: @e "false"
+static constexpr char const* kSqliteImmutable{"sqlite_immutable"};
+
+/// Number of bytes of the GeoPackage SQLite may read through a memory mapping instead of read calls,
+/// e.g. "268435456" for 256 MiB. The SQLite build may cap it. "0" disables memory-mapped I/O.
+///   - Default: @e "0"
+static constexpr char const* kSqliteMmapSize{"sqlite_mmap_size"};
+
+/// Size of the SQLite page cache in KiB. "0" keeps the SQLite default, about 2 MiB.
+///   - Default: @e "0"
+static constexpr char const* kSqliteCacheSize{"sqlite_cache_size"};
+
+/// Whether to ask the kernel to read the GeoPackage (or its snapshot) ahead into the page cache before
+/// it is queried. Mostly helps the first load of a large file from a slow or cold disk.
+///   - Default: @e "false"
+static constexpr char const* kReadAhead{"read_ahead"};
+
+/// Post-processing of the lane boundaries once decoded, to shed the points densely sampled maps carry on
+/// nearly straight stretches:
+///   - "none": Boundaries are loaded as stored.
+///   - "simplify": Each boundary is simplified with the Douglas-Peucker algorithm, in 3D. The simplified
+///     boundary stays within @ref kLinearTolerance of the stored one.
+///   - "match": Each boundary is simplified as with "simplify", then the left and right boundaries of every
+///     lane are resampled so that both have a vertex at every normalized arc length at which either has one.
+///     Added vertices lie on the simplified boundaries, so the error bound still holds. Lanes referencing a
+///     shared boundary are only simplified, so that both lanes along it keep identical vertices.
+/// The work is spread over @ref kParserThreads threads. The points kept are reported in LoadStats.
+///   - Default: @e "none"
+static constexpr char const* kSimplifyBoundaries{"simplify_boundaries"};
+
+/// Whether to keep the parsed GeoPackage in memory for the whole process, so that later loads of the same,
+/// unchanged file with the same parameters skip parsing. Only the parse is shared: every load still builds a
+/// RoadNetwork of its own from it, since networks hold mutable rule state and are handed out as unique
+/// owners, and that build is not made any cheaper. This suits processes loading one map many times, e.g. once
+/// per simulated agent, when parsing takes a large part of the load time; the "shared_cache" and
+/// "road_network_loader" phases of LoadStats tell both costs apart. Loads requesting a map while it is being
+/// parsed wait for that parse instead of starting their own. Maps are told apart by their device, inode,
+/// size and modification time, and by every other configuration key except @ref kGpkgFile, @ref kGpkgFd,
+/// @ref kParserThreads, @ref kLoadStatsFile and @ref kSharedCacheCapacity. GeoPackages loaded from memory are
+/// not cached.
+///   - Default: @e "false"
+static constexpr char const* kSharedCache{"shared_cache"};
+
+/// Number of parsed GeoPackages @ref kSharedCache keeps. Once a load adds one beyond it, the least recently
+/// used ones are dropped. "0" keeps them all until RoadNetworkBuilder::ClearSharedCache() is called.
+///   - Default: @e "4"
+static constexpr char const* kSharedCacheCapacity{"shared_cache_capacity"};
+
+/// Path of a file the load statistics are written to as JSON: per-phase durations, row counts,
+/// points decoded, geometry bytes read and the peak memory of the process. See LoadStats. An empty string disables it.
+/// Failing to write the file is logged but does not fail the load.
+///   - Default: @e ""
+static constexpr char const* kLoadStatsFile{"load_stats_file"};
+
 /// RoadGeometry's linear tolerance.
 ///   - Default: @e "5e-2"
 static constexpr char const* kLinearTolerance{maliput_sparse::loader::config::kLinearTolerance};
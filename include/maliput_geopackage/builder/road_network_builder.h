@@ -29,6 +29,8 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
@@ -36,9 +38,24 @@
 #include <maliput/api/road_network.h>
 #include <maliput/common/maliput_copyable.h>
 
+#include "maliput_geopackage/builder/async_build.h"
+#include "maliput_geopackage/builder/load_stats.h"
+#include "maliput_geopackage/builder/road_position_index.h"
+#include "maliput_geopackage/builder/road_position_query_session.h"
+
 namespace maliput_geopackage {
 namespace builder {
 
+/// A RoadNetwork together with the index accelerating position queries on its RoadGeometry.
+struct IndexedRoadNetwork {
+  std::unique_ptr<maliput::api::RoadNetwork> road_network;
+  /// Index over `road_network`'s RoadGeometry. Declared last so that it is destroyed first.
+  std::unique_ptr<RoadPositionIndex> road_position_index;
+
+  /// @returns A new session remembering the lane of its previous query, for use by a single thread.
+  RoadPositionQuerySession NewQuerySession() const { return RoadPositionQuerySession(road_position_index.get()); }
+};
+
 /// Builds a maliput::api::RoadNetwork from a GeoPackage file.
 class RoadNetworkBuilder {
  public:
@@ -51,12 +68,63 @@ class RoadNetworkBuilder {
   explicit RoadNetworkBuilder(const std::map<std::string, std::string>& builder_config)
       : builder_config_(builder_config) {}
 
+  /// Constructs a RoadNetworkBuilder loading a GeoPackage held in memory instead of the one named by the
+  /// configuration, without writing it to a file first. The bytes are read in place; they must stay valid
+  /// until the road network is built, not afterwards.
+  ///
+  /// @param builder_config Builder configuration. Its "gpkg_file" and "gpkg_fd" keys are ignored.
+  /// @param gpkg_data The first byte of the GeoPackage.
+  /// @param gpkg_size The size of the GeoPackage in bytes.
+  /// @see params.h for available configuration keys.
+  RoadNetworkBuilder(const std::map<std::string, std::string>& builder_config, const void* gpkg_data,
+                     size_t gpkg_size)
+      : builder_config_(builder_config), gpkg_data_(gpkg_data), gpkg_size_(gpkg_size) {}
+
   /// Builds and returns a maliput_geopackage RoadNetwork.
   /// @return A maliput_geopackage RoadNetwork.
   std::unique_ptr<maliput::api::RoadNetwork> operator()() const;
 
+  /// Builds and returns a maliput_geopackage RoadNetwork, measuring how long each loading phase takes.
+  /// @param load_stats When not nullptr, it is filled with the load statistics.
+  /// @return A maliput_geopackage RoadNetwork.
+  std::unique_ptr<maliput::api::RoadNetwork> operator()(LoadStats* load_stats) const;
+
+  /// Builds a maliput_geopackage RoadNetwork and a RoadPositionIndex over its RoadGeometry, whose lane boxes are
+  /// the extents of the parsed boundaries. The index adds a "build_road_position_index" phase to the load stats.
+  /// @param load_stats When not nullptr, it is filled with the load statistics.
+  /// @return The RoadNetwork and its index.
+  IndexedRoadNetwork BuildIndexed(LoadStats* load_stats = nullptr) const;
+
+  /// Starts building a maliput_geopackage RoadNetwork on a new thread and returns right away, so that several
+  /// GeoPackages can be loaded at once, or the next one while the current one is in use.
+  ///
+  /// The build uses a copy of the configuration and does not refer to this builder, which may be destroyed before
+  /// the build completes. A GeoPackage held in memory must stay valid until it does.
+  ///
+  /// With @ref params::kSharedCache a GeoPackage may be parsed for several loads at once, so no rows are reported
+  /// while parsing it and Cancel() only takes effect once it is parsed.
+  ///
+  /// @param on_progress When not nullptr, it is called with the progress of the build, on its thread. It may
+  /// call AsyncBuild::Cancel() but must not wait for the build.
+  /// @return A handle to the build.
+  AsyncBuild BuildAsync(ProgressCallback on_progress = nullptr) const;
+
+  /// Drops the parsed GeoPackages kept by loads enabling @ref params::kSharedCache, except those still being
+  /// parsed. RoadNetworks built from them are not affected.
+  static void ClearSharedCache();
+
  private:
+  // Builds the RoadNetwork, and its index when `road_position_index` is not nullptr. Progress is reported to
+  // `on_progress`, when set, and the build throws BuildCancelled once `cancelled`, when set, is true.
+  std::unique_ptr<maliput::api::RoadNetwork> Build(LoadStats* load_stats,
+                                                   std::unique_ptr<RoadPositionIndex>* road_position_index,
+                                                   const ProgressCallback& on_progress,
+                                                   const std::shared_ptr<const std::atomic<bool>>& cancelled) const;
+
   const std::map<std::string, std::string> builder_config_;
+  // In-memory GeoPackage to load, or nullptr to load the configured one.
+  const void* gpkg_data_{nullptr};
+  const size_t gpkg_size_{0};
 };
 
 }  // namespace builder
@@ -0,0 +1,145 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/math/vector.h>
+
+namespace maliput_geopackage {
+namespace geopackage {
+class LaneRTree;
+}  // namespace geopackage
+
+namespace builder {
+
+class RoadPositionQuerySession;
+
+/// Axis-aligned bounding box of a lane in the inertial frame, e.g. the extent of both of its boundaries.
+struct LaneBox {
+  maliput::math::Vector3 min;
+  maliput::math::Vector3 max;
+};
+
+/// Answers RoadGeometry::ToRoadPosition() and RoadGeometry::FindRoadPositions() queries through an in-memory R-tree
+/// over lane bounding boxes, so only the lanes near the queried position are evaluated rather than every lane.
+///
+/// Lane boxes are padded by the RoadGeometry linear tolerance and by the reach of the lane elevation bounds, so
+/// they hold every position a lane can report. Results are the same as those of the RoadGeometry, and
+/// FindRoadPositions() lists them in the same order.
+///
+/// The RoadGeometry breaks near-ties between lanes with maliput::api::IsNewRoadPositionResultCloser(), which is not
+/// transitive, so ToRoadPosition() cannot just evaluate the lanes within one linear tolerance of the nearest one.
+/// It evaluates lanes until those it keeps are more than one linear tolerance nearer than all others, however far
+/// ties chain, and then breaks ties among them in RoadGeometry order.
+///
+/// The index is immutable and can be queried from several threads at once.
+class RoadPositionIndex {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(RoadPositionIndex);
+
+  /// Buffers of ToRoadPosition() queries. A thread reusing one scratch across its queries stops allocating them
+  /// once the buffers fit the queries. A scratch must not be used by several threads at once. The buffers hold
+  /// nothing across queries, so a copy is a new scratch with empty buffers.
+  class Scratch {
+   public:
+    Scratch();
+    Scratch(const Scratch&);
+    Scratch& operator=(const Scratch&);
+    Scratch(Scratch&&) noexcept;
+    Scratch& operator=(Scratch&&) noexcept;
+    ~Scratch();
+
+    /// @returns The number of queries that grew the buffers.
+    int64_t num_allocations() const { return num_allocations_; }
+
+   private:
+    friend class RoadPositionIndex;
+    struct Buffers;
+
+    std::unique_ptr<Buffers> buffers_;
+    int64_t num_allocations_{0};
+  };
+
+  /// Builds the index.
+  /// @param road_geometry The indexed RoadGeometry. It must outlive the index.
+  /// @param lane_boxes Bounding box of the boundaries of every lane of `road_geometry`, by lane ID.
+  /// @throws std::runtime_error if a lane of `road_geometry` has no box.
+  RoadPositionIndex(const maliput::api::RoadGeometry* road_geometry,
+                    const std::unordered_map<std::string, LaneBox>& lane_boxes);
+
+  ~RoadPositionIndex();
+
+  /// Same as RoadGeometry::ToRoadPosition().
+  /// @throws std::runtime_error if the RoadGeometry has no lanes.
+  maliput::api::RoadPositionResult ToRoadPosition(const maliput::api::InertialPosition& inertial_position) const;
+
+  /// Same as above, using the buffers of `scratch`.
+  /// @throws std::runtime_error if the RoadGeometry has no lanes.
+  maliput::api::RoadPositionResult ToRoadPosition(const maliput::api::InertialPosition& inertial_position,
+                                                  Scratch* scratch) const;
+
+  /// Same as RoadGeometry::FindRoadPositions().
+  std::vector<maliput::api::RoadPositionResult> FindRoadPositions(
+      const maliput::api::InertialPosition& inertial_position, double radius) const;
+
+  /// @returns The indexed RoadGeometry.
+  const maliput::api::RoadGeometry* road_geometry() const { return road_geometry_; }
+
+  /// @returns The number of indexed lanes.
+  int num_lanes() const { return static_cast<int>(lanes_.size()); }
+
+ private:
+  friend class RoadPositionQuerySession;
+
+  // Evaluates lane `lane_index` at `inertial_position`.
+  maliput::api::RoadPositionResult Evaluate(int lane_index,
+                                            const maliput::api::InertialPosition& inertial_position) const;
+
+  const maliput::api::RoadGeometry* road_geometry_;
+  // Lanes by junction, segment and lane, the order RoadGeometry queries visit them in.
+  std::vector<const maliput::api::Lane*> lanes_;
+  // Index of every lane in `lanes_`.
+  std::unordered_map<const maliput::api::Lane*, int> lane_indices_;
+  // For every lane, the sorted indices of the lane itself, its left and right neighbours and the lanes ongoing at
+  // either of its ends.
+  std::vector<std::vector<int>> connected_lanes_;
+  std::unique_ptr<geopackage::LaneRTree> tree_;
+};
+
+}  // namespace builder
+}  // namespace maliput_geopackage
@@ -0,0 +1,105 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/common/maliput_copyable.h>
+
+#include "maliput_geopackage/builder/road_position_index.h"
+
+namespace maliput_geopackage {
+namespace builder {
+
+/// Hit counters of a RoadPositionQuerySession.
+struct QuerySessionStats {
+  /// @returns The fraction of queries answered without a full search, or 0 before the first query.
+  double hit_rate() const {
+    return queries == 0 ? 0. : static_cast<double>(hinted_lane_hits + connected_lane_hits) / queries;
+  }
+
+  /// Queries answered by the session.
+  int64_t queries{0};
+  /// Queries that landed on the lane of the previous query.
+  int64_t hinted_lane_hits{0};
+  /// Queries that landed on a neighbour, successor or predecessor of the lane of the previous query.
+  int64_t connected_lane_hits{0};
+  /// Queries that needed a full search of the RoadPositionIndex, including the first one.
+  int64_t fallbacks{0};
+};
+
+/// Answers ToRoadPosition() queries for positions that move little between calls, e.g. those of a vehicle in a
+/// closed localization loop, by remembering the lane of the previous result.
+///
+/// A query first evaluates the hinted lane, its left and right neighbours and the lanes connected at either of its
+/// ends. When the position lies on one of them, within the RoadGeometry linear tolerance, that result is returned
+/// and no other lane is searched. Otherwise the query falls back to RoadPositionIndex::ToRoadPosition(), and its
+/// result becomes the next hint.
+///
+/// Results are those of RoadPositionIndex::ToRoadPosition() except where lanes overlap, e.g. inside intersections,
+/// where the session keeps to the lane it has been following rather than switching to an overlapping one.
+///
+/// A session holds mutable state and no lock: use one session per thread. Any number of sessions can share a
+/// RoadPositionIndex.
+class RoadPositionQuerySession {
+ public:
+  MALIPUT_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RoadPositionQuerySession);
+
+  /// Constructs a session without a hint.
+  /// @param index The index queries fall back to. It must outlive the session.
+  explicit RoadPositionQuerySession(const RoadPositionIndex* index);
+
+  /// Finds the road position of `inertial_position`, starting from the lane of the previous result.
+  /// @throws std::runtime_error if the RoadGeometry has no lanes.
+  maliput::api::RoadPositionResult ToRoadPosition(const maliput::api::InertialPosition& inertial_position);
+
+  /// Forgets the hint, e.g. after the queried positions jumped. The next query does a full search.
+  void Reset() { hint_ = -1; }
+
+  /// @returns The lane the next query starts from, or nullptr when there is none.
+  const maliput::api::Lane* hinted_lane() const { return hint_ < 0 ? nullptr : index_->lanes_[hint_]; }
+
+  /// @returns The hit counters of this session.
+  const QuerySessionStats& stats() const { return stats_; }
+
+ private:
+  const RoadPositionIndex* index_;
+  // Index of the hinted lane in the RoadPositionIndex, or -1 when there is none.
+  int hint_{-1};
+  // Buffers of the fallback queries, reused so that they do not allocate once warmed up.
+  RoadPositionIndex::Scratch scratch_;
+  QuerySessionStats stats_;
+};
+
+}  // namespace builder
+}  // namespace maliput_geopackage
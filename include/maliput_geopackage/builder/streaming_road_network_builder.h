@@ -0,0 +1,135 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <maliput/api/road_network.h>
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/math/vector.h>
+#include <maliput_sparse/loader/builder_configuration.h>
+
+#include "maliput_geopackage/geopackage/window_stats.h"
+
+namespace maliput_geopackage {
+namespace geopackage {
+class MappedFile;
+class WindowLoader;
+}  // namespace geopackage
+
+namespace builder {
+
+/// Options of a StreamingRoadNetworkBuilder.
+struct StreamingConfiguration {
+  /// Half the side of the square window loaded around the position, in meters.
+  double radius{200.};
+
+  /// Side of the square tiles lanes are loaded and cached by, in meters. 0 uses `radius`.
+  double tile_size{0.};
+
+  /// Approximate number of bytes of decoded lanes to keep cached. The tiles of the current window are
+  /// always kept, so this only bounds the tiles around it.
+  int64_t memory_budget_bytes{int64_t{512} << 20};
+
+  /// Length of the route ahead of the position whose tiles are prefetched, in meters. 0 uses twice `radius`.
+  double prefetch_distance{0.};
+};
+
+/// Counters of a StreamingRoadNetworkBuilder.
+struct StreamingStats {
+  /// Counters of the tile cache the windows are loaded from.
+  geopackage::WindowStats window;
+  /// Road networks built.
+  int64_t builds{0};
+};
+
+/// Builds maliput::api::RoadNetworks covering a square window around a moving position, e.g. a vehicle
+/// driving across a map too large to load at once.
+///
+/// A maliput::api::RoadNetwork cannot change, so every time the window moves a new one is built. The map is
+/// parsed by square tiles which are cached, so a new window only reads from the GeoPackage the tiles it did
+/// not cover yet and reuses the already decoded lanes of the others. Least recently used tiles are
+/// dropped beyond a memory budget, and tiles along the expected route are parsed ahead on a background
+/// thread.
+///
+/// Tiles are loaded with the "closure" @ref params::kBoundaryPolicy, so lanes within the window keep all
+/// their connections. The "load_region", "boundary_policy", "snapshot_cache", "shared_cache" and
+/// "load_stats_file" configuration keys are ignored.
+class StreamingRoadNetworkBuilder {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(StreamingRoadNetworkBuilder);
+
+  /// Constructs a StreamingRoadNetworkBuilder.
+  ///
+  /// @param builder_config Builder configuration. The GeoPackage should have a lane spatial index, see
+  /// @ref params::kBuildSpatialIndex.
+  /// @param streaming_config Window options.
+  /// @throws std::runtime_error if `streaming_config` holds non-positive sizes.
+  /// @see params.h for available configuration keys.
+  StreamingRoadNetworkBuilder(const std::map<std::string, std::string>& builder_config,
+                              const StreamingConfiguration& streaming_config = {});
+
+  ~StreamingRoadNetworkBuilder();
+
+  /// Sets the route the position is expected to follow, as a polyline of the inertial frame whose z coordinates
+  /// are ignored.
+  /// Tiles within StreamingConfiguration::prefetch_distance ahead along it are parsed in the background.
+  /// An empty route disables prefetching.
+  void SetRoute(std::vector<maliput::math::Vector3> route);
+
+  /// Builds the RoadNetwork of the window around `position`, in the inertial frame, when it covers other tiles
+  /// than the last built one. Meant to be called as the position moves.
+  /// @return The new RoadNetwork, or nullptr when the last built one still covers `position`.
+  std::unique_ptr<maliput::api::RoadNetwork> Update(const maliput::math::Vector3& position);
+
+  /// Builds the RoadNetwork of the window around `position`, in the inertial frame.
+  /// @return A maliput_geopackage RoadNetwork.
+  std::unique_ptr<maliput::api::RoadNetwork> Build(const maliput::math::Vector3& position);
+
+  /// @returns The counters so far.
+  StreamingStats stats() const;
+
+ private:
+  // @returns `position` moved from the inertial frame into the backend frame tiles are laid out in.
+  maliput::math::Vector3 ToBackendFrame(const maliput::math::Vector3& position) const;
+
+  maliput_sparse::loader::BuilderConfiguration sparse_config_;
+  // Mapping of the "gpkg_fd" file descriptor, when set.
+  std::unique_ptr<geopackage::MappedFile> gpkg_mapping_;
+  std::unique_ptr<geopackage::WindowLoader> window_loader_;
+  int64_t builds_{0};
+};
+
+}  // namespace builder
+}  // namespace maliput_geopackage
@@ -0,0 +1,87 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+/// Wall-clock duration of a loading phase.
+struct PhaseDuration {
+  /// Phase name, in snake_case.
+  std::string name;
+  /// Duration in seconds.
+  double seconds{0.};
+};
+
+/// Measurements taken while a GeoPackageParser loads a GeoPackage.
+struct ParserStats {
+  /// Phases in the order they ran.
+  std::vector<PhaseDuration> phases;
+
+  /// Whether the data came from a snapshot rather than from the GeoPackage, see
+  /// ParserConfiguration::use_snapshot_cache. Row, point and byte counts are zero in that case.
+  bool loaded_from_snapshot{false};
+
+  /// Rows read from the junctions table.
+  int64_t junction_rows{0};
+  /// Rows read from the segments table.
+  int64_t segment_rows{0};
+  /// Rows read from the lanes table.
+  int64_t lane_rows{0};
+  /// Rows read from the branch_point_lanes table.
+  int64_t branch_point_lane_rows{0};
+  /// Rows read from the adjacent_lanes table.
+  int64_t adjacent_lane_rows{0};
+  /// Rows read from the optional boundaries table.
+  int64_t boundary_rows{0};
+  /// Boundary points decoded, over both boundaries of every lane.
+  int64_t points_decoded{0};
+  /// Boundary points handed over, over both boundaries of every lane. Lower than `points_decoded` when boundaries
+  /// are simplified, see ParserConfiguration::boundary_simplification, and equal to it otherwise.
+  int64_t points_kept{0};
+  /// Bytes of boundary geometry read from SQLite, as WKT text or binary blobs. Shared boundaries count once.
+  int64_t geometry_bytes_read{0};
+
+  /// Parsed junctions.
+  int64_t junctions{0};
+  /// Parsed segments.
+  int64_t segments{0};
+  /// Parsed lanes.
+  int64_t lanes{0};
+  /// Parsed connections.
+  int64_t connections{0};
+};
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
@@ -0,0 +1,72 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/builder/async_build.h"
+
+#include <chrono>
+
+namespace maliput_geopackage {
+namespace builder {
+
+AsyncBuild::~AsyncBuild() {
+  if (result_.valid()) {
+    Cancel();
+    result_.wait();
+  }
+}
+
+void AsyncBuild::Cancel() {
+  if (cancelled_) {
+    cancelled_->store(true);
+  }
+}
+
+bool AsyncBuild::IsReady() const {
+  return !result_.valid() || result_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+void AsyncBuild::Wait() const {
+  if (result_.valid()) {
+    result_.wait();
+  }
+}
+
+std::unique_ptr<maliput::api::RoadNetwork> AsyncBuild::Get(LoadStats* load_stats) {
+  if (!result_.valid()) {
+    throw std::runtime_error("AsyncBuild::Get() can only be called once.");
+  }
+  Result result = result_.get();
+  if (load_stats != nullptr) {
+    *load_stats = std::move(result.load_stats);
+  }
+  return std::move(result.road_network);
+}
+
+}  // namespace builder
+}  // namespace maliput_geopackage
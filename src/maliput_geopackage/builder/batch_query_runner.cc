@@ -0,0 +1,148 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/builder/batch_query_runner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "maliput_geopackage/geopackage/work_stealing_pool.h"
+
+namespace maliput_geopackage {
+namespace builder {
+namespace {
+
+// Queries each thread takes at a time. Large enough to amortize taking them, small enough to balance the load.
+constexpr size_t kChunkSize{256};
+
+// Spreads the bits of `value` to the even bits of the result.
+uint64_t SpreadBits(uint32_t value) {
+  uint64_t bits = value;
+  bits = (bits | (bits << 16)) & 0x0000ffff0000ffffull;
+  bits = (bits | (bits << 8)) & 0x00ff00ff00ff00ffull;
+  bits = (bits | (bits << 4)) & 0x0f0f0f0f0f0f0f0full;
+  bits = (bits | (bits << 2)) & 0x3333333333333333ull;
+  bits = (bits | (bits << 1)) & 0x5555555555555555ull;
+  return bits;
+}
+
+}  // namespace
+
+BatchQueryRunner::BatchQueryRunner(const RoadPositionIndex* index, int num_threads)
+    : index_(index),
+      pool_(std::make_unique<geopackage::WorkStealingPool>(
+          num_threads == 0 ? static_cast<int>(std::thread::hardware_concurrency()) : num_threads)),
+      scratches_(pool_->num_threads()) {}
+
+BatchQueryRunner::~BatchQueryRunner() = default;
+
+int BatchQueryRunner::num_threads() const { return pool_->num_threads(); }
+
+int64_t BatchQueryRunner::num_scratch_allocations() const {
+  int64_t num_allocations{0};
+  for (const RoadPositionIndex::Scratch& scratch : scratches_) {
+    num_allocations += scratch.num_allocations();
+  }
+  return num_allocations;
+}
+
+void BatchQueryRunner::ToRoadPosition(const maliput::api::InertialPosition* inertial_positions, size_t count,
+                                      maliput::api::RoadPositionResult* results) {
+  if (count == 0) return;
+  if (index_->num_lanes() == 0) {
+    throw std::runtime_error("Cannot find road positions in a RoadGeometry without lanes.");
+  }
+  for (size_t i = 0; i < count; ++i) {
+    const maliput::math::Vector3& xyz = inertial_positions[i].xyz();
+    if (!std::isfinite(xyz.x()) || !std::isfinite(xyz.y()) || !std::isfinite(xyz.z())) {
+      throw std::runtime_error("Inertial position " + std::to_string(i) + " is not finite.");
+    }
+  }
+  // Z-order keys of the positions quantized over the horizontal extent of the batch.
+  double min_x = std::numeric_limits<double>::infinity();
+  double min_y = min_x;
+  double max_x = -min_x;
+  double max_y = -min_x;
+  for (size_t i = 0; i < count; ++i) {
+    min_x = std::min(min_x, inertial_positions[i].x());
+    min_y = std::min(min_y, inertial_positions[i].y());
+    max_x = std::max(max_x, inertial_positions[i].x());
+    max_y = std::max(max_y, inertial_positions[i].y());
+  }
+  constexpr double kCells{4294967295.};
+  const double scale_x = max_x > min_x ? kCells / (max_x - min_x) : 0.;
+  const double scale_y = max_y > min_y ? kCells / (max_y - min_y) : 0.;
+  keys_.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    const auto cell_x = static_cast<uint32_t>(std::min((inertial_positions[i].x() - min_x) * scale_x, kCells));
+    const auto cell_y = static_cast<uint32_t>(std::min((inertial_positions[i].y() - min_y) * scale_y, kCells));
+    keys_[i] = SpreadBits(cell_x) | (SpreadBits(cell_y) << 1);
+  }
+  order_.resize(count);
+  std::iota(order_.begin(), order_.end(), size_t{0});
+  std::sort(order_.begin(), order_.end(), [this](size_t a, size_t b) { return keys_[a] < keys_[b]; });
+
+  pool_->Run(count, kChunkSize, [&](int thread, size_t begin, size_t end) {
+    RoadPositionIndex::Scratch* scratch = &scratches_[thread];
+    for (size_t i = begin; i < end; ++i) {
+      results[order_[i]] = index_->ToRoadPosition(inertial_positions[order_[i]], scratch);
+    }
+  });
+}
+
+void BatchQueryRunner::ToInertialPosition(const LanePositionQuery* queries, size_t count,
+                                          maliput::api::InertialPosition* results) {
+  for (size_t i = 0; i < count; ++i) {
+    if (queries[i].lane == nullptr) {
+      throw std::runtime_error("Lane position query " + std::to_string(i) + " has no lane.");
+    }
+  }
+  order_.resize(count);
+  std::iota(order_.begin(), order_.end(), size_t{0});
+  std::sort(order_.begin(), order_.end(), [queries](size_t a, size_t b) {
+    return queries[a].lane != queries[b].lane ? std::less<>()(queries[a].lane, queries[b].lane)
+                                              : queries[a].lane_position.s() < queries[b].lane_position.s();
+  });
+
+  pool_->Run(count, kChunkSize, [&](int, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      const LanePositionQuery& query = queries[order_[i]];
+      results[order_[i]] = query.lane->ToInertialPosition(query.lane_position);
+    }
+  });
+}
+
+}  // namespace builder
+}  // namespace maliput_geopackage
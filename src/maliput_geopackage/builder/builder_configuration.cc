@@ -29,10 +29,175 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_geopackage/builder/builder_configuration.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 #include "maliput_geopackage/builder/params.h"
 
 namespace maliput_geopackage {
 namespace builder {
+namespace {
+
+// Parses `value` as a non-negative integer for the configuration key `key`.
+int ParseNonNegativeInt(const std::string& key, const std::string& value) {
+  size_t parsed_chars{0};
+  int result{-1};
+  try {
+    result = std::stoi(value, &parsed_chars);
+  } catch (const std::exception&) {
+  }
+  if (result < 0 || parsed_chars != value.size()) {
+    throw std::runtime_error("Invalid value for '" + key + "': '" + value + "', expected a non-negative integer.");
+  }
+  return result;
+}
+
+// Parses `value` as a non-negative 64-bit integer for the configuration key `key`.
+int64_t ParseNonNegativeInt64(const std::string& key, const std::string& value) {
+  size_t parsed_chars{0};
+  long long result{-1};
+  try {
+    result = std::stoll(value, &parsed_chars);
+  } catch (const std::exception&) {
+  }
+  if (result < 0 || parsed_chars != value.size()) {
+    throw std::runtime_error("Invalid value for '" + key + "': '" + value + "', expected a non-negative integer.");
+  }
+  return static_cast<int64_t>(result);
+}
+
+// Parses `value` as "true" or "false" for the configuration key `key`.
+bool ParseBool(const std::string& key, const std::string& value) {
+  if (value == "true") {
+    return true;
+  } else if (value == "false") {
+    return false;
+  }
+  throw std::runtime_error("Invalid value for '" + key + "': '" + value + "', expected 'true' or 'false'.");
+}
+
+// Parses a "{min_x, min_y, max_x, max_y}" region. An empty string means no region.
+std::optional<geopackage::Region2d> ParseRegion(const std::string& value) {
+  if (value.find_first_not_of(" \t") == std::string::npos) {
+    return std::nullopt;
+  }
+  std::string content = value;
+  content.erase(std::remove_if(content.begin(), content.end(), [](char c) { return c == '{' || c == '}'; }),
+                content.end());
+  std::vector<double> coordinates;
+  std::istringstream iss(content);
+  std::string coordinate;
+  while (std::getline(iss, coordinate, ',')) {
+    try {
+      size_t parsed_chars{0};
+      coordinates.push_back(std::stod(coordinate, &parsed_chars));
+      if (coordinate.find_first_not_of(" \t", parsed_chars) != std::string::npos) {
+        coordinates.clear();
+        break;
+      }
+    } catch (const std::exception&) {
+      coordinates.clear();
+      break;
+    }
+  }
+  if (coordinates.size() != 4 || coordinates[0] > coordinates[2] || coordinates[1] > coordinates[3]) {
+    throw std::runtime_error("Invalid value for '" + std::string(params::kLoadRegion) + "': '" + value +
+                             "', expected {min_x, min_y, max_x, max_y}.");
+  }
+  return geopackage::Region2d{coordinates[0], coordinates[1], coordinates[2], coordinates[3]};
+}
+
+// Serializes `region` in the format ParseRegion() reads.
+std::string RegionToString(const std::optional<geopackage::Region2d>& region) {
+  if (!region.has_value()) {
+    return "";
+  }
+  std::ostringstream oss;
+  oss.precision(17);
+  oss << "{" << region->min_x << ", " << region->min_y << ", " << region->max_x << ", " << region->max_y << "}";
+  return oss.str();
+}
+
+// @returns `region` moved by the x and y coordinates of `translation`.
+std::optional<geopackage::Region2d> TranslateRegion(const std::optional<geopackage::Region2d>& region,
+                                                    const maliput::math::Vector3& translation) {
+  if (!region.has_value()) {
+    return std::nullopt;
+  }
+  return geopackage::Region2d{region->min_x + translation.x(), region->min_y + translation.y(),
+                              region->max_x + translation.x(), region->max_y + translation.y()};
+}
+
+// Parses a comma-separated list of IDs, trimming the blanks around each. An empty string is an empty list.
+std::vector<std::string> ParseIdList(const std::string& value) {
+  std::vector<std::string> ids;
+  std::istringstream iss(value);
+  std::string id;
+  while (std::getline(iss, id, ',')) {
+    const size_t first = id.find_first_not_of(" \t");
+    if (first != std::string::npos) {
+      ids.push_back(id.substr(first, id.find_last_not_of(" \t") - first + 1));
+    }
+  }
+  return ids;
+}
+
+// Serializes `ids` in the format ParseIdList() reads.
+std::string IdListToString(const std::vector<std::string>& ids) {
+  std::string value;
+  for (const std::string& id : ids) {
+    value += (value.empty() ? "" : ", ") + id;
+  }
+  return value;
+}
+
+// Parses a boundary policy name.
+geopackage::BoundaryPolicy ParseBoundaryPolicy(const std::string& value) {
+  if (value == "truncate") {
+    return geopackage::BoundaryPolicy::kTruncate;
+  } else if (value == "closure") {
+    return geopackage::BoundaryPolicy::kClosure;
+  }
+  throw std::runtime_error("Invalid value for '" + std::string(params::kBoundaryPolicy) + "': '" + value +
+                           "', expected 'truncate' or 'closure'.");
+}
+
+// Serializes `policy` in the format ParseBoundaryPolicy() reads.
+std::string BoundaryPolicyToString(geopackage::BoundaryPolicy policy) {
+  return policy == geopackage::BoundaryPolicy::kClosure ? "closure" : "truncate";
+}
+
+// Parses a boundary simplification name.
+geopackage::BoundarySimplification ParseBoundarySimplification(const std::string& value) {
+  if (value == "none") {
+    return geopackage::BoundarySimplification::kNone;
+  } else if (value == "simplify") {
+    return geopackage::BoundarySimplification::kSimplify;
+  } else if (value == "match") {
+    return geopackage::BoundarySimplification::kSimplifyAndMatch;
+  }
+  throw std::runtime_error("Invalid value for '" + std::string(params::kSimplifyBoundaries) + "': '" + value +
+                           "', expected 'none', 'simplify' or 'match'.");
+}
+
+// Serializes `simplification` in the format ParseBoundarySimplification() reads.
+std::string BoundarySimplificationToString(geopackage::BoundarySimplification simplification) {
+  switch (simplification) {
+    case geopackage::BoundarySimplification::kSimplify:
+      return "simplify";
+    case geopackage::BoundarySimplification::kSimplifyAndMatch:
+      return "match";
+    default:
+      return "none";
+  }
+}
+
+}  // namespace
 
 BuilderConfiguration BuilderConfiguration::FromMap(const std::map<std::string, std::string>& config) {
   BuilderConfiguration builder_config;
@@ -43,12 +208,126 @@ BuilderConfiguration BuilderConfiguration::FromMap(const std::map<std::string, s
     builder_config.gpkg_file = it->second;
   }
 
+  it = config.find(params::kGpkgFd);
+  if (it != config.end() && !it->second.empty()) {
+    builder_config.gpkg_fd = ParseNonNegativeInt(params::kGpkgFd, it->second);
+  }
+
+  it = config.find(params::kParserThreads);
+  if (it != config.end()) {
+    builder_config.parser_config.parser_threads = ParseNonNegativeInt(params::kParserThreads, it->second);
+  }
+
+  it = config.find(params::kLoadRegion);
+  if (it != config.end()) {
+    // The region is given in the inertial frame, the parser compares it with backend frame coordinates.
+    builder_config.parser_config.load_region =
+        TranslateRegion(ParseRegion(it->second), builder_config.sparse_config.inertial_to_backend_frame_translation);
+  }
+
+  it = config.find(params::kLoadJunctions);
+  if (it != config.end()) {
+    builder_config.parser_config.junction_ids = ParseIdList(it->second);
+  }
+
+  it = config.find(params::kLoadLaneTypes);
+  if (it != config.end()) {
+    builder_config.parser_config.lane_types = ParseIdList(it->second);
+  }
+
+  it = config.find(params::kExpansionHops);
+  if (it != config.end()) {
+    builder_config.parser_config.expansion_hops = ParseNonNegativeInt(params::kExpansionHops, it->second);
+  }
+
+  it = config.find(params::kBoundaryPolicy);
+  if (it != config.end()) {
+    builder_config.parser_config.boundary_policy = ParseBoundaryPolicy(it->second);
+  }
+
+  it = config.find(params::kBuildSpatialIndex);
+  if (it != config.end()) {
+    builder_config.parser_config.build_spatial_index = ParseBool(params::kBuildSpatialIndex, it->second);
+  }
+
+  it = config.find(params::kSnapshotCache);
+  if (it != config.end()) {
+    builder_config.parser_config.use_snapshot_cache = ParseBool(params::kSnapshotCache, it->second);
+  }
+
+  it = config.find(params::kSnapshotCacheDir);
+  if (it != config.end()) {
+    builder_config.parser_config.snapshot_cache_dir = it->second;
+  }
+
+  it = config.find(params::kSqliteImmutable);
+  if (it != config.end()) {
+    builder_config.parser_config.sqlite_immutable = ParseBool(params::kSqliteImmutable, it->second);
+  }
+
+  it = config.find(params::kSqliteMmapSize);
+  if (it != config.end()) {
+    builder_config.parser_config.sqlite_mmap_size = ParseNonNegativeInt64(params::kSqliteMmapSize, it->second);
+  }
+
+  it = config.find(params::kSqliteCacheSize);
+  if (it != config.end()) {
+    builder_config.parser_config.sqlite_cache_size_kib = ParseNonNegativeInt64(params::kSqliteCacheSize, it->second);
+  }
+
+  it = config.find(params::kReadAhead);
+  if (it != config.end()) {
+    builder_config.parser_config.read_ahead = ParseBool(params::kReadAhead, it->second);
+  }
+
+  it = config.find(params::kSimplifyBoundaries);
+  if (it != config.end()) {
+    builder_config.parser_config.boundary_simplification = ParseBoundarySimplification(it->second);
+  }
+  // Simplification is bounded by the tolerance the RoadGeometry is built with.
+  builder_config.parser_config.simplification_tolerance = builder_config.sparse_config.linear_tolerance;
+
+  it = config.find(params::kSharedCache);
+  if (it != config.end()) {
+    builder_config.shared_cache = ParseBool(params::kSharedCache, it->second);
+  }
+
+  it = config.find(params::kSharedCacheCapacity);
+  if (it != config.end()) {
+    builder_config.shared_cache_capacity = ParseNonNegativeInt(params::kSharedCacheCapacity, it->second);
+  }
+
+  it = config.find(params::kLoadStatsFile);
+  if (it != config.end()) {
+    builder_config.load_stats_file = it->second;
+  }
+
   return builder_config;
 }
 
 std::map<std::string, std::string> BuilderConfiguration::ToStringMap() const {
   std::map<std::string, std::string> config = sparse_config.ToStringMap();
   config.emplace(params::kGpkgFile, gpkg_file);
+  config.emplace(params::kGpkgFd, gpkg_fd >= 0 ? std::to_string(gpkg_fd) : "");
+  config.emplace(params::kParserThreads, std::to_string(parser_config.parser_threads));
+  config.emplace(params::kLoadRegion,
+                 RegionToString(TranslateRegion(parser_config.load_region,
+                                                -1. * sparse_config.inertial_to_backend_frame_translation)));
+  config.emplace(params::kLoadJunctions, IdListToString(parser_config.junction_ids));
+  config.emplace(params::kLoadLaneTypes, IdListToString(parser_config.lane_types));
+  config.emplace(params::kExpansionHops, std::to_string(parser_config.expansion_hops));
+  config.emplace(params::kBoundaryPolicy, BoundaryPolicyToString(parser_config.boundary_policy));
+  config.emplace(params::kBuildSpatialIndex, parser_config.build_spatial_index ? "true" : "false");
+  config.emplace(params::kSnapshotCache, parser_config.use_snapshot_cache ? "true" : "false");
+  config.emplace(params::kSnapshotCacheDir, parser_config.snapshot_cache_dir);
+  config.emplace(params::kSqliteImmutable, parser_config.sqlite_immutable ? "true" : "false");
+  config.emplace(params::kSqliteMmapSize, std::to_string(parser_config.sqlite_mmap_size));
+  config.emplace(params::kSqliteCacheSize, std::to_string(parser_config.sqlite_cache_size_kib));
+  config.emplace(params::kReadAhead, parser_config.read_ahead ? "true" : "false");
+  config.emplace(params::kSimplifyBoundaries, BoundarySimplificationToString(parser_config.boundary_simplification));
+  config.emplace(params::kSharedCache, shared_cache ? "true" : "false");
+  config.emplace(params::kSharedCacheCapacity, std::to_string(shared_cache_capacity));
+  config.emplace(params::kLoadStatsFile, load_stats_file);
   return config;
 }
 
@@ -33,6 +33,8 @@
 #include <maliput/math/vector.h>
 #include <maliput_sparse/loader/builder_configuration.h>
 
+#include "maliput_geopackage/geopackage/parser_configuration.h"
+
 namespace maliput_geopackage {
 namespace builder {
 
@@ -52,6 +54,21 @@ struct BuilderConfiguration {
 
   /// Path to the GeoPackage file.
   std::string gpkg_file{""};
+
+  /// File descriptor of the GeoPackage to load instead of `gpkg_file`, or -1 to load `gpkg_file`.
+  int gpkg_fd{-1};
+
+  /// Configuration for the GeoPackage parser.
+  geopackage::ParserConfiguration parser_config;
+
+  /// Whether to share the parsed GeoPackage across the loads of the process, see params::kSharedCache.
+  bool shared_cache{false};
+
+  /// Number of parsed GeoPackages kept when `shared_cache` is set, or 0 for no limit.
+  int shared_cache_capacity{4};
+
+  /// Path of the JSON file LoadStats are written to. Empty to disable it.
+  std::string load_stats_file{""};
 };
 
 }  // namespace builder
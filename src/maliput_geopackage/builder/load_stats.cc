@@ -0,0 +1,100 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/builder/load_stats.h"
+
+#include <cstdio>
+#include <sstream>
+
+namespace maliput_geopackage {
+namespace builder {
+namespace {
+
+// Quotes and escapes `value` as a JSON string.
+std::string JsonString(const std::string& value) {
+  std::string result{"\""};
+  for (const char c : value) {
+    switch (c) {
+      case '"':
+        result += "\\\"";
+        break;
+      case '\\':
+        result += "\\\\";
+        break;
+      case '\n':
+        result += "\\n";
+        break;
+      case '\t':
+        result += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char escaped[7];
+          std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+          result += escaped;
+        } else {
+          result += c;
+        }
+    }
+  }
+  return result + "\"";
+}
+
+}  // namespace
+
+std::string LoadStats::ToJson() const {
+  std::ostringstream json;
+  json.precision(9);
+  json << "{\n";
+  json << "  \"gpkg_file\": " << JsonString(gpkg_file) << ",\n";
+  json << "  \"total_seconds\": " << total_seconds << ",\n";
+  json << "  \"phases\": [";
+  for (size_t i = 0; i < phases.size(); ++i) {
+    json << (i == 0 ? "\n" : ",\n") << "    {\"name\": " << JsonString(phases[i].name)
+         << ", \"seconds\": " << phases[i].seconds << "}";
+  }
+  json << (phases.empty() ? "],\n" : "\n  ],\n");
+  json << "  \"loaded_from_snapshot\": " << (parser.loaded_from_snapshot ? "true" : "false") << ",\n";
+  json << "  \"loaded_from_shared_cache\": " << (loaded_from_shared_cache ? "true" : "false") << ",\n";
+  json << "  \"rows\": {\"junctions\": " << parser.junction_rows << ", \"segments\": " << parser.segment_rows
+       << ", \"lanes\": " << parser.lane_rows << ", \"branch_point_lanes\": " << parser.branch_point_lane_rows
+       << ", \"adjacent_lanes\": " << parser.adjacent_lane_rows << ", \"boundaries\": " << parser.boundary_rows
+       << "},\n";
+  json << "  \"points_decoded\": " << parser.points_decoded << ",\n";
+  json << "  \"points_kept\": " << parser.points_kept << ",\n";
+  json << "  \"geometry_bytes_read\": " << parser.geometry_bytes_read << ",\n";
+  json << "  \"road_network\": {\"junctions\": " << parser.junctions << ", \"segments\": " << parser.segments
+       << ", \"lanes\": " << parser.lanes << ", \"connections\": " << parser.connections << "},\n";
+  json << "  \"process_peak_rss_bytes\": " << process_peak_rss_bytes << "\n";
+  json << "}\n";
+  return json.str();
+}
+
+}  // namespace builder
+}  // namespace maliput_geopackage
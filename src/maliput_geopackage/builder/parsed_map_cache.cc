@@ -0,0 +1,102 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/builder/parsed_map_cache.h"
+
+#include <exception>
+#include <utility>
+
+namespace maliput_geopackage {
+namespace builder {
+
+ParsedMapCache& ParsedMapCache::Instance() {
+  static ParsedMapCache cache;
+  return cache;
+}
+
+std::shared_ptr<const geopackage::GeoPackageParser> ParsedMapCache::Get(const std::string& key, size_t capacity,
+                                                                         const Parse& parse, bool* parsed) {
+  std::promise<std::shared_ptr<const geopackage::GeoPackageParser>> promise;
+  std::shared_future<std::shared_ptr<const geopackage::GeoPackageParser>> future;
+  bool parse_here{false};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      it = entries_.emplace(key, Entry{promise.get_future().share()}).first;
+      parse_here = true;
+    }
+    it->second.last_use = ++clock_;
+    future = it->second.parser;
+  }
+  if (parsed != nullptr) *parsed = parse_here;
+  if (!parse_here) return future.get();
+
+  try {
+    promise.set_value(parse());
+  } catch (...) {
+    {
+      // Later calls parse again rather than getting this error.
+      std::lock_guard<std::mutex> lock(mutex_);
+      entries_.erase(key);
+    }
+    promise.set_exception(std::current_exception());
+    throw;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.at(key).ready = true;
+  if (capacity > 0) Evict(capacity);
+  return future.get();
+}
+
+void ParsedMapCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Evict(0);
+}
+
+size_t ParsedMapCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+void ParsedMapCache::Evict(size_t capacity) {
+  while (entries_.size() > capacity) {
+    auto oldest = entries_.end();
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if (it->second.ready && (oldest == entries_.end() || it->second.last_use < oldest->second.last_use)) {
+        oldest = it;
+      }
+    }
+    if (oldest == entries_.end()) return;
+    entries_.erase(oldest);
+  }
+}
+
+}  // namespace builder
+}  // namespace maliput_geopackage
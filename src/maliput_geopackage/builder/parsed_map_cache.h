@@ -0,0 +1,99 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <maliput/common/maliput_copyable.h>
+
+#include "maliput_geopackage/geopackage/geopackage_parser.h"
+
+namespace maliput_geopackage {
+namespace builder {
+
+/// Process-wide cache of parsed GeoPackages, shared by the loads enabling params::kSharedCache.
+///
+/// Parsers are kept by key, see RoadNetworkBuilder, and handed out as shared immutable objects: every RoadNetwork
+/// built from one copies what it needs out of it. Concurrent requests for a key being parsed wait for that parse
+/// instead of starting their own. Once there are more entries than the requested capacity, the least recently
+/// used ones that are not being parsed are evicted.
+class ParsedMapCache {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(ParsedMapCache);
+
+  using Parse = std::function<std::unique_ptr<geopackage::GeoPackageParser>()>;
+
+  ParsedMapCache() = default;
+
+  /// @returns The cache shared by the whole process.
+  static ParsedMapCache& Instance();
+
+  /// Gets the parser cached under `key`, parsing it on a miss.
+  /// @param key Identifies the GeoPackage and the parsing parameters.
+  /// @param capacity Number of entries kept once this call is done, or 0 for no limit.
+  /// @param parse Parses the GeoPackage. It is called without holding the cache lock.
+  /// @param parsed When not nullptr, set to whether this call ran `parse`.
+  /// @returns The cached parser.
+  /// @throws The exception raised by `parse`, in every call waiting for it. The failed entry is dropped, so a
+  ///         later call parses again.
+  std::shared_ptr<const geopackage::GeoPackageParser> Get(const std::string& key, size_t capacity,
+                                                          const Parse& parse, bool* parsed = nullptr);
+
+  /// Drops every entry that is not being parsed.
+  void Clear();
+
+  /// @returns The number of entries, including those being parsed.
+  size_t size() const;
+
+ private:
+  struct Entry {
+    std::shared_future<std::shared_ptr<const geopackage::GeoPackageParser>> parser;
+    // Value of `clock_` when the entry was last requested.
+    uint64_t last_use{0};
+    bool ready{false};
+  };
+
+  // Evicts the least recently used ready entries until at most `capacity` remain. `mutex_` must be held.
+  void Evict(size_t capacity);
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, Entry> entries_;
+  uint64_t clock_{0};
+};
+
+}  // namespace builder
+}  // namespace maliput_geopackage
@@ -29,27 +29,258 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "maliput_geopackage/builder/road_network_builder.h"
 
+#include <sys/resource.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <future>
 #include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include <maliput/api/road_network.h>
 #include <maliput/common/logger.h>
 #include <maliput_sparse/loader/road_network_loader.h>
 
 #include "maliput_geopackage/builder/builder_configuration.h"
+#include "maliput_geopackage/builder/parsed_map_cache.h"
+#include "maliput_geopackage/builder/params.h"
 #include "maliput_geopackage/geopackage/geopackage_parser.h"
+#include "maliput_geopackage/geopackage/mapped_file.h"
 
 namespace maliput_geopackage {
 namespace builder {
+namespace {
+
+// @returns The peak resident set size of the process in bytes, or 0 when unavailable.
+int64_t ProcessPeakResidentSetBytes() {
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+  // Linux reports kilobytes.
+  return static_cast<int64_t>(usage.ru_maxrss) * 1024;
+}
+
+// Copies the parser measurements into `load_stats`, appending its phases when `with_phases` is set.
+void CopyParserStats(const geopackage::ParserStats& parser_stats, bool with_phases, LoadStats* load_stats) {
+  if (with_phases) {
+    load_stats->phases.insert(load_stats->phases.end(), parser_stats.phases.begin(), parser_stats.phases.end());
+  }
+  load_stats->parser = parser_stats;
+}
+
+// @returns The extent of both boundaries of every lane parsed by `parser`, by lane ID. The boundaries are in the
+// backend frame, the boxes in the inertial frame: they are shifted back by `inertial_to_backend_frame_translation`.
+std::unordered_map<std::string, LaneBox> ComputeLaneBoxes(
+    const maliput_sparse::parser::Parser& parser, const maliput::math::Vector3& inertial_to_backend_frame_translation) {
+  std::unordered_map<std::string, LaneBox> lane_boxes;
+  for (const auto& [junction_id, junction] : parser.GetJunctions()) {
+    for (const auto& [segment_id, segment] : junction.segments) {
+      for (const auto& lane : segment.lanes) {
+        LaneBox box{lane.left.first(), lane.left.first()};
+        for (const auto* boundary : {&lane.left, &lane.right}) {
+          for (const auto& point : *boundary) {
+            box.min = maliput::math::Vector3(std::min(box.min.x(), point.x()), std::min(box.min.y(), point.y()),
+                                             std::min(box.min.z(), point.z()));
+            box.max = maliput::math::Vector3(std::max(box.max.x(), point.x()), std::max(box.max.y(), point.y()),
+                                             std::max(box.max.z(), point.z()));
+          }
+        }
+        lane_boxes.emplace(lane.id, LaneBox{box.min - inertial_to_backend_frame_translation,
+                                            box.max - inertial_to_backend_frame_translation});
+      }
+    }
+  }
+  return lane_boxes;
+}
+
+// Hands a parser shared through the ParsedMapCache to the RoadNetwork loader, which takes ownership of its parser.
+class SharedParser : public maliput_sparse::parser::Parser {
+ public:
+  explicit SharedParser(std::shared_ptr<const geopackage::GeoPackageParser> parser) : parser_(std::move(parser)) {}
+
+ private:
+  const std::unordered_map<maliput_sparse::parser::Junction::Id, maliput_sparse::parser::Junction>& DoGetJunctions()
+      const override {
+    return parser_->GetJunctions();
+  }
+
+  const std::vector<maliput_sparse::parser::Connection>& DoGetConnections() const override {
+    return parser_->GetConnections();
+  }
+
+  const std::shared_ptr<const geopackage::GeoPackageParser> parser_;
+};
+
+// @returns The ParsedMapCache key of the GeoPackage `builder_config` loads: the identity of the file and the
+// configuration keys that may change the parsed data. std::nullopt when the file cannot be identified, in which
+// case loading it reports the error.
+std::optional<std::string> SharedCacheKey(const BuilderConfiguration& builder_config) {
+  struct stat file_stat;
+  const int result = builder_config.gpkg_fd >= 0 ? ::fstat(builder_config.gpkg_fd, &file_stat)
+                                                 : ::stat(builder_config.gpkg_file.c_str(), &file_stat);
+  if (result != 0) {
+    return std::nullopt;
+  }
+  std::string key = "file=" + std::to_string(file_stat.st_dev) + ":" + std::to_string(file_stat.st_ino) + ":" +
+                    std::to_string(file_stat.st_size) + ":" + std::to_string(file_stat.st_mtim.tv_sec) + "." +
+                    std::to_string(file_stat.st_mtim.tv_nsec) + "\n";
+  for (const auto& [name, value] : builder_config.ToStringMap()) {
+    if (name == params::kGpkgFile || name == params::kGpkgFd || name == params::kParserThreads ||
+        name == params::kLoadStatsFile || name == params::kSharedCacheCapacity) {
+      continue;
+    }
+    key += name + "=" + value + "\n";
+  }
+  return key;
+}
+
+}  // namespace
+
+void RoadNetworkBuilder::ClearSharedCache() { ParsedMapCache::Instance().Clear(); }
 
 std::unique_ptr<maliput::api::RoadNetwork> RoadNetworkBuilder::operator()() const {
+  return Build(nullptr, nullptr, nullptr, nullptr);
+}
+
+std::unique_ptr<maliput::api::RoadNetwork> RoadNetworkBuilder::operator()(LoadStats* load_stats) const {
+  return Build(load_stats, nullptr, nullptr, nullptr);
+}
+
+IndexedRoadNetwork RoadNetworkBuilder::BuildIndexed(LoadStats* load_stats) const {
+  IndexedRoadNetwork indexed_road_network;
+  indexed_road_network.road_network = Build(load_stats, &indexed_road_network.road_position_index, nullptr, nullptr);
+  return indexed_road_network;
+}
+
+AsyncBuild RoadNetworkBuilder::BuildAsync(ProgressCallback on_progress) const {
+  auto cancelled = std::make_shared<std::atomic<bool>>(false);
+  std::future<AsyncBuild::Result> result =
+      std::async(std::launch::async, [builder_config = builder_config_, gpkg_data = gpkg_data_,
+                                      gpkg_size = gpkg_size_, on_progress = std::move(on_progress), cancelled]() {
+        AsyncBuild::Result result;
+        result.road_network = RoadNetworkBuilder(builder_config, gpkg_data, gpkg_size)
+                                  .Build(&result.load_stats, nullptr, on_progress, cancelled);
+        return result;
+      });
+  return AsyncBuild(std::move(cancelled), std::move(result));
+}
+
+std::unique_ptr<maliput::api::RoadNetwork> RoadNetworkBuilder::Build(
+    LoadStats* load_stats, std::unique_ptr<RoadPositionIndex>* road_position_index,
+    const ProgressCallback& on_progress, const std::shared_ptr<const std::atomic<bool>>& cancelled) const {
+  const auto start = std::chrono::steady_clock::now();
   const BuilderConfiguration builder_config{BuilderConfiguration::FromMap(builder_config_)};
 
-  maliput::log()->info("Loading GeoPackage from file: ", builder_config.gpkg_file, " ...");
+  int64_t rows_read{0};
+  // Reports the start of `phase`, unless the build was cancelled.
+  const auto start_phase = [&](const char* phase) {
+    if (cancelled && cancelled->load()) {
+      throw BuildCancelled();
+    }
+    if (on_progress) {
+      on_progress(BuildProgress{phase, rows_read});
+    }
+  };
 
-  std::unique_ptr<maliput_sparse::parser::Parser> gpkg_parser =
-      std::make_unique<geopackage::GeoPackageParser>(builder_config.gpkg_file);
+  // Loads sharing a parse through the ParsedMapCache must not see each other's callback or cancellation.
+  const bool shared = builder_config.shared_cache && gpkg_data_ == nullptr;
+  geopackage::ParserConfiguration parser_config = builder_config.parser_config;
+  if (!shared) {
+    if (on_progress) {
+      parser_config.on_progress = [&](const geopackage::ParseProgress& progress) {
+        rows_read = progress.rows;
+        on_progress(BuildProgress{progress.phase, progress.rows});
+      };
+    }
+    parser_config.cancelled = cancelled;
+  }
 
+  const auto parse = [&]() -> std::unique_ptr<geopackage::GeoPackageParser> {
+    try {
+      if (gpkg_data_ != nullptr) {
+        maliput::log()->info("Loading GeoPackage from memory (", gpkg_size_, " bytes) ...");
+        return std::make_unique<geopackage::GeoPackageParser>(static_cast<const uint8_t*>(gpkg_data_), gpkg_size_,
+                                                              parser_config);
+      } else if (builder_config.gpkg_fd >= 0) {
+        maliput::log()->info("Loading GeoPackage from file descriptor: ", builder_config.gpkg_fd, " ...");
+        // The mapping is only needed while parsing.
+        const geopackage::MappedFile mapping(builder_config.gpkg_fd);
+        return std::make_unique<geopackage::GeoPackageParser>(mapping.data(), mapping.size(), parser_config);
+      }
+      maliput::log()->info("Loading GeoPackage from file: ", builder_config.gpkg_file, " ...");
+      return std::make_unique<geopackage::GeoPackageParser>(builder_config.gpkg_file, parser_config);
+    } catch (const geopackage::ParseCancelled&) {
+      maliput::log()->info("GeoPackage loading was cancelled.");
+      throw BuildCancelled();
+    }
+  };
+
+  LoadStats stats;
+  if (gpkg_data_ == nullptr && builder_config.gpkg_fd < 0) {
+    stats.gpkg_file = builder_config.gpkg_file;
+  }
+  std::unique_ptr<maliput_sparse::parser::Parser> parser;
+  const std::optional<std::string> shared_cache_key = shared ? SharedCacheKey(builder_config) : std::nullopt;
+  if (shared_cache_key.has_value()) {
+    start_phase("shared_cache");
+    bool parsed{false};
+    std::shared_ptr<const geopackage::GeoPackageParser> gpkg_parser = ParsedMapCache::Instance().Get(
+        shared_cache_key.value(), static_cast<size_t>(builder_config.shared_cache_capacity), parse, &parsed);
+    CopyParserStats(gpkg_parser->stats(), parsed, &stats);
+    if (!parsed) {
+      maliput::log()->info("Using the GeoPackage parsed by an earlier load.");
+      stats.loaded_from_shared_cache = true;
+      stats.phases.push_back(
+          {"shared_cache", std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()});
+    }
+    parser = std::make_unique<SharedParser>(std::move(gpkg_parser));
+  } else {
+    std::unique_ptr<geopackage::GeoPackageParser> gpkg_parser = parse();
+    CopyParserStats(gpkg_parser->stats(), true, &stats);
+    parser = std::move(gpkg_parser);
+  }
+  // The parser is handed over to the loader, so the boundaries are measured first.
+  std::unordered_map<std::string, LaneBox> lane_boxes;
+  if (road_position_index != nullptr) {
+    lane_boxes = ComputeLaneBoxes(*parser, builder_config.sparse_config.inertial_to_backend_frame_translation);
+  }
+
+  start_phase("road_network_loader");
   maliput::log()->trace("Building RoadNetwork...");
-  return maliput_sparse::loader::RoadNetworkLoader(std::move(gpkg_parser), builder_config.sparse_config)();
+  const auto loader_start = std::chrono::steady_clock::now();
+  std::unique_ptr<maliput::api::RoadNetwork> road_network =
+      maliput_sparse::loader::RoadNetworkLoader(std::move(parser), builder_config.sparse_config)();
+  auto end = std::chrono::steady_clock::now();
+  stats.phases.push_back({"road_network_loader", std::chrono::duration<double>(end - loader_start).count()});
+  if (road_position_index != nullptr) {
+    start_phase("build_road_position_index");
+    const auto index_start = end;
+    *road_position_index = std::make_unique<RoadPositionIndex>(road_network->road_geometry(), lane_boxes);
+    end = std::chrono::steady_clock::now();
+    stats.phases.push_back({"build_road_position_index", std::chrono::duration<double>(end - index_start).count()});
+  }
+  stats.total_seconds = std::chrono::duration<double>(end - start).count();
+  stats.process_peak_rss_bytes = ProcessPeakResidentSetBytes();
+
+  if (!builder_config.load_stats_file.empty()) {
+    std::ofstream file(builder_config.load_stats_file, std::ios::trunc);
+    file << stats.ToJson();
+    if (!file) {
+      maliput::log()->warn("Failed to write load stats to '", builder_config.load_stats_file, "'.");
+    }
+  }
+  if (load_stats != nullptr) {
+    *load_stats = std::move(stats);
+  }
+  return road_network;
 }
 
 }  // namespace builder
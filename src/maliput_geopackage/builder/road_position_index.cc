@@ -0,0 +1,212 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/builder/road_position_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include <maliput/api/branch_point.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/segment.h>
+
+#include "maliput_geopackage/geopackage/lane_rtree.h"
+
+namespace maliput_geopackage {
+namespace builder {
+struct RoadPositionIndex::Scratch::Buffers {
+  std::vector<geopackage::LaneRTree::QueueEntry> queue;
+  // Evaluated lanes, by lane index.
+  std::vector<std::pair<uint32_t, maliput::api::RoadPositionResult>> candidates;
+  // Distances of `candidates`, sorted.
+  std::vector<double> distances;
+};
+
+RoadPositionIndex::Scratch::Scratch() : buffers_(std::make_unique<Buffers>()) {}
+
+RoadPositionIndex::Scratch::Scratch(const Scratch&) : Scratch() {}
+
+RoadPositionIndex::Scratch& RoadPositionIndex::Scratch::operator=(const Scratch&) { return *this; }
+
+RoadPositionIndex::Scratch::Scratch(Scratch&&) noexcept = default;
+
+RoadPositionIndex::Scratch& RoadPositionIndex::Scratch::operator=(Scratch&&) noexcept = default;
+
+RoadPositionIndex::Scratch::~Scratch() = default;
+
+RoadPositionIndex::RoadPositionIndex(const maliput::api::RoadGeometry* road_geometry,
+                                     const std::unordered_map<std::string, LaneBox>& lane_boxes)
+    : road_geometry_(road_geometry) {
+  const double linear_tolerance = road_geometry_->linear_tolerance();
+  std::vector<geopackage::LaneExtent> extents;
+  for (int i = 0; i < road_geometry_->num_junctions(); ++i) {
+    const maliput::api::Junction* junction = road_geometry_->junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      const maliput::api::Segment* segment = junction->segment(j);
+      for (int k = 0; k < segment->num_lanes(); ++k) {
+        const maliput::api::Lane* lane = segment->lane(k);
+        const auto box = lane_boxes.find(lane->id().string());
+        if (box == lane_boxes.end()) {
+          throw std::runtime_error("No bounding box for lane " + lane->id().string() + ".");
+        }
+        // Positions off the lane surface within its elevation bounds reach as far as those bounds in any
+        // direction, the surface normal not being vertical on slopes.
+        double elevation_reach{0.};
+        for (const double s : {0., lane->length()}) {
+          const maliput::api::HBounds elevation_bounds = lane->elevation_bounds(s, 0.);
+          elevation_reach = std::max({elevation_reach, std::abs(elevation_bounds.min()), elevation_bounds.max()});
+        }
+        const double padding = linear_tolerance + elevation_reach;
+        const LaneBox& lane_box = box->second;
+        extents.push_back({lane_box.min.x() - padding, lane_box.max.x() + padding, lane_box.min.y() - padding,
+                           lane_box.max.y() + padding, lane_box.min.z() - padding, lane_box.max.z() + padding});
+        lane_indices_.emplace(lane, static_cast<int>(lanes_.size()));
+        lanes_.push_back(lane);
+      }
+    }
+  }
+  tree_ = std::make_unique<geopackage::LaneRTree>(std::move(extents));
+
+  connected_lanes_.resize(lanes_.size());
+  for (size_t i = 0; i < lanes_.size(); ++i) {
+    std::vector<int>& connected = connected_lanes_[i];
+    connected.push_back(static_cast<int>(i));
+    const auto add = [&](const maliput::api::Lane* lane) {
+      const auto it = lane_indices_.find(lane);
+      if (it != lane_indices_.end()) connected.push_back(it->second);
+    };
+    add(lanes_[i]->to_left());
+    add(lanes_[i]->to_right());
+    for (const auto which : {maliput::api::LaneEnd::kStart, maliput::api::LaneEnd::kFinish}) {
+      const maliput::api::LaneEndSet* ongoing = lanes_[i]->GetOngoingBranches(which);
+      for (int j = 0; ongoing != nullptr && j < ongoing->size(); ++j) {
+        add(ongoing->get(j).lane);
+      }
+    }
+    std::sort(connected.begin(), connected.end());
+    connected.erase(std::unique(connected.begin(), connected.end()), connected.end());
+  }
+}
+
+RoadPositionIndex::~RoadPositionIndex() = default;
+
+maliput::api::RoadPositionResult RoadPositionIndex::Evaluate(
+    int lane_index, const maliput::api::InertialPosition& inertial_position) const {
+  const maliput::api::Lane* lane = lanes_[lane_index];
+  const maliput::api::LanePositionResult result = lane->ToLanePosition(inertial_position);
+  return {maliput::api::RoadPosition(lane, result.lane_position), result.nearest_position, result.distance};
+}
+
+maliput::api::RoadPositionResult RoadPositionIndex::ToRoadPosition(
+    const maliput::api::InertialPosition& inertial_position) const {
+  Scratch scratch;
+  return ToRoadPosition(inertial_position, &scratch);
+}
+
+maliput::api::RoadPositionResult RoadPositionIndex::ToRoadPosition(
+    const maliput::api::InertialPosition& inertial_position, Scratch* scratch) const {
+  if (lanes_.empty()) {
+    throw std::runtime_error("Cannot find road positions in a RoadGeometry without lanes.");
+  }
+  // RoadGeometry folds every lane, in order, with IsNewRoadPositionResultCloser(). That rule only looks past the
+  // distances, at the lane bounds, when they are within one linear tolerance: a lane more than one tolerance
+  // nearer than the current result always replaces it, and a lane more than one tolerance farther never does.
+  // Hence, when the lanes up to some `threshold` distance are more than one tolerance nearer than every other
+  // lane, folding only them gives the same result: the first of them replaces whatever farther lanes come before
+  // it, and no farther lane replaces them afterwards. Lanes are visited by increasing box distance, a lower bound
+  // of their distance, until such a gap follows the run of distances starting at the nearest one.
+  const double linear_tolerance = road_geometry_->linear_tolerance();
+  double threshold = std::numeric_limits<double>::infinity();
+  std::vector<geopackage::LaneRTree::QueueEntry>& queue = scratch->buffers_->queue;
+  std::vector<std::pair<uint32_t, maliput::api::RoadPositionResult>>& candidates = scratch->buffers_->candidates;
+  std::vector<double>& distances = scratch->buffers_->distances;
+  const size_t queue_capacity = queue.capacity();
+  const size_t candidates_capacity = candidates.capacity();
+  const size_t distances_capacity = distances.capacity();
+  candidates.clear();
+  distances.clear();
+  tree_->VisitByDistance(
+      inertial_position.xyz(),
+      [&](uint32_t lane_index, double distance) {
+        if (distance > threshold + linear_tolerance) return false;
+        candidates.emplace_back(lane_index, Evaluate(lane_index, inertial_position));
+        const double lane_distance = candidates.back().second.distance;
+        distances.insert(std::upper_bound(distances.begin(), distances.end(), lane_distance), lane_distance);
+        threshold = distances.front();
+        for (size_t i = 1; i < distances.size() && distances[i] <= threshold + linear_tolerance; ++i) {
+          threshold = distances[i];
+        }
+        return true;
+      },
+      &queue);
+  if (queue.capacity() != queue_capacity || candidates.capacity() != candidates_capacity ||
+      distances.capacity() != distances_capacity) {
+    ++scratch->num_allocations_;
+  }
+  candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                  [threshold](const auto& candidate) { return candidate.second.distance > threshold; }),
+                   candidates.end());
+  std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+  maliput::api::RoadPositionResult result = candidates.front().second;
+  for (const auto& [lane_index, candidate] : candidates) {
+    if (maliput::api::IsNewRoadPositionResultCloser(candidate, result)) {
+      result = candidate;
+    }
+  }
+  return result;
+}
+
+std::vector<maliput::api::RoadPositionResult> RoadPositionIndex::FindRoadPositions(
+    const maliput::api::InertialPosition& inertial_position, double radius) const {
+  std::vector<std::pair<uint32_t, maliput::api::RoadPositionResult>> candidates;
+  tree_->VisitByDistance(inertial_position.xyz(), [&](uint32_t lane_index, double distance) {
+    if (distance > radius) return false;
+    maliput::api::RoadPositionResult result = Evaluate(lane_index, inertial_position);
+    if (result.distance <= radius) {
+      candidates.emplace_back(lane_index, std::move(result));
+    }
+    return true;
+  });
+  std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+  std::vector<maliput::api::RoadPositionResult> results;
+  results.reserve(candidates.size());
+  for (auto& candidate : candidates) {
+    results.push_back(std::move(candidate.second));
+  }
+  return results;
+}
+
+}  // namespace builder
+}  // namespace maliput_geopackage
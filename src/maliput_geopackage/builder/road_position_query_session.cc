@@ -0,0 +1,66 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/builder/road_position_query_session.h"
+
+#include <utility>
+
+namespace maliput_geopackage {
+namespace builder {
+
+RoadPositionQuerySession::RoadPositionQuerySession(const RoadPositionIndex* index) : index_(index) {}
+
+maliput::api::RoadPositionResult RoadPositionQuerySession::ToRoadPosition(
+    const maliput::api::InertialPosition& inertial_position) {
+  ++stats_.queries;
+  if (hint_ >= 0) {
+    // Connected lanes are sorted in RoadGeometry order, so ties between them resolve as RoadGeometry would.
+    int nearest{-1};
+    maliput::api::RoadPositionResult result;
+    for (const int lane_index : index_->connected_lanes_[hint_]) {
+      maliput::api::RoadPositionResult candidate = index_->Evaluate(lane_index, inertial_position);
+      if (nearest < 0 || maliput::api::IsNewRoadPositionResultCloser(candidate, result)) {
+        nearest = lane_index;
+        result = std::move(candidate);
+      }
+    }
+    if (result.distance <= index_->road_geometry_->linear_tolerance()) {
+      ++(nearest == hint_ ? stats_.hinted_lane_hits : stats_.connected_lane_hits);
+      hint_ = nearest;
+      return result;
+    }
+  }
+  ++stats_.fallbacks;
+  maliput::api::RoadPositionResult result = index_->ToRoadPosition(inertial_position, &scratch_);
+  hint_ = index_->lane_indices_.at(result.road_position.lane);
+  return result;
+}
+
+}  // namespace builder
+}  // namespace maliput_geopackage
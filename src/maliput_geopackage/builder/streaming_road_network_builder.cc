@@ -0,0 +1,112 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/builder/streaming_road_network_builder.h"
+
+#include <utility>
+
+#include <maliput/common/logger.h>
+#include <maliput_sparse/loader/road_network_loader.h>
+
+#include "maliput_geopackage/builder/builder_configuration.h"
+#include "maliput_geopackage/geopackage/geopackage_parser.h"
+#include "maliput_geopackage/geopackage/mapped_file.h"
+#include "maliput_geopackage/geopackage/window_loader.h"
+
+namespace maliput_geopackage {
+namespace builder {
+
+StreamingRoadNetworkBuilder::StreamingRoadNetworkBuilder(const std::map<std::string, std::string>& builder_config,
+                                                         const StreamingConfiguration& streaming_config) {
+  const BuilderConfiguration config{BuilderConfiguration::FromMap(builder_config)};
+  sparse_config_ = config.sparse_config;
+
+  geopackage::WindowLoader::ParserFactory parser_factory;
+  if (config.gpkg_fd >= 0) {
+    maliput::log()->info("Streaming GeoPackage from file descriptor: ", config.gpkg_fd, " ...");
+    gpkg_mapping_ = std::make_unique<geopackage::MappedFile>(config.gpkg_fd);
+    parser_factory = [mapping = gpkg_mapping_.get()](const geopackage::ParserConfiguration& parser_config) {
+      return std::make_unique<geopackage::GeoPackageParser>(mapping->data(), mapping->size(), parser_config);
+    };
+  } else {
+    maliput::log()->info("Streaming GeoPackage from file: ", config.gpkg_file, " ...");
+    parser_factory = [gpkg_file = config.gpkg_file](const geopackage::ParserConfiguration& parser_config) {
+      return std::make_unique<geopackage::GeoPackageParser>(gpkg_file, parser_config);
+    };
+  }
+
+  geopackage::WindowConfiguration window_config;
+  window_config.radius = streaming_config.radius;
+  window_config.tile_size = streaming_config.tile_size;
+  window_config.memory_budget_bytes = streaming_config.memory_budget_bytes;
+  window_config.prefetch_distance = streaming_config.prefetch_distance;
+  window_loader_ =
+      std::make_unique<geopackage::WindowLoader>(std::move(parser_factory), config.parser_config, window_config);
+}
+
+// Out of line, where geopackage::MappedFile and geopackage::WindowLoader are complete.
+StreamingRoadNetworkBuilder::~StreamingRoadNetworkBuilder() = default;
+
+maliput::math::Vector3 StreamingRoadNetworkBuilder::ToBackendFrame(const maliput::math::Vector3& position) const {
+  return position + sparse_config_.inertial_to_backend_frame_translation;
+}
+
+void StreamingRoadNetworkBuilder::SetRoute(std::vector<maliput::math::Vector3> route) {
+  for (maliput::math::Vector3& point : route) {
+    point = ToBackendFrame(point);
+  }
+  window_loader_->SetRoute(std::move(route));
+}
+
+std::unique_ptr<maliput::api::RoadNetwork> StreamingRoadNetworkBuilder::Update(const maliput::math::Vector3& position) {
+  const maliput::math::Vector3 backend_position = ToBackendFrame(position);
+  if (builds_ > 0 && window_loader_->IsCurrentWindow(backend_position)) {
+    window_loader_->Prefetch(backend_position);
+    return nullptr;
+  }
+  return Build(position);
+}
+
+std::unique_ptr<maliput::api::RoadNetwork> StreamingRoadNetworkBuilder::Build(const maliput::math::Vector3& position) {
+  maliput::log()->debug("Building the RoadNetwork around (", position.x(), ", ", position.y(), ")...");
+  std::unique_ptr<maliput::api::RoadNetwork> road_network =
+      maliput_sparse::loader::RoadNetworkLoader(window_loader_->Load(ToBackendFrame(position)), sparse_config_)();
+  ++builds_;
+  return road_network;
+}
+
+StreamingStats StreamingRoadNetworkBuilder::stats() const {
+  StreamingStats stats;
+  stats.window = window_loader_->stats();
+  stats.builds = builds_;
+  return stats;
+}
+
+}  // namespace builder
+}  // namespace maliput_geopackage
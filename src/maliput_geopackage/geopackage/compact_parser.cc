@@ -0,0 +1,213 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/geopackage/compact_parser.h"
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+namespace {
+
+constexpr uint8_t kCompactVersion{0};
+
+// Number of coordinates per point.
+constexpr size_t kDimensions{3};
+
+[[noreturn]] void ThrowMalformedCompact(const std::string& reason) {
+  throw std::runtime_error("Malformed compact geometry: " + reason);
+}
+
+// Returns true if the host stores multi-byte values little-endian.
+bool IsHostLittleEndian() {
+  const uint16_t probe{1};
+  uint8_t first_byte;
+  std::memcpy(&first_byte, &probe, 1);
+  return first_byte == 1;
+}
+
+uint32_t ReadUint32(const uint8_t* data) {
+  return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+         (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+double ReadDouble(const uint8_t* data) {
+  uint64_t bits{0};
+  for (int i = 7; i >= 0; --i) bits = (bits << 8) | data[i];
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// Copies `count` little-endian int32 values from `data` into `deltas`.
+void ReadInt32Deltas(const uint8_t* data, size_t count, int32_t* deltas) {
+  if (IsHostLittleEndian()) {
+    std::memcpy(deltas, data, count * sizeof(int32_t));
+    return;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    deltas[i] = static_cast<int32_t>(ReadUint32(data + i * sizeof(int32_t)));
+  }
+}
+
+// Decodes `count` zig-zag LEB128 varints from [data, last) into `deltas`.
+void ReadVarintDeltas(const uint8_t* data, const uint8_t* last, size_t count, int32_t* deltas) {
+  // A 32-bit value takes at most 5 groups of 7 bits.
+  constexpr int kMaxShift{28};
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t value{0};
+    for (int shift = 0;; shift += 7) {
+      if (data == last) {
+        ThrowMalformedCompact("truncated varint deltas, expected " + std::to_string(count));
+      }
+      const uint8_t byte = *data++;
+      if (shift == kMaxShift && (byte & 0xF0) != 0) {
+        ThrowMalformedCompact("varint delta overflows 32 bits");
+      }
+      value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) break;
+    }
+    deltas[i] = static_cast<int32_t>((value >> 1) ^ (~(value & 1) + 1));
+  }
+}
+
+// Appends the `n` points whose per-axis deltas are laid out one axis after the other in `deltas`.
+// Positions are accumulated modulo 2^32, so vectorized and scalar code agree for any input.
+void AppendPoints(const int32_t* deltas, size_t n, const double origin[kDimensions], double scale,
+                  std::vector<maliput::math::Vector3>* points) {
+  points->reserve(points->size() + n);
+  uint32_t position[kDimensions]{0, 0, 0};
+  size_t i{0};
+#if defined(__SSE2__)
+  // Four points per iteration: an in-register prefix sum per axis, carried over through the last lane.
+  __m128i carry[kDimensions]{_mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128()};
+#if defined(__AVX2__)
+  const __m256d scale4 = _mm256_set1_pd(scale);
+  const __m256d origin4[kDimensions]{_mm256_set1_pd(origin[0]), _mm256_set1_pd(origin[1]), _mm256_set1_pd(origin[2])};
+#else
+  const __m128d scale2 = _mm_set1_pd(scale);
+  const __m128d origin2[kDimensions]{_mm_set1_pd(origin[0]), _mm_set1_pd(origin[1]), _mm_set1_pd(origin[2])};
+#endif
+  for (; i + 4 <= n; i += 4) {
+    alignas(32) double block[kDimensions][4];
+    for (size_t axis = 0; axis < kDimensions; ++axis) {
+      __m128i q = _mm_loadu_si128(reinterpret_cast<const __m128i*>(deltas + axis * n + i));
+      q = _mm_add_epi32(q, _mm_slli_si128(q, 4));
+      q = _mm_add_epi32(q, _mm_slli_si128(q, 8));
+      q = _mm_add_epi32(q, carry[axis]);
+      carry[axis] = _mm_shuffle_epi32(q, 0xFF);
+#if defined(__AVX2__)
+      _mm256_store_pd(block[axis], _mm256_add_pd(origin4[axis], _mm256_mul_pd(_mm256_cvtepi32_pd(q), scale4)));
+#else
+      _mm_store_pd(block[axis], _mm_add_pd(origin2[axis], _mm_mul_pd(_mm_cvtepi32_pd(q), scale2)));
+      _mm_store_pd(block[axis] + 2,
+                   _mm_add_pd(origin2[axis], _mm_mul_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(q, q)), scale2)));
+#endif
+    }
+    for (size_t k = 0; k < 4; ++k) {
+      points->emplace_back(block[0][k], block[1][k], block[2][k]);
+    }
+  }
+  for (size_t axis = 0; axis < kDimensions; ++axis) {
+    position[axis] = static_cast<uint32_t>(_mm_cvtsi128_si32(carry[axis]));
+  }
+#endif
+  for (; i < n; ++i) {
+    double coordinates[kDimensions];
+    for (size_t axis = 0; axis < kDimensions; ++axis) {
+      position[axis] += static_cast<uint32_t>(deltas[axis * n + i]);
+      coordinates[axis] = origin[axis] + static_cast<double>(static_cast<int32_t>(position[axis])) * scale;
+    }
+    points->emplace_back(coordinates[0], coordinates[1], coordinates[2]);
+  }
+}
+
+}  // namespace
+
+bool IsCompactLineString(const uint8_t* data, size_t size) {
+  return size >= 2 && data[0] == 'M' && data[1] == 'Q';
+}
+
+void ParseCompactLineStringZ(const uint8_t* data, size_t size, std::vector<maliput::math::Vector3>* points) {
+  if (size < kCompactLineStringHeaderSize) {
+    ThrowMalformedCompact("truncated header (" + std::to_string(size) + " bytes)");
+  }
+  if (!IsCompactLineString(data, size)) {
+    ThrowMalformedCompact("missing 'MQ' magic");
+  }
+  if (data[2] != kCompactVersion) {
+    ThrowMalformedCompact("unsupported version " + std::to_string(data[2]));
+  }
+  const uint8_t flags = data[3];
+  if (flags & ~kCompactVarintFlag) {
+    ThrowMalformedCompact("reserved flag bits are set");
+  }
+  const uint32_t num_points = ReadUint32(data + 4);
+  if (num_points < 2) {
+    throw std::runtime_error("LINESTRING must have at least 2 points, got " + std::to_string(num_points));
+  }
+  const double origin[kDimensions]{ReadDouble(data + 8), ReadDouble(data + 16), ReadDouble(data + 24)};
+  const double scale = ReadDouble(data + 32);
+  if (!std::isfinite(origin[0]) || !std::isfinite(origin[1]) || !std::isfinite(origin[2])) {
+    ThrowMalformedCompact("origin is not finite");
+  }
+  if (!std::isfinite(scale) || scale <= 0.) {
+    ThrowMalformedCompact("scale must be positive and finite");
+  }
+
+  const uint8_t* body = data + kCompactLineStringHeaderSize;
+  const size_t body_size = size - kCompactLineStringHeaderSize;
+  const size_t num_deltas = kDimensions * num_points;
+  // Every delta takes at least one byte, which bounds the scratch buffer by the blob size.
+  const size_t min_delta_size = (flags & kCompactVarintFlag) ? 1 : sizeof(int32_t);
+  if (body_size / min_delta_size < num_deltas) {
+    ThrowMalformedCompact("truncated deltas, expected " + std::to_string(num_points) + " points");
+  }
+
+  // Reused across calls so repeated decoding on a thread does not allocate.
+  thread_local std::vector<int32_t> deltas;
+  deltas.resize(num_deltas);
+  if (flags & kCompactVarintFlag) {
+    ReadVarintDeltas(body, body + body_size, num_deltas, deltas.data());
+  } else {
+    ReadInt32Deltas(body, num_deltas, deltas.data());
+  }
+  AppendPoints(deltas.data(), num_points, origin, scale, points);
+}
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
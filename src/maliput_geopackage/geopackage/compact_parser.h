@@ -0,0 +1,80 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <maliput/math/vector.h>
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+/// Size in bytes of the compact LineString Z header: magic "MQ", version, flags, point count, origin and scale.
+constexpr size_t kCompactLineStringHeaderSize{40};
+
+/// Flag bit of the compact LineString Z header selecting zig-zag varint deltas instead of little-endian int32 ones.
+constexpr uint8_t kCompactVarintFlag{0x01};
+
+/// @returns True when `data` starts with the compact LineString Z magic "MQ".
+bool IsCompactLineString(const uint8_t* data, size_t size);
+
+/// Parses a compact LineString Z geometry and appends its 3D points to `points`.
+///
+/// The compact format quantizes every coordinate of a lane boundary to an integer multiple of a per-geometry
+/// scale, relative to a per-geometry origin, and stores the differences between consecutive points, in the
+/// spirit of TWKB. All values are little-endian:
+///
+/// | Offset | Size | Content |
+/// |--------|------|---------|
+/// | 0 | 2 | Magic "MQ" |
+/// | 2 | 1 | Version, 0 |
+/// | 3 | 1 | Flags: bit 0 set for varint deltas, other bits reserved |
+/// | 4 | 4 | Number of points `n`, uint32 |
+/// | 8 | 24 | Origin x, y, z, doubles |
+/// | 32 | 8 | Scale, a positive double |
+/// | 40 | | `n` x deltas, then `n` y deltas, then `n` z deltas |
+///
+/// Deltas are int32 values, or zig-zag encoded LEB128 varints when the varint flag is set. The first delta of an
+/// axis is relative to the origin and the quantized position of a point must fit an int32. Point `i` is
+/// `origin + scale * (delta[0] + ... + delta[i])` on every axis.
+///
+/// Accumulating and scaling the deltas is vectorized with SSE2, or AVX2 when the compiler targets it, and falls
+/// back to portable code elsewhere.
+///
+/// @param data Pointer to the first byte of the compact geometry.
+/// @param size Number of bytes available at `data`.
+/// @param points Output buffer the parsed points are appended to. It must not be nullptr.
+/// @throws std::runtime_error if the geometry is malformed or truncated.
+void ParseCompactLineStringZ(const uint8_t* data, size_t size, std::vector<maliput::math::Vector3>* points);
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
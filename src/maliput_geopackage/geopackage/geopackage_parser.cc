@@ -30,14 +30,27 @@
 #include "maliput_geopackage/geopackage/geopackage_parser.h"
 
 #include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
+#include <string_view>
+#include <thread>
 
 #include <maliput/common/logger.h>
 #include <maliput_sparse/geometry/line_string.h>
 #include <sqlite3.h>
 
-#include "maliput_geopackage/geopackage/wkt_parser.h"
+#include "maliput_geopackage/geopackage/id_table.h"
+#include "maliput_geopackage/geopackage/lane_decoder.h"
+#include "maliput_geopackage/geopackage/mapped_file.h"
+#include "maliput_geopackage/geopackage/polyline_simplifier.h"
+#include "maliput_geopackage/geopackage/snapshot.h"
+#include "maliput_geopackage/geopackage/spatial_index.h"
+#include "maliput_geopackage/geopackage/sqlite_helpers.h"
 
 namespace maliput_geopackage {
 namespace geopackage {
@@ -49,6 +62,93 @@ maliput_sparse::geometry::LineString3d ToLineString3d(const std::vector<maliput:
   return maliput_sparse::geometry::LineString3d(points);
 }
 
+/// Number of lane rows handed to a decoding worker at once.
+constexpr size_t kLaneBatchSize{64};
+
+/// Columns of the lanes query following the boundaries, see GeoPackageParser::ParseSegmentsAndLanes(). They are
+/// NULL when the file lacks them.
+constexpr int kLaneIndexColumn{6};
+constexpr int kLeftBoundaryIdColumn{7};
+constexpr int kRightBoundaryIdColumn{8};
+
+/// Position of a lane whose `lane_index` is NULL, see ParseState::lane_positions.
+constexpr int64_t kNoLanePosition{-1};
+
+/// Decodes the LINESTRINGZ stored at column `col` of the current row of `stmt` and appends its points to `points`.
+/// BLOB columns hold GeoPackage binary geometries (or bare WKB) and are decoded in place; any other
+/// column is read as WKT text.
+void ReadLineStringZColumn(sqlite3_stmt* stmt, int col, std::vector<maliput::math::Vector3>* points) {
+  const bool is_blob = sqlite3_column_type(stmt, col) == SQLITE_BLOB;
+  const void* data = is_blob ? sqlite3_column_blob(stmt, col) : sqlite3_column_text(stmt, col);
+  DecodeLineStringZ(static_cast<const uint8_t*>(data), static_cast<size_t>(sqlite3_column_bytes(stmt, col)), is_blob,
+                    points);
+}
+
+/// Copies the geometry stored at column `col` of the current row of `stmt`, leaving it undecoded.
+LaneDecodePool::RawGeometry CopyGeometryColumn(sqlite3_stmt* stmt, int col) {
+  const bool is_blob = sqlite3_column_type(stmt, col) == SQLITE_BLOB;
+  const void* data = is_blob ? sqlite3_column_blob(stmt, col) : sqlite3_column_text(stmt, col);
+  return {is_blob, std::string(static_cast<const char*>(data), static_cast<size_t>(sqlite3_column_bytes(stmt, col)))};
+}
+
+/// Converts `file_path` into a `file:` URI, percent-encoding every byte that is not an unreserved URI
+/// character or a path separator.
+std::string ToFileUri(const std::string& file_path) {
+  static constexpr char kHexDigits[] = "0123456789ABCDEF";
+  std::string uri = "file:";
+  for (const unsigned char c : file_path) {
+    if (std::isalnum(c) || c == '-' || c == '.' || c == '_' || c == '~' || c == '/') {
+      uri += static_cast<char>(c);
+    } else {
+      uri += '%';
+      uri += kHexDigits[c >> 4];
+      uri += kHexDigits[c & 0xF];
+    }
+  }
+  return uri;
+}
+
+/// Inserts every ID of `ids` into the one-column `table`.
+void InsertIds(sqlite3* db, const std::string& table, const std::vector<std::string>& ids) {
+  sqlite3_stmt* stmt;
+  const std::string sql = "INSERT OR IGNORE INTO " + table + " VALUES (?1)";
+  if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+    throw std::runtime_error("Failed to prepare '" + sql + "': " + std::string(sqlite3_errmsg(db)));
+  }
+  for (const std::string& id : ids) {
+    sqlite3_bind_text(stmt, 1, id.c_str(), static_cast<int>(id.size()), SQLITE_STATIC);
+    sqlite3_step(stmt);
+    sqlite3_reset(stmt);
+  }
+  sqlite3_finalize(stmt);
+}
+
+/// Fills the arc lengths of `centerline` from `arc_lengths`, which holds one little-endian double per vertex, or
+/// accumulates them along its vertices when `arc_lengths` is empty.
+/// @throws std::runtime_error if `arc_lengths` does not hold one value per vertex.
+void SetArcLengths(const std::string& lane_id, const std::string& arc_lengths, LaneCenterline* centerline) {
+  const size_t num_points = centerline->points.size();
+  centerline->arc_lengths.resize(num_points);
+  if (arc_lengths.empty()) {
+    double s{0.};
+    for (size_t i = 0; i < num_points; ++i) {
+      if (i > 0) s += (centerline->points[i] - centerline->points[i - 1]).norm();
+      centerline->arc_lengths[i] = s;
+    }
+    return;
+  }
+  if (arc_lengths.size() != num_points * sizeof(double)) {
+    throw std::runtime_error("Lane " + lane_id + " has " + std::to_string(arc_lengths.size()) +
+                             " bytes of centerline_s for " + std::to_string(num_points) + " centerline points.");
+  }
+  const auto* data = reinterpret_cast<const uint8_t*>(arc_lengths.data());
+  for (size_t i = 0; i < num_points; ++i) {
+    uint64_t bits{0};
+    for (int byte = 7; byte >= 0; --byte) bits = (bits << 8) | data[i * sizeof(double) + byte];
+    std::memcpy(&centerline->arc_lengths[i], &bits, sizeof(double));
+  }
+}
+
 /// Converts LaneEnd::Which from string
 maliput_sparse::parser::LaneEnd::Which LaneEndWhichFromString(const std::string& end_str) {
   if (end_str == "start") {
@@ -61,36 +161,286 @@ maliput_sparse::parser::LaneEnd::Which LaneEndWhichFromString(const std::string&
 
 }  // namespace
 
-GeoPackageParser::GeoPackageParser(const std::string& gpkg_file_path) {
-  maliput::log()->trace("Opening GeoPackage: ", gpkg_file_path);
-  OpenDatabase(gpkg_file_path);
+/// Parse-time bookkeeping. Junctions, segments and lanes are referred to by their interned indices and
+/// kept in vectors; string IDs are only materialized into `junctions_` once parsing completes, after
+/// which this state is dropped.
+struct GeoPackageParser::ParseState {
+  IdTable junction_ids;
+  IdTable segment_ids;
+  IdTable lane_ids;
+  /// Segments of every junction, by junction index.
+  std::vector<std::vector<uint32_t>> junction_segments;
+  /// Junction of every segment, by segment index. IdTable::kNone when the junction was not parsed.
+  std::vector<uint32_t> segment_junction;
+  /// Lanes of every segment in row order, by segment index.
+  std::vector<std::vector<uint32_t>> segment_lanes;
+  /// Whether lanes were read in `lanes.lane_index` order, so every segment whose lanes all have a position lists
+  /// them from right to left.
+  bool lanes_ordered{false};
+  /// `lanes.lane_index` of every lane, by lane index, or kNoLanePosition when NULL. Only filled when `lanes_ordered`.
+  std::vector<int64_t> lane_positions;
+  /// Whether lanes may reference rows of the boundaries table instead of storing their boundaries.
+  bool shared_boundaries{false};
+  /// Decoded rows of the boundaries table, by boundary index.
+  IdTable boundary_ids;
+  std::vector<maliput_sparse::geometry::LineString3d> boundaries;
+
+  /// @returns The index of the shared boundary whose ID is at column `col` of the current lane row of `stmt`, or
+  /// IdTable::kNone when the lane stores that boundary itself.
+  uint32_t SharedBoundaryIndex(sqlite3_stmt* stmt, int col) const {
+    const char* boundary_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, col));
+    if (boundary_id == nullptr) return IdTable::kNone;
+    const uint32_t boundary_index = boundary_ids.Find(boundary_id);
+    return boundary_index < boundaries.size() ? boundary_index : IdTable::kNone;
+  }
+  /// @returns The shared boundary whose ID is at column `col` of the current lane row of `stmt`, or nullptr
+  /// when the lane stores that boundary itself.
+  const maliput_sparse::geometry::LineString3d* SharedBoundary(sqlite3_stmt* stmt, int col) const {
+    const uint32_t boundary_index = SharedBoundaryIndex(stmt, col);
+    return boundary_index == IdTable::kNone ? nullptr : &boundaries[boundary_index];
+  }
+  /// Shared boundaries of every lane, by lane index, or IdTable::kNone for a boundary the lane stores itself.
+  std::vector<uint32_t> lane_left_boundaries;
+  std::vector<uint32_t> lane_right_boundaries;
+  /// Segment of every lane, by lane index.
+  std::vector<uint32_t> lane_segment;
+  /// Decoded lanes without their IDs, by lane index.
+  std::vector<maliput_sparse::parser::Lane> lanes;
+  /// Left and right neighbours of every lane, by lane index. IdTable::kNone when there is none.
+  std::vector<uint32_t> left_lanes;
+  std::vector<uint32_t> right_lanes;
+};
+
+template <typename Function>
+void GeoPackageParser::RunPhase(const char* name, Function&& phase) {
+  phase_ = name;
+  if (config_.cancelled && config_.cancelled->load(std::memory_order_relaxed)) {
+    throw ParseCancelled();
+  }
+  ReportProgress();
+  const auto start = std::chrono::steady_clock::now();
+  phase();
+  stats_.phases.push_back({name, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()});
+}
+
+void GeoPackageParser::CountRow() {
+  ++rows_read_;
+  if (config_.cancelled && config_.cancelled->load(std::memory_order_relaxed)) {
+    throw ParseCancelled();
+  }
+  if (rows_read_ % ParseProgress::kReportInterval == 0) {
+    ReportProgress();
+  }
+}
+
+void GeoPackageParser::ReportProgress() const {
+  if (config_.on_progress) {
+    config_.on_progress(ParseProgress{phase_, rows_read_});
+  }
+}
+
+GeoPackageParser::GeoPackageParser(const std::string& gpkg_file_path, const ParserConfiguration& config)
+    : config_(config) {
+  // The destructor does not run when a constructor throws, so the connection is released here.
+  try {
+    if (config_.build_spatial_index) {
+      RunPhase("build_spatial_index", [&]() { EnsureLaneSpatialIndex(gpkg_file_path); });
+    }
 
+    std::optional<SnapshotKey> snapshot_key;
+    std::string snapshot_path;
+    if (config_.use_snapshot_cache && config_.read_centerlines) {
+      maliput::log()->debug("The snapshot cache is not used when reading centerlines.");
+    } else if (config_.use_snapshot_cache) {
+      RunPhase("compute_snapshot_key", [&]() {
+        try {
+          snapshot_key = ComputeSnapshotKey(gpkg_file_path, config_);
+          snapshot_path = SnapshotPath(gpkg_file_path, config_.snapshot_cache_dir, snapshot_key.value());
+        } catch (const std::exception& e) {
+          // Opening the database below reports unreadable files.
+          maliput::log()->warn("Snapshot cache disabled for '", gpkg_file_path, "': ", e.what());
+        }
+      });
+      if (snapshot_key.has_value()) {
+        RunPhase("read_snapshot", [&]() {
+          if (config_.read_ahead) {
+            PrefetchFile(snapshot_path);
+          }
+          stats_.loaded_from_snapshot = ReadSnapshot(snapshot_path, snapshot_key.value(), &junctions_, &connections_);
+        });
+      }
+      if (stats_.loaded_from_snapshot) {
+        CountParsedEntities();
+        maliput::log()->info("Loaded snapshot '", snapshot_path, "'. Found ", junctions_.size(), " junctions and ",
+                             connections_.size(), " connections.");
+        return;
+      }
+    }
+
+    maliput::log()->trace("Opening GeoPackage: ", gpkg_file_path);
+    RunPhase("open_database", [&]() { OpenDatabase(gpkg_file_path); });
+    ParseDatabase();
+
+    if (snapshot_key.has_value()) {
+      RunPhase("write_snapshot", [&]() {
+        try {
+          WriteSnapshot(snapshot_path, snapshot_key.value(), junctions_, connections_);
+          maliput::log()->debug("Wrote snapshot '", snapshot_path, "'.");
+        } catch (const std::exception& e) {
+          maliput::log()->warn("Failed to write snapshot '", snapshot_path, "': ", e.what());
+        }
+      });
+    }
+  } catch (...) {
+    CloseDatabase();
+    throw;
+  }
+}
+
+GeoPackageParser::GeoPackageParser(const uint8_t* gpkg_data, size_t gpkg_size, const ParserConfiguration& config)
+    : config_(config) {
+  try {
+    // Both need a file: the index is written back to it and snapshots are keyed by its path.
+    if (config_.build_spatial_index) {
+      maliput::log()->warn("The lane spatial index is not built for GeoPackages loaded from memory.");
+    }
+    if (config_.use_snapshot_cache) {
+      maliput::log()->debug("The snapshot cache is not used for GeoPackages loaded from memory.");
+    }
+
+    maliput::log()->trace("Opening in-memory GeoPackage of ", gpkg_size, " bytes");
+    RunPhase("open_database", [&]() { OpenDatabase(gpkg_data, gpkg_size); });
+    ParseDatabase();
+  } catch (...) {
+    CloseDatabase();
+    throw;
+  }
+}
+
+GeoPackageParser::~GeoPackageParser() { CloseDatabase(); }
+
+void GeoPackageParser::ParseDatabase() {
   maliput::log()->trace("Parsing metadata...");
-  ParseMetadata();
+  RunPhase("parse_metadata", [&]() { ParseMetadata(); });
+
+  maliput::log()->trace("Selecting lanes...");
+  RunPhase("select_lanes", [&]() { SelectLanes(); });
+
+  {
+    ParseState state;
+    maliput::log()->trace("Parsing junctions...");
+    RunPhase("parse_junctions", [&]() { ParseJunctions(&state); });
+
+    maliput::log()->trace("Parsing segments and lanes...");
+    RunPhase("parse_segments_and_lanes", [&]() {
+      ParseBoundaries(&state);
+      ParseSegmentsAndLanes(&state);
+    });
+    if (config_.boundary_simplification != BoundarySimplification::kNone) {
+      maliput::log()->trace("Simplifying boundaries...");
+      RunPhase("simplify_boundaries", [&]() { SimplifyBoundaries(&state); });
+    } else {
+      stats_.points_kept = stats_.points_decoded;
+    }
+    if (config_.read_centerlines) {
+      maliput::log()->trace("Parsing centerlines...");
+      RunPhase("parse_centerlines", [&]() { ParseCenterlines(&state); });
+    }
 
-  maliput::log()->trace("Parsing junctions...");
-  ParseJunctions();
+    maliput::log()->trace("Parsing connections...");
+    ParseConnections(&state);
 
-  maliput::log()->trace("Parsing segments and lanes...");
-  ParseSegmentsAndLanes();
+    RunPhase("materialize_junctions", [&]() { MaterializeJunctions(&state); });
+  }
 
-  maliput::log()->trace("Parsing connections...");
-  ParseConnections();
+  // Everything is parsed, so the connection and its page cache can go. This also releases in-memory
+  // GeoPackages, whose bytes only need to outlive the constructor.
+  CloseDatabase();
 
+  CountParsedEntities();
   maliput::log()->info("GeoPackage parsing complete. Found ", junctions_.size(), " junctions and ", connections_.size(),
                        " connections.");
 }
 
-GeoPackageParser::~GeoPackageParser() { CloseDatabase(); }
-
 void GeoPackageParser::OpenDatabase(const std::string& gpkg_file_path) {
-  const int rc = sqlite3_open_v2(gpkg_file_path.c_str(), &db_, SQLITE_OPEN_READONLY, nullptr);
+  if (config_.read_ahead) {
+    PrefetchFile(gpkg_file_path);
+  }
+  // The connection is only used by this thread, so SQLite's own mutexes are not needed.
+  int flags = SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX;
+  std::string filename = gpkg_file_path;
+  if (config_.sqlite_immutable) {
+    flags |= SQLITE_OPEN_URI;
+    filename = ToFileUri(gpkg_file_path) + "?immutable=1";
+  }
+  const int rc = sqlite3_open_v2(filename.c_str(), &db_, flags, nullptr);
   if (rc != SQLITE_OK) {
     const std::string error_msg = sqlite3_errmsg(db_);
     sqlite3_close(db_);
     db_ = nullptr;
     throw std::runtime_error("Failed to open GeoPackage file '" + gpkg_file_path + "': " + error_msg);
   }
+  try {
+    // temp.selected_lanes never needs to reach the disk.
+    Execute(db_, "PRAGMA temp_store = MEMORY");
+    if (config_.sqlite_mmap_size > 0) {
+      Execute(db_, "PRAGMA mmap_size = " + std::to_string(config_.sqlite_mmap_size));
+    }
+    if (config_.sqlite_cache_size_kib > 0) {
+      // Negative values are read as KiB rather than pages.
+      Execute(db_, "PRAGMA cache_size = -" + std::to_string(config_.sqlite_cache_size_kib));
+    }
+  } catch (...) {
+    CloseDatabase();
+    throw;
+  }
+}
+
+void GeoPackageParser::OpenDatabase(const uint8_t* gpkg_data, size_t gpkg_size) {
+  const int rc = sqlite3_open_v2(":memory:", &db_, SQLITE_OPEN_READWRITE | SQLITE_OPEN_NOMUTEX, nullptr);
+  if (rc != SQLITE_OK) {
+    const std::string error_msg = sqlite3_errmsg(db_);
+    sqlite3_close(db_);
+    db_ = nullptr;
+    throw std::runtime_error("Failed to open in-memory GeoPackage: " + error_msg);
+  }
+  try {
+    // Without SQLITE_DESERIALIZE_FREEONCLOSE or SQLITE_DESERIALIZE_RESIZEABLE SQLite neither frees nor grows
+    // the buffer, and SQLITE_DESERIALIZE_READONLY keeps it from writing to it, so it is used in place.
+    if (sqlite3_deserialize(db_, "main", const_cast<unsigned char*>(gpkg_data), static_cast<sqlite3_int64>(gpkg_size),
+                            static_cast<sqlite3_int64>(gpkg_size), SQLITE_DESERIALIZE_READONLY) != SQLITE_OK) {
+      throw std::runtime_error(sqlite3_errmsg(db_));
+    }
+    Execute(db_, "PRAGMA temp_store = MEMORY");
+    // Pages are then read straight from the buffer instead of being copied into the page cache.
+    Execute(db_, "PRAGMA mmap_size = " + std::to_string(gpkg_size));
+    // Deserializing does not validate the bytes; fail here on anything that is not a database.
+    Execute(db_, "SELECT COUNT(*) FROM sqlite_master");
+  } catch (const std::exception& e) {
+    CloseDatabase();
+    throw std::runtime_error(std::string("Failed to open in-memory GeoPackage: ") + e.what());
+  }
+}
+
+void GeoPackageParser::EnsureLaneSpatialIndex(const std::string& gpkg_file_path) {
+  sqlite3* db{nullptr};
+  if (sqlite3_open_v2(gpkg_file_path.c_str(), &db, SQLITE_OPEN_READWRITE, nullptr) != SQLITE_OK) {
+    maliput::log()->warn("Cannot open '", gpkg_file_path, "' for writing, the lane spatial index is not built: ",
+                         sqlite3_errmsg(db));
+    sqlite3_close(db);
+    return;
+  }
+  if (!HasLaneSpatialIndex(db)) {
+    maliput::log()->info("Building the lane spatial index of '", gpkg_file_path, "'...");
+    try {
+      BuildLaneSpatialIndex(db);
+      maliput::log()->info("Indexed ", CountRows(db, kLaneSpatialIndexTable), " lanes.");
+    } catch (const std::exception& e) {
+      // Loading still works without the index, only slower.
+      maliput::log()->warn("Failed to build the lane spatial index: ", e.what());
+    }
+  }
+  sqlite3_close(db);
 }
 
 void GeoPackageParser::CloseDatabase() {
@@ -121,174 +471,639 @@ void GeoPackageParser::ParseMetadata() {
   sqlite3_finalize(stmt);
 }
 
-void GeoPackageParser::ParseJunctions() {
-  const char* sql = "SELECT junction_id, name FROM junctions";
+void GeoPackageParser::SelectLanes() {
+  const bool filters_junctions = !config_.junction_ids.empty();
+  const bool filters_lane_types = !config_.lane_types.empty();
+  if (!config_.load_region.has_value() && !filters_junctions && !filters_lane_types) {
+    return;
+  }
+
+  // The temp schema is writable even though the GeoPackage itself is opened read-only.
+  Execute(db_, "CREATE TEMP TABLE selected_lanes (lane_id TEXT PRIMARY KEY)");
+  has_lane_selection_ = true;
+  if (filters_junctions) {
+    Execute(db_, "CREATE TEMP TABLE selected_junctions (junction_id TEXT PRIMARY KEY)");
+    InsertIds(db_, "temp.selected_junctions", config_.junction_ids);
+  }
+  if (filters_lane_types) {
+    Execute(db_, "CREATE TEMP TABLE selected_lane_types (lane_type TEXT PRIMARY KEY)");
+    InsertIds(db_, "temp.selected_lane_types", config_.lane_types);
+  }
+
+  // Seed lanes. Only the ID and type columns are read, which precede the boundaries in the row, so no
+  // geometry is read for lanes left out.
+  const std::string lanes_of_selected_junctions =
+      "SELECT lanes.lane_id FROM lanes JOIN segments ON segments.segment_id = lanes.segment_id "
+      "WHERE segments.junction_id IN (SELECT junction_id FROM temp.selected_junctions)";
+  if (config_.load_region.has_value()) {
+    SelectLanesInRegion(config_.load_region.value());
+    if (filters_junctions) {
+      Execute(db_, "DELETE FROM temp.selected_lanes WHERE lane_id NOT IN (" + lanes_of_selected_junctions + ")");
+    }
+  } else if (filters_junctions) {
+    Execute(db_, "INSERT OR IGNORE INTO temp.selected_lanes (lane_id) " + lanes_of_selected_junctions);
+  } else {
+    Execute(db_, "INSERT OR IGNORE INTO temp.selected_lanes (lane_id) SELECT lane_id FROM lanes WHERE " +
+                     LaneTypeCondition("lane_type"));
+  }
+  if (filters_lane_types) {
+    Execute(db_,
+            "DELETE FROM temp.selected_lanes WHERE lane_id NOT IN (SELECT lane_id FROM lanes WHERE " +
+                LaneTypeCondition("lane_type") + ")");
+  }
+
+  if (config_.expansion_hops > 0) {
+    ExpandLaneSelection(config_.expansion_hops);
+  }
+  if (config_.boundary_policy == BoundaryPolicy::kClosure) {
+    ExpandLaneSelectionToClosure();
+  }
+  maliput::log()->info("Selected ", CountRows(db_, "temp.selected_lanes"), " lanes to load.");
+}
+
+void GeoPackageParser::SelectLanesInRegion(const Region2d& region) {
+  // Lane extents come, by order of preference, from the R*Tree index, the extent columns or the boundaries.
+  std::string sql;
+  if (HasLaneSpatialIndex(db_)) {
+    // R*Tree coordinates are 32-bit floats rounded outwards, so lanes lying within a few ULPs of the
+    // region border may be selected as well.
+    sql = std::string("SELECT lane_id FROM ") + kLaneSpatialIndexTable +
+          " WHERE min_x <= ?1 AND max_x >= ?2 AND min_y <= ?3 AND max_y >= ?4";
+  } else if (HasColumns(db_, "lanes", {"bbox_min_x", "bbox_max_x", "bbox_min_y", "bbox_max_y"})) {
+    sql =
+        "SELECT lane_id FROM lanes "
+        "WHERE bbox_min_x <= ?1 AND bbox_max_x >= ?2 AND bbox_min_y <= ?3 AND bbox_max_y >= ?4";
+  }
+
+  if (!sql.empty()) {
+    // Filter on the precomputed lane extents so no geometry is read.
+    sqlite3_stmt* stmt;
+    sql = "INSERT OR IGNORE INTO temp.selected_lanes (lane_id) " + sql;
+    if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+      throw std::runtime_error("Failed to query lane extents: " + std::string(sqlite3_errmsg(db_)));
+    }
+    sqlite3_bind_double(stmt, 1, region.max_x);
+    sqlite3_bind_double(stmt, 2, region.min_x);
+    sqlite3_bind_double(stmt, 3, region.max_y);
+    sqlite3_bind_double(stmt, 4, region.min_y);
+    const int rc = sqlite3_step(stmt);
+    sqlite3_finalize(stmt);
+    if (rc != SQLITE_DONE) {
+      throw std::runtime_error("Failed to select lanes in region: " + std::string(sqlite3_errmsg(db_)));
+    }
+    return;
+  }
+
+  // Without precomputed extents every boundary has to be decoded to find out whether it is in the region.
+  maliput::log()->warn("The GeoPackage has neither a ", kLaneSpatialIndexTable,
+                       " table nor lane extent columns; decoding every lane boundary to select the load region. "
+                       "Enable build_spatial_index to index the file once.");
+  sqlite3_stmt* insert_stmt;
+  if (sqlite3_prepare_v2(db_, "INSERT INTO temp.selected_lanes (lane_id) VALUES (?1)", -1, &insert_stmt, nullptr) !=
+      SQLITE_OK) {
+    throw std::runtime_error("Failed to prepare lane selection: " + std::string(sqlite3_errmsg(db_)));
+  }
+  try {
+    ForEachLaneExtent(db_, [insert_stmt, &region](const std::string& lane_id, const LaneExtent& extent) {
+      if (Intersects(extent, region)) {
+        sqlite3_bind_text(insert_stmt, 1, lane_id.c_str(), static_cast<int>(lane_id.size()), SQLITE_STATIC);
+        sqlite3_step(insert_stmt);
+        sqlite3_reset(insert_stmt);
+      }
+    });
+  } catch (...) {
+    sqlite3_finalize(insert_stmt);
+    throw;
+  }
+  sqlite3_finalize(insert_stmt);
+}
+
+void GeoPackageParser::ExpandLaneSelection(int hops) {
+  // Lanes are reached once per hop count at most, so the recursion stops after `hops` steps even on cycles.
+  Execute(db_,
+          "WITH RECURSIVE reached (lane_id, hops) AS ("
+          "  SELECT lane_id, 0 FROM temp.selected_lanes "
+          "  UNION "
+          "  SELECT other.lane_id, reached.hops + 1 FROM reached "
+          "  JOIN branch_point_lanes AS selected ON selected.lane_id = reached.lane_id "
+          "  JOIN branch_point_lanes AS other ON other.branch_point_id = selected.branch_point_id "
+          "  JOIN lanes ON lanes.lane_id = other.lane_id "
+          "  WHERE reached.hops < " +
+              std::to_string(hops) + " AND " + LaneTypeCondition("lanes.lane_type") +
+              ") "
+              "INSERT OR IGNORE INTO temp.selected_lanes (lane_id) SELECT DISTINCT lane_id FROM reached");
+}
+
+void GeoPackageParser::ExpandLaneSelectionToClosure() {
+  // Lanes meeting a selected lane at a branch point, so no selected lane loses a connection.
+  Execute(db_,
+          "INSERT OR IGNORE INTO temp.selected_lanes (lane_id) "
+          "SELECT DISTINCT other.lane_id FROM branch_point_lanes AS other "
+          "JOIN branch_point_lanes AS selected ON selected.branch_point_id = other.branch_point_id "
+          "JOIN lanes ON lanes.lane_id = other.lane_id "
+          "WHERE selected.lane_id IN (SELECT lane_id FROM temp.selected_lanes) AND " +
+              LaneTypeCondition("lanes.lane_type"));
+  // Complete the segments, so lane adjacency within them is kept.
+  Execute(db_,
+          "INSERT OR IGNORE INTO temp.selected_lanes (lane_id) "
+          "SELECT lane_id FROM lanes WHERE segment_id IN ("
+          "  SELECT segment_id FROM lanes WHERE lane_id IN (SELECT lane_id FROM temp.selected_lanes)) AND " +
+              LaneTypeCondition("lane_type"));
+}
+
+std::string GeoPackageParser::LaneSelectionCondition(const std::string& lane_id_column) const {
+  return has_lane_selection_ ? lane_id_column + " IN (SELECT lane_id FROM temp.selected_lanes)" : "1";
+}
+
+std::string GeoPackageParser::LaneTypeCondition(const std::string& lane_type_column) const {
+  return config_.lane_types.empty() ? "1"
+                                    : lane_type_column + " IN (SELECT lane_type FROM temp.selected_lane_types)";
+}
+
+void GeoPackageParser::ParseJunctions(ParseState* state) {
+  const std::string sql =
+      "SELECT junction_id, name FROM junctions "
+      "WHERE " +
+      (has_lane_selection_ ? "junction_id IN (SELECT segments.junction_id FROM segments "
+                             "JOIN lanes ON lanes.segment_id = segments.segment_id WHERE " +
+                                 LaneSelectionCondition("lanes.lane_id") + ")"
+                           : std::string("1"));
   sqlite3_stmt* stmt;
 
-  if (sqlite3_prepare_v2(db_, sql, -1, &stmt, nullptr) != SQLITE_OK) {
+  if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
     throw std::runtime_error("Failed to query junctions table: " + std::string(sqlite3_errmsg(db_)));
   }
 
-  while (sqlite3_step(stmt) == SQLITE_ROW) {
-    const char* junction_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
-    // const char* name = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
+  try {
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+      ++stats_.junction_rows;
+      CountRow();
+      const char* junction_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+      // const char* name = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
 
-    if (junction_id) {
-      maliput_sparse::parser::Junction junction;
-      junction.id = junction_id;
-      junctions_[junction.id] = junction;
-      maliput::log()->trace("Parsed junction: ", junction_id);
+      if (junction_id) {
+        if (state->junction_ids.Intern(junction_id) == state->junction_segments.size()) {
+          state->junction_segments.emplace_back();
+        }
+        maliput::log()->trace("Parsed junction: ", junction_id);
+      }
     }
+  } catch (...) {
+    sqlite3_finalize(stmt);
+    throw;
   }
 
   sqlite3_finalize(stmt);
 }
 
-void GeoPackageParser::ParseSegmentsAndLanes() {
-  // First, parse segments and associate them with junctions
-  const char* segment_sql = "SELECT segment_id, junction_id, name FROM segments";
+void GeoPackageParser::ParseBoundaries(ParseState* state) {
+  state->shared_boundaries =
+      HasTable(db_, "boundaries") && HasColumns(db_, "lanes", {"left_boundary_id", "right_boundary_id"});
+  if (!state->shared_boundaries) return;
+
+  // Only boundaries of the selected lanes are decoded.
+  const std::string sql =
+      "SELECT boundary_id, geometry FROM boundaries" +
+      (has_lane_selection_ ? " WHERE boundary_id IN (SELECT left_boundary_id FROM lanes WHERE " +
+                                 LaneSelectionCondition("lane_id") +
+                                 " UNION ALL SELECT right_boundary_id FROM lanes WHERE " +
+                                 LaneSelectionCondition("lane_id") + ")"
+                           : std::string());
   sqlite3_stmt* stmt;
+  if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+    throw std::runtime_error("Failed to query boundaries table: " + std::string(sqlite3_errmsg(db_)));
+  }
+
+  const int num_workers = config_.parser_threads == 0 ? static_cast<int>(std::thread::hardware_concurrency())
+                                                       : config_.parser_threads;
+  // Boundaries are interned in row order; a duplicated ID keeps its last row.
+  std::vector<uint32_t> row_boundaries;
+  std::vector<LaneDecodePool::RawGeometry> raw_boundaries;
+  std::vector<maliput::math::Vector3> points;
+  try {
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+      ++stats_.boundary_rows;
+      CountRow();
+      const char* boundary_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+      if (boundary_id == nullptr || sqlite3_column_type(stmt, 1) == SQLITE_NULL) continue;
+      stats_.geometry_bytes_read += sqlite3_column_bytes(stmt, 1);
+      const uint32_t boundary_index = state->boundary_ids.Intern(boundary_id);
+      if (num_workers > 1) {
+        row_boundaries.push_back(boundary_index);
+        raw_boundaries.push_back(CopyGeometryColumn(stmt, 1));
+        continue;
+      }
+      points.clear();
+      ReadLineStringZColumn(stmt, 1, &points);
+      if (boundary_index == state->boundaries.size()) {
+        state->boundaries.push_back(ToLineString3d(points));
+      } else {
+        state->boundaries[boundary_index] = ToLineString3d(points);
+      }
+    }
+  } catch (...) {
+    sqlite3_finalize(stmt);
+    throw;
+  }
+  sqlite3_finalize(stmt);
 
-  std::unordered_map<std::string, std::string> segment_to_junction;
+  if (num_workers > 1) {
+    std::vector<maliput_sparse::geometry::LineString3d> decoded = DecodeLineStrings(raw_boundaries, num_workers);
+    state->boundaries.reserve(state->boundary_ids.size());
+    for (size_t row = 0; row < decoded.size(); ++row) {
+      if (row_boundaries[row] == state->boundaries.size()) {
+        state->boundaries.push_back(std::move(decoded[row]));
+      } else {
+        state->boundaries[row_boundaries[row]] = std::move(decoded[row]);
+      }
+    }
+  }
+}
+
+void GeoPackageParser::ParseSegmentsAndLanes(ParseState* state) {
+  // First, parse segments and associate them with junctions
+  const std::string segment_sql =
+      "SELECT segment_id, junction_id, name FROM segments "
+      "WHERE " +
+      (has_lane_selection_
+           ? "segment_id IN (SELECT segment_id FROM lanes WHERE " + LaneSelectionCondition("lane_id") + ")"
+           : std::string("1"));
+  sqlite3_stmt* stmt;
 
-  if (sqlite3_prepare_v2(db_, segment_sql, -1, &stmt, nullptr) != SQLITE_OK) {
+  if (sqlite3_prepare_v2(db_, segment_sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
     throw std::runtime_error("Failed to query segments table: " + std::string(sqlite3_errmsg(db_)));
   }
 
-  while (sqlite3_step(stmt) == SQLITE_ROW) {
-    const char* segment_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
-    const char* junction_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
-
-    if (segment_id && junction_id) {
-      segment_to_junction[segment_id] = junction_id;
-
-      // Create segment in the corresponding junction
-      auto junction_it = junctions_.find(junction_id);
-      if (junction_it != junctions_.end()) {
-        maliput_sparse::parser::Segment segment;
-        segment.id = segment_id;
-        junction_it->second.segments[segment.id] = segment;
-        maliput::log()->trace("Parsed segment: ", segment_id, " in junction: ", junction_id);
+  try {
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+      ++stats_.segment_rows;
+      CountRow();
+      const char* segment_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+      const char* junction_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
+
+      if (segment_id && junction_id) {
+        const uint32_t segment_index = state->segment_ids.Intern(segment_id);
+        if (segment_index < state->segment_junction.size()) continue;  // Duplicate row.
+
+        // Lanes of segments whose junction was not parsed are dropped.
+        const uint32_t junction_index = state->junction_ids.Find(junction_id);
+        state->segment_junction.push_back(junction_index);
+        state->segment_lanes.emplace_back();
+        if (junction_index != IdTable::kNone) {
+          state->junction_segments[junction_index].push_back(segment_index);
+          maliput::log()->trace("Parsed segment: ", segment_id, " in junction: ", junction_id);
+        }
       }
     }
+  } catch (...) {
+    sqlite3_finalize(stmt);
+    throw;
   }
   sqlite3_finalize(stmt);
 
   // Now parse lanes with their geometries
-  // Note: We store geometry as WKT text for simplicity. In a production system,
-  // you might use SpatiaLite's AsText() function or parse WKB directly.
-  const char* lane_sql =
+  // Note: Boundaries are either WKT text or GeoPackage binary blobs, see ReadLineStringZColumn().
+  // With a lane_index column, as written by maliput_gpkg_optimize, lanes arrive ordered from right to left
+  // within each segment that has no NULL lane_index, see BuildLaneAdjacency().
+  // Lanes referencing the boundaries table carry their IDs, see ParseBoundaries().
+  state->lanes_ordered = HasColumns(db_, "lanes", {"lane_index"});
+  const std::string lane_sql =
       "SELECT lane_id, segment_id, lane_type, direction, "
-      "       left_boundary, right_boundary "
-      "FROM lanes";
-
-  if (sqlite3_prepare_v2(db_, lane_sql, -1, &stmt, nullptr) != SQLITE_OK) {
+      "       left_boundary, right_boundary, " +
+      std::string(state->lanes_ordered ? "lane_index, " : "NULL, ") +
+      (state->shared_boundaries ? "left_boundary_id, right_boundary_id " : "NULL, NULL ") +
+      "FROM lanes "
+      "WHERE " +
+      LaneSelectionCondition("lane_id") + (state->lanes_ordered ? " ORDER BY segment_id, lane_index" : "");
+
+  if (sqlite3_prepare_v2(db_, lane_sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
     throw std::runtime_error("Failed to query lanes table: " + std::string(sqlite3_errmsg(db_)));
   }
 
-  while (sqlite3_step(stmt) == SQLITE_ROW) {
-    const char* lane_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
-    const char* segment_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
-    // const char* lane_type = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2));
-    // const char* direction = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
-    const char* left_boundary_wkt = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 4));
-    const char* right_boundary_wkt = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 5));
+  const int num_workers = config_.parser_threads == 0 ? static_cast<int>(std::thread::hardware_concurrency())
+                                                       : config_.parser_threads;
+  try {
+    if (num_workers > 1) {
+      DecodeLanesInParallel(stmt, num_workers, state);
+    } else {
+      DecodeLanesInline(stmt, state);
+    }
+  } catch (...) {
+    sqlite3_finalize(stmt);
+    throw;
+  }
+  sqlite3_finalize(stmt);
+}
+
+uint32_t GeoPackageParser::InternLaneRow(sqlite3_stmt* stmt, ParseState* state) {
+  ++stats_.lane_rows;
+  CountRow();
+  const char* lane_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+  const char* segment_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
+  // const char* lane_type = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2));
+  // const char* direction = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
+  const bool has_left_boundary =
+      sqlite3_column_type(stmt, 4) != SQLITE_NULL || state->SharedBoundary(stmt, kLeftBoundaryIdColumn) != nullptr;
+  const bool has_right_boundary =
+      sqlite3_column_type(stmt, 5) != SQLITE_NULL || state->SharedBoundary(stmt, kRightBoundaryIdColumn) != nullptr;
+
+  if (!lane_id || !segment_id || !has_left_boundary || !has_right_boundary) {
+    maliput::log()->warn("Skipping lane with missing required fields");
+    return IdTable::kNone;
+  }
 
-    if (!lane_id || !segment_id || !left_boundary_wkt || !right_boundary_wkt) {
-      maliput::log()->warn("Skipping lane with missing required fields");
-      continue;
+  const uint32_t segment_index = state->segment_ids.Find(segment_id);
+  if (segment_index == IdTable::kNone) {
+    maliput::log()->warn("Lane ", lane_id, " references unknown segment ", segment_id);
+    return IdTable::kNone;
+  }
+  if (state->segment_junction[segment_index] == IdTable::kNone) {
+    return IdTable::kNone;
+  }
+
+  const uint32_t lane_index = state->lane_ids.Intern(lane_id);
+  if (lane_index == state->lane_segment.size()) {
+    state->lane_segment.push_back(segment_index);
+    state->segment_lanes[segment_index].push_back(lane_index);
+    if (state->lanes_ordered) {
+      state->lane_positions.push_back(sqlite3_column_type(stmt, kLaneIndexColumn) == SQLITE_NULL
+                                          ? kNoLanePosition
+                                          : sqlite3_column_int64(stmt, kLaneIndexColumn));
     }
+    state->lane_left_boundaries.push_back(IdTable::kNone);
+    state->lane_right_boundaries.push_back(IdTable::kNone);
+    maliput::log()->trace("Parsed lane: ", lane_id, " in segment: ", segment_id);
+  }
+  // A duplicated lane ID keeps its last row, boundaries included, see StoreLane().
+  state->lane_left_boundaries[lane_index] = state->SharedBoundaryIndex(stmt, kLeftBoundaryIdColumn);
+  state->lane_right_boundaries[lane_index] = state->SharedBoundaryIndex(stmt, kRightBoundaryIdColumn);
+  return lane_index;
+}
+
+void GeoPackageParser::StoreLane(uint32_t lane_index, maliput_sparse::parser::Lane lane, ParseState* state) {
+  stats_.points_decoded += static_cast<int64_t>(lane.left.size() + lane.right.size());
+  // Lanes are stored in row order, so a new lane index is always the next one. Lower indices come from
+  // duplicate rows, the last of which wins.
+  if (lane_index == state->lanes.size()) {
+    state->lanes.push_back(std::move(lane));
+  } else {
+    state->lanes[lane_index] = std::move(lane);
+  }
+}
 
-    // Parse the WKT geometries
-    const auto left_points = ParseLineStringZ(left_boundary_wkt);
-    const auto right_points = ParseLineStringZ(right_boundary_wkt);
+void GeoPackageParser::DecodeLanesInline(sqlite3_stmt* stmt, ParseState* state) {
+  // Point buffers are reused across rows so geometry decoding does not allocate once they are large enough.
+  std::vector<maliput::math::Vector3> left_points;
+  std::vector<maliput::math::Vector3> right_points;
+  // Decodes the geometry straight from the SQLite column buffer, or copies the shared boundary the lane references.
+  const auto read_boundary = [&](int geometry_col, int boundary_id_col, std::vector<maliput::math::Vector3>* points) {
+    if (const auto* shared = state->SharedBoundary(stmt, boundary_id_col)) return *shared;
+    points->clear();
+    ReadLineStringZColumn(stmt, geometry_col, points);
+    stats_.geometry_bytes_read += sqlite3_column_bytes(stmt, geometry_col);
+    return ToLineString3d(*points);
+  };
+
+  while (sqlite3_step(stmt) == SQLITE_ROW) {
+    const uint32_t lane_index = InternLaneRow(stmt, state);
+    if (lane_index == IdTable::kNone) continue;
 
     // Create the lane using aggregate initialization
     // Lane struct has: id, left, right, left_lane_id, right_lane_id, successors, predecessors
+    // The ID is filled in by MaterializeJunctions().
     maliput_sparse::parser::Lane lane{
-        lane_id,                       // id
-        ToLineString3d(left_points),   // left
-        ToLineString3d(right_points),  // right
-        std::nullopt,                  // left_lane_id
-        std::nullopt,                  // right_lane_id
-        {},                            // successors
-        {}                             // predecessors
+        {},                                                     // id
+        read_boundary(4, kLeftBoundaryIdColumn, &left_points),  // left
+        read_boundary(5, kRightBoundaryIdColumn, &right_points),  // right
+        std::nullopt,                                           // left_lane_id
+        std::nullopt,                                           // right_lane_id
+        {},                                                     // successors
+        {}                                                      // predecessors
     };
+    StoreLane(lane_index, std::move(lane), state);
+  }
+}
 
-    // Find the junction for this segment
-    auto seg_junc_it = segment_to_junction.find(segment_id);
-    if (seg_junc_it == segment_to_junction.end()) {
-      maliput::log()->warn("Lane ", lane_id, " references unknown segment ", segment_id);
-      continue;
+void GeoPackageParser::DecodeLanesInParallel(sqlite3_stmt* stmt, int num_workers, ParseState* state) {
+  LaneDecodePool pool(num_workers);
+
+  // This thread only copies rows out of SQLite; decoding happens on the pool.
+  // Shared boundaries are already decoded, so the pool copies them instead.
+  const auto copy_boundary = [&](int geometry_col, int boundary_id_col) {
+    if (const auto* shared = state->SharedBoundary(stmt, boundary_id_col)) {
+      return LaneDecodePool::RawGeometry{false, {}, shared};
+    }
+    stats_.geometry_bytes_read += sqlite3_column_bytes(stmt, geometry_col);
+    return CopyGeometryColumn(stmt, geometry_col);
+  };
+  std::vector<LaneDecodePool::RawLane> batch;
+  batch.reserve(kLaneBatchSize);
+  while (sqlite3_step(stmt) == SQLITE_ROW) {
+    const uint32_t lane_index = InternLaneRow(stmt, state);
+    if (lane_index == IdTable::kNone) continue;
+
+    batch.push_back(
+        {lane_index, copy_boundary(4, kLeftBoundaryIdColumn), copy_boundary(5, kRightBoundaryIdColumn)});
+    if (batch.size() == kLaneBatchSize) {
+      if (!pool.Submit(std::move(batch))) break;
+      batch = {};
+      batch.reserve(kLaneBatchSize);
     }
+  }
+  if (!batch.empty()) {
+    pool.Submit(std::move(batch));
+  }
 
-    const std::string& junction_id = seg_junc_it->second;
+  // Store in row order so the result matches DecodeLanesInline().
+  for (auto& decoded_lane : pool.Finish()) {
+    StoreLane(decoded_lane.lane_index, std::move(decoded_lane.lane), state);
+  }
+}
 
-    // Add lane to the segment
-    auto junction_it = junctions_.find(junction_id);
-    if (junction_it != junctions_.end()) {
-      auto segment_it = junction_it->second.segments.find(segment_id);
-      if (segment_it != junction_it->second.segments.end()) {
-        segment_it->second.lanes.push_back(lane);
-        lane_to_junction_[lane_id] = junction_id;
-        lane_to_segment_[lane_id] = segment_id;
-        maliput::log()->trace("Parsed lane: ", lane_id, " in segment: ", segment_id);
+void GeoPackageParser::SimplifyBoundaries(ParseState* state) {
+  const int num_workers = config_.parser_threads == 0 ? static_cast<int>(std::thread::hardware_concurrency())
+                                                       : config_.parser_threads;
+  const bool match_vertices = config_.boundary_simplification == BoundarySimplification::kSimplifyAndMatch;
+  std::vector<int64_t> points_kept(std::max(num_workers, 1), 0);
+  // Shared boundaries are simplified once, then copied to every lane referencing them.
+  RunInShares(state->boundaries.size(), num_workers, [&](size_t, size_t begin, size_t end) {
+    std::vector<maliput::math::Vector3> points;
+    std::vector<maliput::math::Vector3> simplified;
+    for (size_t i = begin; i < end; ++i) {
+      points.assign(state->boundaries[i].begin(), state->boundaries[i].end());
+      SimplifyPolyline(points, config_.simplification_tolerance, &simplified);
+      state->boundaries[i] = ToLineString3d(simplified);
+    }
+  });
+  RunInShares(state->lanes.size(), num_workers, [&](size_t share, size_t begin, size_t end) {
+    std::vector<maliput::math::Vector3> points;
+    std::vector<maliput::math::Vector3> left;
+    std::vector<maliput::math::Vector3> right;
+    // Simplifies the boundary of `lane` on one side, unless the lane references a shared one.
+    const auto simplify = [&](uint32_t shared_boundary, const maliput_sparse::geometry::LineString3d& boundary,
+                              std::vector<maliput::math::Vector3>* simplified) {
+      if (shared_boundary != IdTable::kNone) {
+        simplified->assign(state->boundaries[shared_boundary].begin(), state->boundaries[shared_boundary].end());
+        return;
+      }
+      points.assign(boundary.begin(), boundary.end());
+      SimplifyPolyline(points, config_.simplification_tolerance, simplified);
+    };
+    for (size_t i = begin; i < end; ++i) {
+      maliput_sparse::parser::Lane& lane = state->lanes[i];
+      const uint32_t left_boundary = state->lane_left_boundaries[i];
+      const uint32_t right_boundary = state->lane_right_boundaries[i];
+      simplify(left_boundary, lane.left, &left);
+      simplify(right_boundary, lane.right, &right);
+      // Resampling a shared boundary for one of its lanes would set it apart from its copy in the neighbouring
+      // lane, so only lanes storing both of their boundaries are matched.
+      if (match_vertices && left_boundary == IdTable::kNone && right_boundary == IdTable::kNone) {
+        MatchVertices(&left, &right);
+      }
+      lane.left = ToLineString3d(left);
+      lane.right = ToLineString3d(right);
+      points_kept[share] += static_cast<int64_t>(left.size() + right.size());
+    }
+  });
+  for (const int64_t share_points : points_kept) {
+    stats_.points_kept += share_points;
+  }
+}
+
+void GeoPackageParser::ParseCenterlines(ParseState* state) {
+  if (!HasColumns(db_, "lanes", {"centerline"})) return;
+  const std::string sql = "SELECT lane_id, centerline, " +
+                          std::string(HasColumns(db_, "lanes", {"centerline_s"}) ? "centerline_s " : "NULL ") +
+                          "FROM lanes WHERE centerline IS NOT NULL AND " + LaneSelectionCondition("lane_id");
+  sqlite3_stmt* stmt;
+  if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+    throw std::runtime_error("Failed to query lane centerlines: " + std::string(sqlite3_errmsg(db_)));
+  }
+
+  const int num_workers = config_.parser_threads == 0 ? static_cast<int>(std::thread::hardware_concurrency())
+                                                       : config_.parser_threads;
+  // Only centerlines of parsed lanes are kept; duplicated rows keep the last one.
+  std::vector<uint32_t> row_lanes;
+  std::vector<LaneDecodePool::RawGeometry> raw_centerlines;
+  std::vector<std::string> row_arc_lengths;
+  std::vector<LaneCenterline> centerlines(state->lanes.size());
+  std::vector<bool> has_centerline(state->lanes.size(), false);
+  try {
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+      const char* lane_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+      CountRow();
+      if (lane_id == nullptr) continue;
+      const uint32_t lane_index = state->lane_ids.Find(lane_id);
+      if (lane_index >= state->lanes.size()) continue;
+      stats_.geometry_bytes_read += sqlite3_column_bytes(stmt, 1);
+      const char* arc_lengths = static_cast<const char*>(sqlite3_column_blob(stmt, 2));
+      std::string arc_length_bytes =
+          arc_lengths == nullptr ? std::string() : std::string(arc_lengths, sqlite3_column_bytes(stmt, 2));
+      if (num_workers > 1) {
+        row_lanes.push_back(lane_index);
+        raw_centerlines.push_back(CopyGeometryColumn(stmt, 1));
+        row_arc_lengths.push_back(std::move(arc_length_bytes));
+        continue;
       }
+      LaneCenterline& centerline = centerlines[lane_index];
+      centerline.points.clear();
+      ReadLineStringZColumn(stmt, 1, &centerline.points);
+      SetArcLengths(lane_id, arc_length_bytes, &centerline);
+      has_centerline[lane_index] = true;
     }
+  } catch (...) {
+    sqlite3_finalize(stmt);
+    throw;
   }
   sqlite3_finalize(stmt);
+
+  if (num_workers > 1) {
+    const std::vector<maliput_sparse::geometry::LineString3d> decoded = DecodeLineStrings(raw_centerlines, num_workers);
+    for (size_t row = 0; row < decoded.size(); ++row) {
+      LaneCenterline& centerline = centerlines[row_lanes[row]];
+      centerline.points.assign(decoded[row].begin(), decoded[row].end());
+      SetArcLengths(std::string(state->lane_ids.str(row_lanes[row])), row_arc_lengths[row], &centerline);
+      has_centerline[row_lanes[row]] = true;
+    }
+  }
+
+  centerlines_.reserve(state->lanes.size());
+  for (uint32_t lane_index = 0; lane_index < centerlines.size(); ++lane_index) {
+    if (!has_centerline[lane_index]) continue;
+    centerlines_.emplace(std::string(state->lane_ids.str(lane_index)), std::move(centerlines[lane_index]));
+  }
 }
 
-void GeoPackageParser::ParseConnections() {
-  BuildBranchPointConnections();
-  BuildLaneAdjacency();
+void GeoPackageParser::ParseConnections(ParseState* state) {
+  RunPhase("build_branch_point_connections", [this]() { BuildBranchPointConnections(); });
+  RunPhase("build_lane_adjacency", [this, state]() { BuildLaneAdjacency(state); });
+}
+
+void GeoPackageParser::MaterializeJunctions(ParseState* state) {
+  junctions_.reserve(state->junction_ids.size());
+  for (uint32_t junction_index = 0; junction_index < state->junction_ids.size(); ++junction_index) {
+    maliput_sparse::parser::Junction junction;
+    junction.id = std::string(state->junction_ids.str(junction_index));
+    for (const uint32_t segment_index : state->junction_segments[junction_index]) {
+      maliput_sparse::parser::Segment segment;
+      segment.id = std::string(state->segment_ids.str(segment_index));
+      segment.lanes.reserve(state->segment_lanes[segment_index].size());
+      for (const uint32_t lane_index : state->segment_lanes[segment_index]) {
+        maliput_sparse::parser::Lane& lane = state->lanes[lane_index];
+        lane.id = std::string(state->lane_ids.str(lane_index));
+        if (state->left_lanes[lane_index] != IdTable::kNone) {
+          lane.left_lane_id = std::string(state->lane_ids.str(state->left_lanes[lane_index]));
+        }
+        if (state->right_lanes[lane_index] != IdTable::kNone) {
+          lane.right_lane_id = std::string(state->lane_ids.str(state->right_lanes[lane_index]));
+        }
+        segment.lanes.push_back(std::move(lane));
+      }
+      junction.segments.emplace(segment.id, std::move(segment));
+    }
+    junctions_.emplace(junction.id, std::move(junction));
+  }
+}
+
+void GeoPackageParser::CountParsedEntities() {
+  stats_.junctions = static_cast<int64_t>(junctions_.size());
+  stats_.segments = 0;
+  stats_.lanes = 0;
+  for (const auto& [junction_id, junction] : junctions_) {
+    stats_.segments += static_cast<int64_t>(junction.segments.size());
+    for (const auto& [segment_id, segment] : junction.segments) {
+      stats_.lanes += static_cast<int64_t>(segment.lanes.size());
+    }
+  }
+  stats_.connections = static_cast<int64_t>(connections_.size());
 }
 
 void GeoPackageParser::BuildBranchPointConnections() {
   // Query branch_point_lanes to build connections
   // Group by branch_point_id, then create connections between a-side and b-side lanes
-  const char* sql =
+  // Entries referencing lanes that are not loaded are dropped, see BoundaryPolicy.
+  const std::string sql =
       "SELECT branch_point_id, lane_id, side, lane_end "
       "FROM branch_point_lanes "
+      "WHERE " +
+      LaneSelectionCondition("lane_id") +
+      " "
       "ORDER BY branch_point_id, side";
 
   sqlite3_stmt* stmt;
-  if (sqlite3_prepare_v2(db_, sql, -1, &stmt, nullptr) != SQLITE_OK) {
+  if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
     maliput::log()->warn("No branch_point_lanes table found or query failed.");
     return;
   }
 
-  // Group lane ends by branch point and side
-  std::unordered_map<std::string, std::vector<maliput_sparse::parser::LaneEnd>> a_side_lanes;
-  std::unordered_map<std::string, std::vector<maliput_sparse::parser::LaneEnd>> b_side_lanes;
-
-  while (sqlite3_step(stmt) == SQLITE_ROW) {
-    const char* bp_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
-    const char* lane_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
-    const char* side = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2));
-    const char* lane_end = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
-
-    if (!bp_id || !lane_id || !side || !lane_end) continue;
-
-    maliput_sparse::parser::LaneEnd le;
-    le.lane_id = lane_id;
-    le.end = LaneEndWhichFromString(lane_end);
-
-    if (std::string(side) == "a") {
-      a_side_lanes[bp_id].push_back(le);
-    } else if (std::string(side) == "b") {
-      b_side_lanes[bp_id].push_back(le);
-    }
-  }
-  sqlite3_finalize(stmt);
-
-  // Create connections: each a-side lane connects to each b-side lane
-  for (const auto& [bp_id, a_lanes] : a_side_lanes) {
-    auto b_it = b_side_lanes.find(bp_id);
-    if (b_it == b_side_lanes.end()) continue;
-
-    for (const auto& a_lane : a_lanes) {
-      for (const auto& b_lane : b_it->second) {
+  // Rows come grouped by branch point, so each group is turned into connections as soon as it is complete:
+  // each a-side lane connects to each b-side lane.
+  std::string branch_point_id;
+  std::vector<maliput_sparse::parser::LaneEnd> a_side_lanes;
+  std::vector<maliput_sparse::parser::LaneEnd> b_side_lanes;
+  const auto connect_branch_point = [&]() {
+    for (const auto& a_lane : a_side_lanes) {
+      for (const auto& b_lane : b_side_lanes) {
         maliput_sparse::parser::Connection conn;
         conn.from = a_lane;
         conn.to = b_lane;
@@ -296,94 +1111,136 @@ void GeoPackageParser::BuildBranchPointConnections() {
         maliput::log()->trace("Created connection: ", a_lane.lane_id, " -> ", b_lane.lane_id);
       }
     }
+    a_side_lanes.clear();
+    b_side_lanes.clear();
+  };
+
+  try {
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+      const char* bp_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+      const char* lane_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
+      const char* side = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2));
+      const char* lane_end = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
+      ++stats_.branch_point_lane_rows;
+      CountRow();
+
+      if (!bp_id || !lane_id || !side || !lane_end) continue;
+
+      if (branch_point_id != bp_id) {
+        connect_branch_point();
+        branch_point_id = bp_id;
+      }
+
+      maliput_sparse::parser::LaneEnd le;
+      le.lane_id = lane_id;
+      le.end = LaneEndWhichFromString(lane_end);
+
+      if (std::strcmp(side, "a") == 0) {
+        a_side_lanes.push_back(std::move(le));
+      } else if (std::strcmp(side, "b") == 0) {
+        b_side_lanes.push_back(std::move(le));
+      }
+    }
+  } catch (...) {
+    sqlite3_finalize(stmt);
+    throw;
   }
+  sqlite3_finalize(stmt);
+  connect_branch_point();
 }
 
-void GeoPackageParser::BuildLaneAdjacency() {
+void GeoPackageParser::BuildLaneAdjacency(ParseState* state) {
+  const size_t num_lanes = state->lanes.size();
+  state->left_lanes.assign(num_lanes, IdTable::kNone);
+  state->right_lanes.assign(num_lanes, IdTable::kNone);
+
+  // Lanes of a segment read in position order are adjacent exactly when their positions are consecutive. This
+  // holds for partial loads too: adjacent_lanes rows are only read between selected lanes, and a selected lane
+  // whose neighbour was not loaded, e.g. filtered out by its type, finds a gap in the positions instead. A segment
+  // holding a lane without a position was not read in order, so it falls back to adjacent_lanes on its own.
+  std::vector<bool> segment_unordered(state->segment_lanes.size(), !state->lanes_ordered);
+  bool any_segment_unordered = !state->lanes_ordered;
+  if (state->lanes_ordered) {
+    for (size_t segment_index = 0; segment_index < state->segment_lanes.size(); ++segment_index) {
+      const std::vector<uint32_t>& lanes = state->segment_lanes[segment_index];
+      if (std::any_of(lanes.begin(), lanes.end(),
+                      [state](uint32_t lane) { return state->lane_positions[lane] == kNoLanePosition; })) {
+        segment_unordered[segment_index] = true;
+        any_segment_unordered = true;
+        continue;
+      }
+      for (size_t i = 1; i < lanes.size(); ++i) {
+        const uint32_t right = lanes[i - 1];
+        const uint32_t left = lanes[i];
+        if (state->lane_positions[left] != state->lane_positions[right] + 1) continue;
+        state->left_lanes[right] = left;
+        state->right_lanes[left] = right;
+      }
+    }
+  }
+  if (!any_segment_unordered) return;
+
   // Query adjacent_lanes table to set left_lane_id and right_lane_id
-  const char* sql = "SELECT lane_id, adjacent_lane_id, side FROM adjacent_lanes";
+  const std::string sql = "SELECT lane_id, adjacent_lane_id, side FROM adjacent_lanes WHERE " +
+                          LaneSelectionCondition("lane_id") + " AND " + LaneSelectionCondition("adjacent_lane_id");
 
   sqlite3_stmt* stmt;
-  if (sqlite3_prepare_v2(db_, sql, -1, &stmt, nullptr) != SQLITE_OK) {
+  if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
     maliput::log()->warn("No adjacent_lanes table found or query failed.");
     return;
   }
 
-  // Build adjacency map
-  std::unordered_map<std::string, std::string> left_adjacent;
-  std::unordered_map<std::string, std::string> right_adjacent;
-
-  while (sqlite3_step(stmt) == SQLITE_ROW) {
-    const char* lane_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
-    const char* adjacent_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
-    const char* side = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2));
-
-    if (!lane_id || !adjacent_id || !side) continue;
-
-    if (std::string(side) == "left") {
-      left_adjacent[lane_id] = adjacent_id;
-    } else if (std::string(side) == "right") {
-      right_adjacent[lane_id] = adjacent_id;
+  try {
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+      const char* lane_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+      const char* adjacent_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
+      const char* side = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2));
+      ++stats_.adjacent_lane_rows;
+      CountRow();
+
+      if (!lane_id || !adjacent_id || !side) continue;
+
+      // Both lanes passed the selection, but either may have been skipped while decoding, e.g. for missing
+      // fields. Skipped lanes have no index or one past the parsed lanes.
+      const uint32_t lane_index = state->lane_ids.Find(lane_id);
+      if (lane_index >= num_lanes || !segment_unordered[state->lane_segment[lane_index]]) continue;
+
+      // The adjacent lane is interned even when it was skipped, so its ID is still reported.
+      if (std::strcmp(side, "left") == 0) {
+        state->left_lanes[lane_index] = state->lane_ids.Intern(adjacent_id);
+      } else if (std::strcmp(side, "right") == 0) {
+        state->right_lanes[lane_index] = state->lane_ids.Intern(adjacent_id);
+      }
     }
+  } catch (...) {
+    sqlite3_finalize(stmt);
+    throw;
   }
   sqlite3_finalize(stmt);
 
-  // Update lanes with adjacency information and reorder lanes in each segment
-  for (auto& [junction_id, junction] : junctions_) {
-    for (auto& [segment_id, segment] : junction.segments) {
-      // First, update adjacency info
-      for (auto& lane : segment.lanes) {
-        auto left_it = left_adjacent.find(lane.id);
-        if (left_it != left_adjacent.end()) {
-          lane.left_lane_id = left_it->second;
-        }
-
-        auto right_it = right_adjacent.find(lane.id);
-        if (right_it != right_adjacent.end()) {
-          lane.right_lane_id = right_it->second;
-        }
-      }
-
-      // Now reorder lanes so that the rightmost lane (no right_lane_id) is first
-      // and each subsequent lane is to the left
-      if (segment.lanes.size() > 1) {
-        std::vector<maliput_sparse::parser::Lane> ordered_lanes;
-        ordered_lanes.reserve(segment.lanes.size());
-
-        // Build a map from lane_id to lane
-        std::unordered_map<std::string, const maliput_sparse::parser::Lane*> lane_map;
-        for (const auto& lane : segment.lanes) {
-          lane_map[lane.id] = &lane;
-        }
-
-        // Find the rightmost lane (no right_lane_id)
-        const maliput_sparse::parser::Lane* current = nullptr;
-        for (const auto& lane : segment.lanes) {
-          if (!lane.right_lane_id.has_value()) {
-            current = &lane;
-            break;
-          }
-        }
-
-        if (current) {
-          // Chain from right to left
-          while (current) {
-            ordered_lanes.push_back(*current);
-            if (current->left_lane_id.has_value()) {
-              auto it = lane_map.find(current->left_lane_id.value());
-              current = (it != lane_map.end()) ? it->second : nullptr;
-            } else {
-              current = nullptr;
-            }
-          }
+  // Reorder lanes so that the rightmost lane (no right lane) is first and each subsequent lane is to the left.
+  std::vector<uint32_t> ordered_lanes;
+  for (uint32_t segment_index = 0; segment_index < state->segment_lanes.size(); ++segment_index) {
+    std::vector<uint32_t>& lanes = state->segment_lanes[segment_index];
+    if (!segment_unordered[segment_index] || lanes.size() < 2) continue;
+
+    const auto rightmost = std::find_if(lanes.begin(), lanes.end(), [state](uint32_t lane_index) {
+      return state->right_lanes[lane_index] == IdTable::kNone;
+    });
+    if (rightmost == lanes.end()) continue;
+
+    // Chain from right to left through lanes of this segment. The length bound stops on cyclic adjacency.
+    ordered_lanes.clear();
+    for (uint32_t current = *rightmost; current != IdTable::kNone && ordered_lanes.size() <= lanes.size();) {
+      ordered_lanes.push_back(current);
+      const uint32_t left = state->left_lanes[current];
+      current = left < num_lanes && state->lane_segment[left] == segment_index ? left : IdTable::kNone;
+    }
 
-          // If we successfully ordered all lanes, use the new order
-          if (ordered_lanes.size() == segment.lanes.size()) {
-            segment.lanes = std::move(ordered_lanes);
-            maliput::log()->trace("Reordered lanes in segment: ", segment_id);
-          }
-        }
-      }
+    // If we successfully ordered all lanes, use the new order
+    if (ordered_lanes.size() == lanes.size()) {
+      lanes.swap(ordered_lanes);
+      maliput::log()->trace("Reordered lanes in segment: ", state->segment_ids.str(segment_index));
     }
   }
 }
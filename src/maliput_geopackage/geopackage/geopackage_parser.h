@@ -29,29 +29,52 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include <maliput/common/maliput_copyable.h>
+#include <maliput/math/vector.h>
 #include <maliput_sparse/parser/connection.h>
 #include <maliput_sparse/parser/junction.h>
 #include <maliput_sparse/parser/lane.h>
 #include <maliput_sparse/parser/parser.h>
 #include <maliput_sparse/parser/segment.h>
 
+#include "maliput_geopackage/geopackage/parser_configuration.h"
+#include "maliput_geopackage/geopackage/parser_stats.h"
+
 // Forward declaration for SQLite
 struct sqlite3;
+struct sqlite3_stmt;
 
 namespace maliput_geopackage {
 namespace geopackage {
 
+/// A lane centerline precomputed by the map tooling and stored in the GeoPackage.
+struct LaneCenterline {
+  /// Vertices, from the start to the finish of the lane.
+  std::vector<maliput::math::Vector3> points;
+  /// Arc length at every vertex in meters, from 0 at the first one to the centerline length at the last one.
+  std::vector<double> arc_lengths;
+};
+
+/// Thrown by GeoPackageParser when ParserConfiguration::cancelled is set while parsing.
+class ParseCancelled : public std::runtime_error {
+ public:
+  ParseCancelled() : std::runtime_error("GeoPackage parsing was cancelled.") {}
+};
+
 /// GeoPackageParser is responsible for loading a GeoPackage file, parsing it according to the
 /// maliput GeoPackage schema, and providing accessors to get the road network data.
 ///
 /// The GeoPackage must conform to the maliput_geopackage schema which includes:
-/// - lanes table with left_boundary and right_boundary LINESTRINGZ geometries
+/// - lanes table with left_boundary and right_boundary LINESTRINGZ geometries, stored as WKT text or as
+///   GeoPackage binary blobs
 /// - junctions table
 /// - segments table
 /// - branch_points table
@@ -63,12 +86,35 @@ class GeoPackageParser : public maliput_sparse::parser::Parser {
 
   /// Constructs a GeoPackageParser object.
   /// @param gpkg_file_path The path to the GeoPackage file to load.
+  /// @param config Options tuning how the file is read.
   /// @throws std::runtime_error if the file cannot be opened or parsed.
-  explicit GeoPackageParser(const std::string& gpkg_file_path);
+  /// @throws ParseCancelled if `config.cancelled` is set before parsing completes.
+  explicit GeoPackageParser(const std::string& gpkg_file_path, const ParserConfiguration& config = {});
+
+  /// Constructs a GeoPackageParser object from a GeoPackage held in memory, e.g. embedded in a larger
+  /// bundle or received from another process. The bytes are read in place rather than copied, and only
+  /// need to outlive the constructor. Parsing yields the same result as loading the same bytes from a file,
+  /// except that `config.build_spatial_index` and `config.use_snapshot_cache` are ignored: both need a file.
+  /// @param gpkg_data The first byte of the GeoPackage. It must not be in WAL journal mode.
+  /// @param gpkg_size The size of the GeoPackage in bytes.
+  /// @param config Options tuning how the GeoPackage is read.
+  /// @throws std::runtime_error if the bytes are not a database or cannot be parsed.
+  /// @throws ParseCancelled if `config.cancelled` is set before parsing completes.
+  GeoPackageParser(const uint8_t* gpkg_data, size_t gpkg_size, const ParserConfiguration& config = {});
 
   /// Destructor.
   ~GeoPackageParser();
 
+  /// @returns Timings and counters measured while loading.
+  const ParserStats& stats() const { return stats_; }
+
+  /// @returns The stored centerlines of the loaded lanes, by lane ID. Empty unless
+  /// ParserConfiguration::read_centerlines is set, and lanes without a stored centerline are left out. They are
+  /// not handed to maliput_sparse, which derives the centerlines of the lanes it builds from their boundaries.
+  const std::unordered_map<maliput_sparse::parser::Lane::Id, LaneCenterline>& centerlines() const {
+    return centerlines_;
+  }
+
  private:
   /// Gets the map's junctions.
   const std::unordered_map<maliput_sparse::parser::Junction::Id, maliput_sparse::parser::Junction>& DoGetJunctions()
@@ -80,41 +126,132 @@ class GeoPackageParser : public maliput_sparse::parser::Parser {
   /// Opens the SQLite database.
   void OpenDatabase(const std::string& gpkg_file_path);
 
+  /// Opens the SQLite database serialized in the `gpkg_size` bytes at `gpkg_data`, without copying them.
+  void OpenDatabase(const uint8_t* gpkg_data, size_t gpkg_size);
+
+  /// Parses the open database into `junctions_` and `connections_`, and then closes it.
+  void ParseDatabase();
+
+  /// Builds and persists the lane spatial index in the GeoPackage at `gpkg_file_path`, unless it already has one.
+  /// Failures are logged rather than thrown, since loading does not require the index.
+  static void EnsureLaneSpatialIndex(const std::string& gpkg_file_path);
+
   /// Closes the SQLite database.
   void CloseDatabase();
 
   /// Parses the metadata table.
   void ParseMetadata();
 
+  /// Fills the temp.selected_lanes table with the lanes to load according to `config_`: the lanes in the load
+  /// region and the selected junctions, of the selected types, expanded by `config_.expansion_hops` and the
+  /// boundary policy. Every subsequent query is restricted to those lanes, so other rows are never decoded.
+  void SelectLanes();
+
+  /// Inserts into temp.selected_lanes the lanes whose extent intersects `region`.
+  void SelectLanesInRegion(const Region2d& region);
+
+  /// Inserts into temp.selected_lanes the lanes up to `hops` branch points away from a selected lane.
+  void ExpandLaneSelection(int hops);
+
+  /// Inserts into temp.selected_lanes the lanes sharing a branch point with a selected lane, and then
+  /// the remaining lanes of every segment holding a selected lane.
+  void ExpandLaneSelectionToClosure();
+
+  /// @returns A SQL condition matching the rows whose `lane_id_column` is a lane to load.
+  std::string LaneSelectionCondition(const std::string& lane_id_column) const;
+
+  /// @returns A SQL condition matching the rows whose `lane_type_column` is a lane type to load.
+  std::string LaneTypeCondition(const std::string& lane_type_column) const;
+
+  /// Parse-time bookkeeping keyed by interned IDs, see geopackage_parser.cc.
+  struct ParseState;
+
+  /// Runs `phase` and records its duration in `stats_` under `name`, reporting its start to
+  /// ParserConfiguration::on_progress.
+  /// @throws ParseCancelled if ParserConfiguration::cancelled is set.
+  template <typename Function>
+  void RunPhase(const char* name, Function&& phase);
+
+  /// Counts a row read from the GeoPackage, reporting progress every ParseProgress::kReportInterval rows.
+  /// @throws ParseCancelled if ParserConfiguration::cancelled is set.
+  void CountRow();
+
+  /// Reports the current phase and row count to ParserConfiguration::on_progress, if set.
+  void ReportProgress() const;
+
   /// Parses all junctions from the database.
-  void ParseJunctions();
+  void ParseJunctions(ParseState* state);
+
+  /// Decodes the rows of the optional boundaries table that the selected lanes reference, each once.
+  void ParseBoundaries(ParseState* state);
 
   /// Parses all segments and their lanes.
-  void ParseSegmentsAndLanes();
+  void ParseSegmentsAndLanes(ParseState* state);
+
+  /// Steps `stmt` over the lanes query and decodes every lane on the calling thread.
+  void DecodeLanesInline(sqlite3_stmt* stmt, ParseState* state);
+
+  /// Steps `stmt` over the lanes query on the calling thread while `num_workers` threads decode the lanes.
+  /// Lanes are stored in row order, yielding the same result as DecodeLanesInline().
+  void DecodeLanesInParallel(sqlite3_stmt* stmt, int num_workers, ParseState* state);
+
+  /// Simplifies the boundaries of every decoded lane as ParserConfiguration::boundary_simplification requests, on
+  /// ParserConfiguration::parser_threads threads. Shared boundaries are simplified once and copied to their lanes.
+  void SimplifyBoundaries(ParseState* state);
+
+  /// Reads the `centerline` and optional `centerline_s` columns of the loaded lanes into `centerlines_`.
+  void ParseCenterlines(ParseState* state);
+
+  /// Interns the lane at the current row of `stmt` and records its segment.
+  /// @returns The lane index, or IdTable::kNone when the row is skipped: required fields are missing or its
+  /// segment was not parsed.
+  uint32_t InternLaneRow(sqlite3_stmt* stmt, ParseState* state);
+
+  /// Stores the decoded `lane` as lane `lane_index`.
+  void StoreLane(uint32_t lane_index, maliput_sparse::parser::Lane lane, ParseState* state);
 
   /// Parses topology connections from branch_point_lanes and adjacent_lanes tables.
-  void ParseConnections();
+  void ParseConnections(ParseState* state);
+
+  /// Moves the parsed junctions, segments and lanes of `state` into `junctions_`, materializing their IDs.
+  void MaterializeJunctions(ParseState* state);
+
+  /// Fills the parsed entity counts of `stats_` from `junctions_` and `connections_`.
+  void CountParsedEntities();
 
   /// Builds connections based on branch point topology.
   void BuildBranchPointConnections();
 
-  /// Builds lane adjacency information.
-  void BuildLaneAdjacency();
+  /// Reads lane adjacency and orders the lanes of every segment from right to left. Lanes read in `lanes.lane_index`
+  /// order are already ordered, and for whole maps their adjacency follows from that order.
+  void BuildLaneAdjacency(ParseState* state);
+
+  /// Options tuning how the file is read.
+  const ParserConfiguration config_;
 
   /// SQLite database handle.
   sqlite3* db_{nullptr};
 
+  /// Name of the running phase.
+  const char* phase_{""};
+
+  /// Rows read from the GeoPackage so far, over every table.
+  int64_t rows_read_{0};
+
+  /// Whether parsing is restricted to the lanes listed in temp.selected_lanes.
+  bool has_lane_selection_{false};
+
+  /// Timings and counters measured while loading.
+  ParserStats stats_{};
+
   /// Collection of junctions.
   std::unordered_map<maliput_sparse::parser::Junction::Id, maliput_sparse::parser::Junction> junctions_{};
 
   /// Collection of connections.
   std::vector<maliput_sparse::parser::Connection> connections_{};
 
-  /// Map from lane_id to junction_id for fast lookup.
-  std::unordered_map<std::string, std::string> lane_to_junction_{};
-
-  /// Map from lane_id to segment_id for fast lookup.
-  std::unordered_map<std::string, std::string> lane_to_segment_{};
+  /// Stored centerlines of the loaded lanes, by lane ID.
+  std::unordered_map<maliput_sparse::parser::Lane::Id, LaneCenterline> centerlines_{};
 };
 
 }  // namespace geopackage
@@ -0,0 +1,97 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/geopackage/id_table.h"
+
+#include <stdexcept>
+#include <utility>
+
+#include "maliput_geopackage/geopackage/mapped_file.h"
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+namespace {
+
+/// Initial number of slots. Must be a power of two.
+constexpr size_t kInitialSlots{64};
+
+}  // namespace
+
+IdTable::IdTable() : offsets_{0}, slots_(kInitialSlots, kNone) {}
+
+uint64_t IdTable::Hash(std::string_view id) { return Hash64(id.data(), id.size()); }
+
+size_t IdTable::FindSlot(std::string_view id, uint64_t hash) const {
+  const size_t mask = slots_.size() - 1;
+  for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+    const uint32_t index = slots_[slot];
+    if (index == kNone || (hashes_[index] == hash && str(index) == id)) {
+      return slot;
+    }
+  }
+}
+
+uint32_t IdTable::Intern(std::string_view id) {
+  const uint64_t hash = Hash(id);
+  size_t slot = FindSlot(id, hash);
+  if (slots_[slot] != kNone) {
+    return slots_[slot];
+  }
+  if (size() == kNone) {
+    throw std::runtime_error("Too many IDs to intern.");
+  }
+  // Keep the load factor at or below one half so probe sequences stay short.
+  if (2 * (hashes_.size() + 1) > slots_.size()) {
+    Grow();
+    slot = FindSlot(id, hash);
+  }
+  const uint32_t index = size();
+  chars_.append(id);
+  offsets_.push_back(chars_.size());
+  hashes_.push_back(hash);
+  slots_[slot] = index;
+  return index;
+}
+
+uint32_t IdTable::Find(std::string_view id) const { return slots_[FindSlot(id, Hash(id))]; }
+
+void IdTable::Grow() {
+  std::vector<uint32_t> slots(2 * slots_.size(), kNone);
+  const size_t mask = slots.size() - 1;
+  for (uint32_t index = 0; index < size(); ++index) {
+    size_t slot = hashes_[index] & mask;
+    while (slots[slot] != kNone) slot = (slot + 1) & mask;
+    slots[slot] = index;
+  }
+  slots_ = std::move(slots);
+}
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
@@ -0,0 +1,89 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+/// Interns string IDs into dense 32-bit indices.
+///
+/// Indices are assigned consecutively from zero in insertion order, so parse-time data can live in
+/// vectors indexed by them instead of maps keyed by strings. IDs are stored back to back in a single
+/// buffer and looked up through an open-addressing table, so interning allocates no node per entry.
+class IdTable {
+ public:
+  /// Index returned by Find() for unknown IDs.
+  static constexpr uint32_t kNone{std::numeric_limits<uint32_t>::max()};
+
+  IdTable();
+
+  /// @returns The index of `id`, adding it to the table when it is new.
+  /// @throws std::runtime_error if the table already holds `kNone` IDs.
+  uint32_t Intern(std::string_view id);
+
+  /// @returns The index of `id`, or @ref kNone if it was never interned.
+  uint32_t Find(std::string_view id) const;
+
+  /// @returns The ID interned as `index`. The view is invalidated by the next call to Intern().
+  /// @pre `index` is lower than size().
+  std::string_view str(uint32_t index) const {
+    return std::string_view(chars_.data() + offsets_[index], offsets_[index + 1] - offsets_[index]);
+  }
+
+  /// @returns The number of interned IDs.
+  uint32_t size() const { return static_cast<uint32_t>(hashes_.size()); }
+
+ private:
+  static uint64_t Hash(std::string_view id);
+
+  // @returns The slot holding `id`, or the empty slot where it would be inserted.
+  size_t FindSlot(std::string_view id, uint64_t hash) const;
+
+  // Doubles the number of slots and reinserts every index.
+  void Grow();
+
+  // Interned IDs, back to back. ID i spans [offsets_[i], offsets_[i + 1]).
+  std::string chars_;
+  std::vector<size_t> offsets_;
+  // Hash of every interned ID, so growing does not rehash the strings.
+  std::vector<uint64_t> hashes_;
+  // Linear probing table of indices; kNone marks empty slots. Its size is a power of two.
+  std::vector<uint32_t> slots_;
+};
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
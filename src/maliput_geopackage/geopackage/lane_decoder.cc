@@ -0,0 +1,211 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/geopackage/lane_decoder.h"
+
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include <maliput_sparse/geometry/line_string.h>
+
+#include "maliput_geopackage/geopackage/compact_parser.h"
+#include "maliput_geopackage/geopackage/wkb_parser.h"
+#include "maliput_geopackage/geopackage/wkt_parser.h"
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+void DecodeLineStringZ(const uint8_t* data, size_t size, bool is_blob, std::vector<maliput::math::Vector3>* points) {
+  if (!is_blob) {
+    ParseLineStringZ(std::string_view(reinterpret_cast<const char*>(data), size), points);
+  } else if (IsGeoPackageBinary(data, size)) {
+    ParseGeoPackageBinaryLineStringZ(data, size, points);
+  } else if (IsCompactLineString(data, size)) {
+    ParseCompactLineStringZ(data, size, points);
+  } else {
+    ParseWkbLineStringZ(data, size, points);
+  }
+}
+
+namespace {
+
+// Decodes `geometry` unless it is shared, using `points` as scratch buffer.
+maliput_sparse::geometry::LineString3d DecodeGeometry(const LaneDecodePool::RawGeometry& geometry,
+                                                      std::vector<maliput::math::Vector3>* points) {
+  if (geometry.shared != nullptr) {
+    return *geometry.shared;
+  }
+  points->clear();
+  DecodeLineStringZ(reinterpret_cast<const uint8_t*>(geometry.bytes.data()), geometry.bytes.size(), geometry.is_blob,
+                    points);
+  return maliput_sparse::geometry::LineString3d(*points);
+}
+
+}  // namespace
+
+LaneDecodePool::LaneDecodePool(int num_workers) : max_queued_tasks_(2 * static_cast<size_t>(num_workers)) {
+  workers_.reserve(num_workers);
+  for (int i = 0; i < num_workers; ++i) {
+    workers_.emplace_back(&LaneDecodePool::Run, this);
+  }
+}
+
+LaneDecodePool::~LaneDecodePool() { Close(); }
+
+bool LaneDecodePool::Submit(std::vector<RawLane> batch) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  space_available_.wait(lock, [this] { return tasks_.size() < max_queued_tasks_ || error_; });
+  if (error_) return false;
+  results_.emplace_back();
+  tasks_.push_back(Task{std::move(batch), &results_.back()});
+  task_available_.notify_one();
+  return true;
+}
+
+std::vector<LaneDecodePool::DecodedLane> LaneDecodePool::Finish() {
+  Close();
+  if (error_) {
+    std::rethrow_exception(error_);
+  }
+  std::vector<DecodedLane> decoded_lanes;
+  size_t num_lanes{0};
+  for (const auto& results : results_) {
+    num_lanes += results.size();
+  }
+  decoded_lanes.reserve(num_lanes);
+  for (auto& results : results_) {
+    std::move(results.begin(), results.end(), std::back_inserter(decoded_lanes));
+  }
+  results_.clear();
+  return decoded_lanes;
+}
+
+void LaneDecodePool::Run() {
+  // Point buffers are reused across rows so geometry decoding does not allocate once they are large enough.
+  std::vector<maliput::math::Vector3> left_points;
+  std::vector<maliput::math::Vector3> right_points;
+  while (true) {
+    std::optional<Task> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      task_available_.wait(lock, [this] { return !tasks_.empty() || closed_; });
+      if (tasks_.empty()) return;
+      task.emplace(std::move(tasks_.front()));
+      tasks_.pop_front();
+      space_available_.notify_one();
+    }
+    try {
+      task->results->reserve(task->batch.size());
+      for (RawLane& raw_lane : task->batch) {
+        task->results->push_back(DecodedLane{raw_lane.lane_index,
+                                             maliput_sparse::parser::Lane{
+                                                 {},                                              // id
+                                                 DecodeGeometry(raw_lane.left, &left_points),     // left
+                                                 DecodeGeometry(raw_lane.right, &right_points),   // right
+                                                 std::nullopt,                                    // left_lane_id
+                                                 std::nullopt,                                    // right_lane_id
+                                                 {},                                              // successors
+                                                 {}                                               // predecessors
+                                             }});
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!error_) {
+        error_ = std::current_exception();
+      }
+      // Drop pending work and wake up a producer waiting for space.
+      tasks_.clear();
+      space_available_.notify_all();
+    }
+  }
+}
+
+void LaneDecodePool::Close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+  }
+  task_available_.notify_all();
+  for (auto& worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+}
+
+void RunInShares(size_t count, int num_workers,
+                 const std::function<void(size_t share, size_t begin, size_t end)>& work) {
+  const size_t num_shares = std::max<size_t>(1, std::min(static_cast<size_t>(std::max(num_workers, 1)), count));
+  std::vector<std::exception_ptr> errors(num_shares);
+  const auto run_share = [&](size_t share) {
+    try {
+      work(share, count * share / num_shares, count * (share + 1) / num_shares);
+    } catch (...) {
+      errors[share] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(num_shares - 1);
+  for (size_t share = 1; share < num_shares; ++share) {
+    workers.emplace_back(run_share, share);
+  }
+  run_share(0);
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  for (const auto& error : errors) {
+    if (error) std::rethrow_exception(error);
+  }
+}
+
+std::vector<maliput_sparse::geometry::LineString3d> DecodeLineStrings(
+    const std::vector<LaneDecodePool::RawGeometry>& geometries, int num_workers) {
+  std::vector<std::vector<maliput_sparse::geometry::LineString3d>> shares(std::max(num_workers, 1));
+  RunInShares(geometries.size(), num_workers, [&](size_t share, size_t begin, size_t end) {
+    std::vector<maliput::math::Vector3> points;
+    shares[share].reserve(end - begin);
+    for (size_t i = begin; i < end; ++i) {
+      shares[share].push_back(DecodeGeometry(geometries[i], &points));
+    }
+  });
+
+  std::vector<maliput_sparse::geometry::LineString3d> line_strings;
+  line_strings.reserve(geometries.size());
+  for (auto& share : shares) {
+    std::move(share.begin(), share.end(), std::back_inserter(line_strings));
+  }
+  return line_strings;
+}
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
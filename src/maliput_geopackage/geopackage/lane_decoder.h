@@ -0,0 +1,150 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/math/vector.h>
+#include <maliput_sparse/geometry/line_string.h>
+#include <maliput_sparse/parser/lane.h>
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+/// Decodes a LINESTRINGZ and appends its points to `points`.
+///
+/// @param data Pointer to the raw column value.
+/// @param size Number of bytes available at `data`.
+/// @param is_blob True when the value is a GeoPackage binary, compact or bare WKB geometry, false when it is WKT
+///        text.
+/// @param points Output buffer the decoded points are appended to. It must not be nullptr.
+/// @throws std::runtime_error if the geometry is malformed.
+void DecodeLineStringZ(const uint8_t* data, size_t size, bool is_blob, std::vector<maliput::math::Vector3>* points);
+
+/// Decodes lane rows on a pool of worker threads.
+///
+/// The thread stepping SQLite copies each row out of the statement and hands batches of them to
+/// Submit(). Workers decode the boundaries and build maliput_sparse::parser::Lane objects without
+/// their IDs. Finish() returns them in submission order, so the outcome does not depend on thread
+/// scheduling.
+class LaneDecodePool {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(LaneDecodePool)
+
+  /// A lane boundary as stored in the database, not yet decoded.
+  struct RawGeometry {
+    /// True for BLOB values, false for WKT text.
+    bool is_blob{false};
+    /// Column bytes.
+    std::string bytes;
+    /// A boundary decoded beforehand, shared with other lanes, which is copied instead of decoding `bytes`.
+    /// It must outlive the pool.
+    const maliput_sparse::geometry::LineString3d* shared{nullptr};
+  };
+
+  /// A lane row copied out of SQLite.
+  struct RawLane {
+    /// Interned lane ID, see IdTable. It is passed through untouched.
+    uint32_t lane_index;
+    RawGeometry left;
+    RawGeometry right;
+  };
+
+  /// A decoded lane. Its ID is left empty; the caller knows it from `lane_index`.
+  struct DecodedLane {
+    uint32_t lane_index;
+    maliput_sparse::parser::Lane lane;
+  };
+
+  /// Constructs the pool and starts its workers.
+  /// @param num_workers Number of decoding threads. It must be positive.
+  explicit LaneDecodePool(int num_workers);
+
+  /// Stops and joins the workers.
+  ~LaneDecodePool();
+
+  /// Queues `batch` for decoding, blocking while the queue is full.
+  /// @returns False when a worker already failed, in which case the caller should stop reading rows.
+  bool Submit(std::vector<RawLane> batch);
+
+  /// Waits for every submitted batch to be decoded and joins the workers.
+  /// @returns The decoded lanes in submission order.
+  /// @throws The first exception raised by a worker, if any.
+  std::vector<DecodedLane> Finish();
+
+ private:
+  // A queued batch and the slot its results are written to.
+  struct Task {
+    std::vector<RawLane> batch;
+    std::vector<DecodedLane>* results;
+  };
+
+  // Worker loop: pops tasks until the queue is closed and drained.
+  void Run();
+
+  // Stops accepting tasks and joins the workers.
+  void Close();
+
+  const size_t max_queued_tasks_;
+  std::mutex mutex_;
+  std::condition_variable task_available_;
+  std::condition_variable space_available_;
+  std::deque<Task> tasks_;
+  // One slot per submitted batch. A deque keeps references stable while slots are appended.
+  std::deque<std::vector<DecodedLane>> results_;
+  bool closed_{false};
+  std::exception_ptr error_;
+  std::vector<std::thread> workers_;
+};
+
+/// Splits [0, `count`) into at most `num_workers` contiguous shares and runs `work(share, begin, end)` on each of
+/// them, on its own thread. The calling thread runs share 0.
+/// @throws The exception raised by the lowest failing share, if any, once every share is done.
+void RunInShares(size_t count, int num_workers,
+                 const std::function<void(size_t share, size_t begin, size_t end)>& work);
+
+/// Decodes `geometries` on `num_workers` threads, each taking a contiguous share of them.
+/// @returns The decoded line strings, in the order of `geometries`.
+/// @throws std::runtime_error if a geometry is malformed.
+std::vector<maliput_sparse::geometry::LineString3d> DecodeLineStrings(
+    const std::vector<LaneDecodePool::RawGeometry>& geometries, int num_workers);
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
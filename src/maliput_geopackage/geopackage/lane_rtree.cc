@@ -0,0 +1,118 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/geopackage/lane_rtree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+namespace {
+
+/// @returns The smallest extent covering `a` and `b`.
+LaneExtent Union(const LaneExtent& a, const LaneExtent& b) {
+  return {std::min(a.min_x, b.min_x), std::max(a.max_x, b.max_x), std::min(a.min_y, b.min_y),
+          std::max(a.max_y, b.max_y), std::min(a.min_z, b.min_z), std::max(a.max_z, b.max_z)};
+}
+
+/// Orders `entries` so that every run of LaneRTree::kNodeCapacity consecutive entries makes a compact node: entries
+/// are sorted by the x center of their extent into vertical slices, and each slice by the y center.
+template <typename ExtentOf>
+void SortTileRecursive(std::vector<uint32_t>* entries, ExtentOf extent_of) {
+  const auto center_x = [&](uint32_t entry) { return extent_of(entry).min_x + extent_of(entry).max_x; };
+  const auto center_y = [&](uint32_t entry) { return extent_of(entry).min_y + extent_of(entry).max_y; };
+  std::sort(entries->begin(), entries->end(), [&](uint32_t a, uint32_t b) { return center_x(a) < center_x(b); });
+  const size_t num_nodes = (entries->size() + LaneRTree::kNodeCapacity - 1) / LaneRTree::kNodeCapacity;
+  const size_t num_slices = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(num_nodes))));
+  const size_t slice_size = ((num_nodes + num_slices - 1) / num_slices) * LaneRTree::kNodeCapacity;
+  for (size_t begin = 0; begin < entries->size(); begin += slice_size) {
+    const auto end = entries->begin() + std::min(begin + slice_size, entries->size());
+    std::sort(entries->begin() + begin, end, [&](uint32_t a, uint32_t b) { return center_y(a) < center_y(b); });
+  }
+}
+
+}  // namespace
+
+LaneRTree::LaneRTree(std::vector<LaneExtent> extents) : extents_(std::move(extents)) {
+  if (extents_.empty()) return;
+
+  // Leaves over the items.
+  items_.resize(extents_.size());
+  std::iota(items_.begin(), items_.end(), 0);
+  SortTileRecursive(&items_, [this](uint32_t item) -> const LaneExtent& { return extents_[item]; });
+  for (size_t begin = 0; begin < items_.size(); begin += kNodeCapacity) {
+    const size_t end = std::min(begin + kNodeCapacity, items_.size());
+    Node node{extents_[items_[begin]], static_cast<uint32_t>(begin), static_cast<uint32_t>(end), true};
+    for (size_t i = begin + 1; i < end; ++i) node.extent = Union(node.extent, extents_[items_[i]]);
+    nodes_.push_back(node);
+  }
+
+  // Inner levels, until a single root is left. Nodes of the level below are reordered so that the children of
+  // every new node are contiguous; their own children do not move.
+  std::vector<uint32_t> order;
+  std::vector<Node> level;
+  for (size_t level_begin = 0; nodes_.size() - level_begin > 1;) {
+    const size_t level_end = nodes_.size();
+    order.resize(level_end - level_begin);
+    std::iota(order.begin(), order.end(), static_cast<uint32_t>(level_begin));
+    SortTileRecursive(&order, [this](uint32_t node) -> const LaneExtent& { return nodes_[node].extent; });
+    level.clear();
+    for (const uint32_t node : order) level.push_back(nodes_[node]);
+    std::copy(level.begin(), level.end(), nodes_.begin() + level_begin);
+
+    for (size_t begin = level_begin; begin < level_end; begin += kNodeCapacity) {
+      const size_t end = std::min(begin + kNodeCapacity, level_end);
+      Node node{nodes_[begin].extent, static_cast<uint32_t>(begin), static_cast<uint32_t>(end), false};
+      for (size_t i = begin + 1; i < end; ++i) node.extent = Union(node.extent, nodes_[i].extent);
+      nodes_.push_back(node);
+    }
+    level_begin = level_end;
+  }
+}
+
+void LaneRTree::VisitByDistance(const maliput::math::Vector3& point,
+                                const std::function<bool(uint32_t item, double distance)>& visit) const {
+  std::vector<QueueEntry> queue;
+  queue.reserve(4 * kNodeCapacity);
+  VisitByDistance(point, visit, &queue);
+}
+
+double Distance(const LaneExtent& extent, const maliput::math::Vector3& point) {
+  const double dx = std::max({extent.min_x - point.x(), 0., point.x() - extent.max_x});
+  const double dy = std::max({extent.min_y - point.y(), 0., point.y() - extent.max_y});
+  const double dz = std::max({extent.min_z - point.z(), 0., point.z() - extent.max_z});
+  return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
@@ -0,0 +1,127 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <maliput/math/vector.h>
+
+#include "maliput_geopackage/geopackage/spatial_index.h"
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+/// In-memory R-tree over lane extents, bulk-loaded once with the Sort-Tile-Recursive algorithm and then
+/// immutable, so it can be queried from several threads at once.
+class LaneRTree {
+ public:
+  /// Maximum number of children of a node.
+  static constexpr size_t kNodeCapacity{16};
+
+  /// Builds the tree over `extents`. Item `i` of the tree is `extents[i]`.
+  explicit LaneRTree(std::vector<LaneExtent> extents);
+
+  /// @returns The number of items.
+  size_t size() const { return extents_.size(); }
+
+  /// @returns The extent of item `item`.
+  const LaneExtent& extent(uint32_t item) const { return extents_[item]; }
+
+  /// Entry of the VisitByDistance() search queue: a node, or an item when `item` is true, at `distance` from the
+  /// queried point.
+  struct QueueEntry {
+    double distance;
+    uint32_t index;
+    bool item;
+  };
+
+  /// Calls `visit(item, distance)` with every item and its distance to `point`, in increasing distance order,
+  /// until `visit` returns false. The distance is 0 for items whose extent contains `point`.
+  /// @param queue Buffer of the search queue. It is cleared first and keeps its capacity, so searches reusing it
+  ///        stop allocating once it fits them.
+  template <typename Visit>
+  void VisitByDistance(const maliput::math::Vector3& point, Visit&& visit, std::vector<QueueEntry>* queue) const;
+
+  /// Same as above, with a queue of its own.
+  void VisitByDistance(const maliput::math::Vector3& point,
+                       const std::function<bool(uint32_t item, double distance)>& visit) const;
+
+ private:
+  /// A node covers entries [begin, end) of the level below: nodes_ for inner nodes, items_ for leaves.
+  struct Node {
+    LaneExtent extent;
+    uint32_t begin;
+    uint32_t end;
+    bool leaf;
+  };
+
+  std::vector<LaneExtent> extents_;
+  /// Items in leaf order.
+  std::vector<uint32_t> items_;
+  /// Nodes of every level, leaves first. The root is the last one.
+  std::vector<Node> nodes_;
+};
+
+/// @returns The Euclidean distance from `point` to `extent`, 0 when `extent` contains it.
+double Distance(const LaneExtent& extent, const maliput::math::Vector3& point);
+
+template <typename Visit>
+void LaneRTree::VisitByDistance(const maliput::math::Vector3& point, Visit&& visit,
+                                std::vector<QueueEntry>* queue) const {
+  queue->clear();
+  if (nodes_.empty()) return;
+
+  // Best-first search: nodes and items share one queue ordered by distance, so an item is popped only once
+  // every entry that could be closer was expanded.
+  const auto farther = [](const QueueEntry& a, const QueueEntry& b) { return a.distance > b.distance; };
+  queue->push_back({Distance(nodes_.back().extent, point), static_cast<uint32_t>(nodes_.size() - 1), false});
+  while (!queue->empty()) {
+    std::pop_heap(queue->begin(), queue->end(), farther);
+    const QueueEntry entry = queue->back();
+    queue->pop_back();
+    if (entry.item) {
+      if (!visit(entry.index, entry.distance)) return;
+      continue;
+    }
+    const Node& node = nodes_[entry.index];
+    for (uint32_t i = node.begin; i < node.end; ++i) {
+      const uint32_t index = node.leaf ? items_[i] : i;
+      queue->push_back({Distance(node.leaf ? extents_[index] : nodes_[index].extent, point), index, node.leaf});
+      std::push_heap(queue->begin(), queue->end(), farther);
+    }
+  }
+}
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
@@ -0,0 +1,132 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/geopackage/mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+MappedFile::MappedFile(const std::string& file_path) {
+  const int fd = ::open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throw std::runtime_error("Failed to open '" + file_path + "': " + std::strerror(errno));
+  }
+  try {
+    Map(fd, "'" + file_path + "'");
+  } catch (...) {
+    ::close(fd);
+    throw;
+  }
+  // The mapping stays valid once the descriptor is closed.
+  ::close(fd);
+}
+
+MappedFile::MappedFile(int fd) { Map(fd, "file descriptor " + std::to_string(fd)); }
+
+void MappedFile::Map(int fd, const std::string& description) {
+  struct stat file_stat;
+  if (::fstat(fd, &file_stat) != 0) {
+    const std::string error = std::strerror(errno);
+    throw std::runtime_error("Failed to stat " + description + ": " + error);
+  }
+  size_ = static_cast<size_t>(file_stat.st_size);
+  if (size_ > 0) {
+    void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+      const std::string error = std::strerror(errno);
+      throw std::runtime_error("Failed to map " + description + ": " + error);
+    }
+    data_ = static_cast<const uint8_t*>(mapping);
+  }
+}
+
+MappedFile::~MappedFile() {
+  if (data_) {
+    ::munmap(const_cast<uint8_t*>(data_), size_);
+  }
+}
+
+void PrefetchFile(const std::string& file_path) {
+#if defined(POSIX_FADV_WILLNEED)
+  const int fd = ::open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return;
+  }
+  // Length 0 covers the whole file. The read-ahead keeps going once the descriptor is closed.
+  ::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+  ::close(fd);
+#else
+  (void)file_path;
+#endif
+}
+
+uint64_t Hash64(const void* data, size_t size, uint64_t seed) {
+  // Four independent multiply-xorshift lanes hide the multiplication latency.
+  constexpr uint64_t kMultiplier{0x9e3779b97f4a7c15ull};
+  const auto mix = [](uint64_t h, uint64_t word) {
+    h ^= word;
+    h *= kMultiplier;
+    return h ^ (h >> 32);
+  };
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  uint64_t lanes[4] = {seed ^ 0x243f6a8885a308d3ull, seed ^ 0x13198a2e03707344ull, seed ^ 0xa4093822299f31d0ull,
+                       seed ^ 0x082efa98ec4e6c89ull};
+  size_t offset{0};
+  for (; offset + 32 <= size; offset += 32) {
+    for (int i = 0; i < 4; ++i) {
+      uint64_t word;
+      std::memcpy(&word, bytes + offset + 8 * i, sizeof(word));
+      lanes[i] = mix(lanes[i], word);
+    }
+  }
+  uint64_t h = mix(mix(mix(mix(size, lanes[0]), lanes[1]), lanes[2]), lanes[3]);
+  for (; offset + 8 <= size; offset += 8) {
+    uint64_t word;
+    std::memcpy(&word, bytes + offset, sizeof(word));
+    h = mix(h, word);
+  }
+  if (offset < size) {
+    uint64_t word{0};
+    std::memcpy(&word, bytes + offset, size - offset);
+    h = mix(h, word);
+  }
+  return mix(h, 0);
+}
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
@@ -0,0 +1,81 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <maliput/common/maliput_copyable.h>
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+/// Read-only memory mapping of a whole file.
+class MappedFile {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(MappedFile)
+
+  /// Maps `file_path` into memory.
+  /// @throws std::runtime_error if the file cannot be opened or mapped.
+  explicit MappedFile(const std::string& file_path);
+
+  /// Maps the whole file open at `fd`, e.g. a shared memory object received from another process.
+  /// `fd` is not closed, and may be closed while the mapping is alive.
+  /// @throws std::runtime_error if `fd` cannot be mapped.
+  explicit MappedFile(int fd);
+
+  ~MappedFile();
+
+  /// @returns The first byte of the file, or nullptr when the file is empty.
+  const uint8_t* data() const { return data_; }
+
+  /// @returns The size of the file in bytes.
+  size_t size() const { return size_; }
+
+ private:
+  // Maps the file open at `fd`, naming it `description` in errors.
+  void Map(int fd, const std::string& description);
+
+  const uint8_t* data_{nullptr};
+  size_t size_{0};
+};
+
+/// Asks the kernel to start reading the whole file at `file_path` into the page cache, so later reads
+/// through any file descriptor or mapping find it there. This is only a hint: failures are ignored and
+/// platforms without `posix_fadvise` do nothing.
+void PrefetchFile(const std::string& file_path);
+
+/// Computes a 64-bit non-cryptographic hash of `size` bytes at `data`, reading eight bytes at a time.
+/// It detects accidental changes, it is not meant to resist deliberate collisions.
+uint64_t Hash64(const void* data, size_t size, uint64_t seed = 0);
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
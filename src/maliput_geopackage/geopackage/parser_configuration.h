@@ -0,0 +1,162 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+/// Axis-aligned 2D region of the inertial frame, in meters.
+struct Region2d {
+  double min_x{0.};
+  double min_y{0.};
+  double max_x{0.};
+  double max_y{0.};
+};
+
+/// How connectivity is handled for lanes whose branch points reach outside of a loaded region or of the
+/// loaded junctions.
+enum class BoundaryPolicy {
+  /// Only the selected lanes are loaded. Branch point and adjacency entries referencing any other lane
+  /// are dropped, so boundary lanes become dead ends.
+  kTruncate,
+  /// Lanes sharing a branch point with a selected lane are loaded as well, and every loaded segment is
+  /// completed with all its lanes. Connectivity past those extra lanes is truncated.
+  kClosure,
+};
+
+/// How lane boundaries are post-processed once decoded.
+enum class BoundarySimplification {
+  /// Boundaries are kept as stored.
+  kNone,
+  /// Each boundary is simplified on its own, see SimplifyPolyline().
+  kSimplify,
+  /// Each boundary is simplified, then the left and right boundaries of every lane are resampled to matching
+  /// vertices, see MatchVertices(). Lanes referencing a row of the `boundaries` table are not resampled, so that
+  /// the boundary they share with their neighbour stays identical in both.
+  kSimplifyAndMatch,
+};
+
+/// Progress of a GeoPackageParser, see ParserConfiguration::on_progress.
+struct ParseProgress {
+  /// Name of the running phase, as in ParserStats::phases.
+  const char* phase;
+  /// Rows read from the GeoPackage so far, over every table.
+  int64_t rows;
+
+  /// Number of rows between two reports within a phase.
+  static constexpr int64_t kReportInterval{1024};
+};
+
+/// Holds the options that tune how a GeoPackageParser reads a GeoPackage.
+struct ParserConfiguration {
+  /// Number of worker threads decoding lane geometry while the calling thread steps SQLite.
+  /// A value of 0 uses one worker per hardware thread; 1 (or less) decodes every lane on the calling thread.
+  int parser_threads{1};
+
+  /// When set, only lanes whose extent intersects this region are loaded. The region is in the backend frame,
+  /// the one of the coordinates stored in the GeoPackage.
+  std::optional<Region2d> load_region{std::nullopt};
+
+  /// When not empty, only lanes of these junctions are loaded. Combined with `load_region`, only lanes of
+  /// these junctions intersecting the region are.
+  std::vector<std::string> junction_ids{};
+
+  /// When not empty, only lanes whose `lane_type` is one of these, e.g. "driving", are loaded. This also
+  /// applies to the lanes added by `expansion_hops` and `boundary_policy`.
+  std::vector<std::string> lane_types{};
+
+  /// Number of branch point hops the lanes selected by `load_region` and `junction_ids` are expanded by,
+  /// before `boundary_policy` applies. 0 does not expand the selection.
+  int expansion_hops{0};
+
+  /// Connectivity handling at the border of the lanes selected by `load_region`, `junction_ids` and
+  /// `expansion_hops`.
+  BoundaryPolicy boundary_policy{BoundaryPolicy::kTruncate};
+
+  /// When true and the GeoPackage has no `rtree_lanes` table, the lane spatial index is built and written
+  /// back to the file before loading, so that later region loads of the same file can use it.
+  bool build_spatial_index{false};
+
+  /// When true, the parsed junctions and connections are cached in a binary snapshot, and later loads of the
+  /// same, unchanged GeoPackage with the same options map the snapshot instead of querying SQLite.
+  /// A missing, stale or corrupt snapshot falls back to parsing the GeoPackage, and is then rewritten.
+  bool use_snapshot_cache{false};
+
+  /// Directory holding the snapshots. When empty, each snapshot is written next to its GeoPackage.
+  std::string snapshot_cache_dir{};
+
+  /// When true, the GeoPackage is opened with the SQLite `immutable` URI parameter, which skips file locking and
+  /// change detection. Only safe when nothing modifies the file while it is loaded.
+  bool sqlite_immutable{false};
+
+  /// Maximum number of bytes of the GeoPackage SQLite reads through a memory mapping (`PRAGMA mmap_size`),
+  /// capped by the SQLite build. 0 disables memory-mapped I/O.
+  int64_t sqlite_mmap_size{0};
+
+  /// Size of the SQLite page cache in KiB (`PRAGMA cache_size`). 0 keeps the SQLite default.
+  int64_t sqlite_cache_size_kib{0};
+
+  /// When true, the kernel is asked to read the GeoPackage (or its snapshot) ahead into the page cache
+  /// before it is queried, overlapping cold-cache I/O with parsing.
+  bool read_ahead{false};
+
+  /// Post-processing of the decoded lane boundaries. It runs on `parser_threads` threads.
+  BoundarySimplification boundary_simplification{BoundarySimplification::kNone};
+
+  /// Maximum distance, in meters, between a simplified boundary and the stored one. The RoadNetwork builder sets it
+  /// to the RoadGeometry linear tolerance.
+  double simplification_tolerance{0.};
+
+  /// When true, the centerlines stored in the optional `lanes.centerline` column are read along with their arc
+  /// lengths, see GeoPackageParser::centerlines(). Off by default, and not exposed as a RoadNetwork builder key.
+  ///
+  /// Stored centerlines are not used to build lanes nor the RoadPositionIndex: maliput_sparse always derives the
+  /// centerline of a lane from its boundaries, so they do not make a load any faster and only serve callers of the
+  /// parser. Snapshots do not hold them, so `use_snapshot_cache` is ignored then.
+  bool read_centerlines{false};
+
+  /// When set, called on the parsing thread as every phase starts and every ParseProgress::kReportInterval rows.
+  std::function<void(const ParseProgress&)> on_progress{};
+
+  /// When set, polled between phases and rows. Once it is true, the parser closes the GeoPackage and throws
+  /// ParseCancelled.
+  std::shared_ptr<const std::atomic<bool>> cancelled{};
+};
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
@@ -0,0 +1,148 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/geopackage/polyline_simplifier.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+namespace {
+
+using maliput::math::Vector3;
+
+// Normalized arc lengths closer than this are paired by MatchVertices().
+constexpr double kArcLengthPairingTolerance{1e-9};
+
+// @returns The squared distance from `p` to the segment [`a`, `b`].
+double SquaredDistanceToSegment(const Vector3& p, const Vector3& a, const Vector3& b) {
+  const Vector3 ab = b - a;
+  const Vector3 ap = p - a;
+  const double length_squared = ab.dot(ab);
+  if (length_squared == 0.) return ap.dot(ap);
+  const double t = std::clamp(ap.dot(ab) / length_squared, 0., 1.);
+  const Vector3 d = ap - t * ab;
+  return d.dot(d);
+}
+
+// @returns The arc length at every vertex of `points`, divided by the total length. A polyline of zero length is
+// parameterized by vertex index instead.
+std::vector<double> NormalizedArcLengths(const std::vector<Vector3>& points) {
+  std::vector<double> s(points.size(), 0.);
+  for (size_t i = 1; i < points.size(); ++i) {
+    s[i] = s[i - 1] + (points[i] - points[i - 1]).norm();
+  }
+  const double length = s.back();
+  for (size_t i = 0; i < s.size(); ++i) {
+    s[i] = length > 0. ? s[i] / length : static_cast<double>(i) / static_cast<double>(s.size() - 1);
+  }
+  s.back() = 1.;
+  return s;
+}
+
+// @returns The point of the polyline `points`, parameterized by `s`, at normalized arc length `t`, which lies in
+// segment [`index` - 1, `index`].
+Vector3 Interpolate(const std::vector<Vector3>& points, const std::vector<double>& s, size_t index, double t) {
+  const double span = s[index] - s[index - 1];
+  const double ratio = span > 0. ? (t - s[index - 1]) / span : 0.;
+  return points[index - 1] + ratio * (points[index] - points[index - 1]);
+}
+
+}  // namespace
+
+void SimplifyPolyline(const std::vector<Vector3>& points, double tolerance, std::vector<Vector3>* simplified) {
+  simplified->clear();
+  if (points.size() < 3) {
+    simplified->assign(points.begin(), points.end());
+    return;
+  }
+  const double tolerance_squared = tolerance > 0. ? tolerance * tolerance : 0.;
+  std::vector<char> keep(points.size(), 0);
+  keep.front() = 1;
+  keep.back() = 1;
+  // Ranges [first, last] whose inner points are still to be checked. An explicit stack bounds the memory used by
+  // long, noisy polylines.
+  std::vector<std::pair<size_t, size_t>> ranges{{0, points.size() - 1}};
+  while (!ranges.empty()) {
+    const auto [first, last] = ranges.back();
+    ranges.pop_back();
+    double max_distance_squared{-1.};
+    size_t farthest{first};
+    for (size_t i = first + 1; i < last; ++i) {
+      const double distance_squared = SquaredDistanceToSegment(points[i], points[first], points[last]);
+      if (distance_squared > max_distance_squared) {
+        max_distance_squared = distance_squared;
+        farthest = i;
+      }
+    }
+    if (farthest != first && max_distance_squared > tolerance_squared) {
+      keep[farthest] = 1;
+      ranges.emplace_back(first, farthest);
+      ranges.emplace_back(farthest, last);
+    }
+  }
+  for (size_t i = 0; i < points.size(); ++i) {
+    if (keep[i]) simplified->push_back(points[i]);
+  }
+}
+
+void MatchVertices(std::vector<Vector3>* left, std::vector<Vector3>* right) {
+  const std::vector<double> left_s = NormalizedArcLengths(*left);
+  const std::vector<double> right_s = NormalizedArcLengths(*right);
+  std::vector<Vector3> left_matched;
+  std::vector<Vector3> right_matched;
+  left_matched.reserve(left->size() + right->size());
+  right_matched.reserve(left->size() + right->size());
+  // Merge both vertex sequences by normalized arc length. Both start at 0 and end at 1, so neither runs out
+  // before the other.
+  size_t l{0};
+  size_t r{0};
+  while (l < left->size() && r < right->size()) {
+    if (std::abs(left_s[l] - right_s[r]) < kArcLengthPairingTolerance) {
+      left_matched.push_back((*left)[l++]);
+      right_matched.push_back((*right)[r++]);
+    } else if (left_s[l] < right_s[r]) {
+      left_matched.push_back((*left)[l]);
+      right_matched.push_back(Interpolate(*right, right_s, r, left_s[l]));
+      ++l;
+    } else {
+      left_matched.push_back(Interpolate(*left, left_s, l, right_s[r]));
+      right_matched.push_back((*right)[r]);
+      ++r;
+    }
+  }
+  *left = std::move(left_matched);
+  *right = std::move(right_matched);
+}
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
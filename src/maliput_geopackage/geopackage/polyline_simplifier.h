@@ -0,0 +1,64 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <vector>
+
+#include <maliput/math/vector.h>
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+/// Simplifies the polyline through `points` with the Douglas-Peucker algorithm, in 3D.
+///
+/// The first and last points are always kept. Every dropped point lies within `tolerance` of the segment joining
+/// the kept points around it, so the simplified polyline stays within `tolerance` of the original one and the other
+/// way around.
+///
+/// @param points Polyline to simplify.
+/// @param tolerance Maximum distance, in meters, between a dropped point and the simplified polyline. A
+///        non-positive value only drops points lying exactly on the simplified polyline.
+/// @param simplified Output buffer the kept points are written to, replacing its contents. It must not be nullptr
+///        nor alias `points`.
+void SimplifyPolyline(const std::vector<maliput::math::Vector3>& points, double tolerance,
+                      std::vector<maliput::math::Vector3>* simplified);
+
+/// Resamples two polylines to the same number of vertices, pairing them by normalized arc length.
+///
+/// Both polylines get a vertex at every normalized arc length at which either of them has one. Added vertices lie on
+/// the polyline they are added to, so its shape is unchanged, and existing vertices are kept as they are. Vertices
+/// whose normalized arc lengths differ by less than 1e-9 are paired with each other.
+///
+/// @param left Polyline of at least 2 points, resampled in place. It must not be nullptr.
+/// @param right Polyline of at least 2 points, resampled in place. It must not be nullptr.
+void MatchVertices(std::vector<maliput::math::Vector3>* left, std::vector<maliput::math::Vector3>* right);
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
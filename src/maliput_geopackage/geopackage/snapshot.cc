@@ -0,0 +1,496 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/geopackage/snapshot.h"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include <maliput/common/logger.h>
+#include <maliput/math/vector.h>
+#include <maliput_sparse/geometry/line_string.h>
+
+#include "maliput_geopackage/geopackage/mapped_file.h"
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+namespace {
+
+/// Bumped whenever the snapshot layout, or the parser output for the same GeoPackage and configuration, changes.
+/// 2: lanes follow their lane_index column and may take their boundaries from the boundaries table.
+/// 3: a NULL lane_index only leaves its own segment to adjacent_lanes.
+constexpr uint32_t kSnapshotVersion{3};
+constexpr char kSnapshotMagic[8] = {'M', 'G', 'P', 'K', 'S', 'N', 'A', 'P'};
+/// Written in native byte order, so snapshots from a machine of the other endianness are rejected.
+constexpr uint32_t kByteOrderMark{0x01020304};
+/// Marks an absent optional string.
+constexpr uint32_t kNoString{std::numeric_limits<uint32_t>::max()};
+
+/// Fixed-size header preceding the payload.
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint64_t file_size;
+  int64_t mtime;
+  uint64_t content_hash;
+  uint64_t config_hash;
+  uint64_t payload_size;
+  uint64_t payload_hash;
+};
+static_assert(sizeof(Header) == 64, "Header must not have padding.");
+
+/// Appends plain values to a byte buffer.
+class Writer {
+ public:
+  template <typename T>
+  void Write(const T& value) {
+    buffer_.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  const std::string& buffer() const { return buffer_; }
+
+ private:
+  std::string buffer_;
+};
+
+/// Reads plain values from a byte range, throwing when reading past its end.
+class Reader {
+ public:
+  Reader(const uint8_t* begin, const uint8_t* end) : cursor_(begin), end_(end) {}
+
+  template <typename T>
+  T Read() {
+    if (static_cast<size_t>(end_ - cursor_) < sizeof(T)) {
+      throw std::runtime_error("Truncated snapshot.");
+    }
+    T value;
+    std::memcpy(&value, cursor_, sizeof(T));
+    cursor_ += sizeof(T);
+    return value;
+  }
+
+  std::string ReadBytes(size_t size) {
+    const uint8_t* bytes = Skip(size);
+    return std::string(reinterpret_cast<const char*>(bytes), size);
+  }
+
+  /// Moves past the next `size` bytes without copying them.
+  /// @returns The first of them.
+  const uint8_t* Skip(size_t size) {
+    if (static_cast<size_t>(end_ - cursor_) < size) {
+      throw std::runtime_error("Truncated snapshot.");
+    }
+    const uint8_t* bytes = cursor_;
+    cursor_ += size;
+    return bytes;
+  }
+
+  /// @returns A `count` element sequence that fits in the remaining bytes, given each element takes at least
+  /// `min_element_size` bytes.
+  uint64_t ReadCount(size_t min_element_size) {
+    const uint64_t count = Read<uint64_t>();
+    if (count > static_cast<size_t>(end_ - cursor_) / min_element_size) {
+      throw std::runtime_error("Invalid element count in snapshot.");
+    }
+    return count;
+  }
+
+  bool AtEnd() const { return cursor_ == end_; }
+
+ private:
+  const uint8_t* cursor_;
+  const uint8_t* end_;
+};
+
+/// Assigns a dense index to every distinct string, so IDs repeated in lane ends and connections are stored once.
+class StringTable {
+ public:
+  uint32_t Intern(const std::string& value) {
+    const auto [it, inserted] = indices_.emplace(value, static_cast<uint32_t>(strings_.size()));
+    if (inserted) {
+      strings_.push_back(&it->first);
+    }
+    return it->second;
+  }
+
+  void Write(Writer* writer) const {
+    writer->Write<uint64_t>(strings_.size());
+    for (const std::string* value : strings_) {
+      writer->Write<uint32_t>(static_cast<uint32_t>(value->size()));
+      for (char c : *value) {
+        writer->Write(c);
+      }
+    }
+  }
+
+ private:
+  std::unordered_map<std::string, uint32_t> indices_;
+  std::vector<const std::string*> strings_;
+};
+
+uint8_t EncodeWhich(maliput_sparse::parser::LaneEnd::Which end) {
+  return end == maliput_sparse::parser::LaneEnd::Which::kStart ? 0 : 1;
+}
+
+maliput_sparse::parser::LaneEnd::Which DecodeWhich(uint8_t end) {
+  switch (end) {
+    case 0:
+      return maliput_sparse::parser::LaneEnd::Which::kStart;
+    case 1:
+      return maliput_sparse::parser::LaneEnd::Which::kFinish;
+    default:
+      throw std::runtime_error("Invalid lane end in snapshot.");
+  }
+}
+
+/// @returns `value` as 16 hexadecimal digits.
+std::string ToHex(uint64_t value) {
+  char buffer[17];
+  std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(value));
+  return buffer;
+}
+
+/// Serializes the payload: string table, flat point array, junction tree and connections.
+std::string SerializePayload(
+    const std::unordered_map<maliput_sparse::parser::Junction::Id, maliput_sparse::parser::Junction>& junctions,
+    const std::vector<maliput_sparse::parser::Connection>& connections) {
+  StringTable strings;
+  Writer points;
+  uint64_t num_points{0};
+  Writer tree;
+
+  const auto write_line_string = [&](const maliput_sparse::geometry::LineString3d& line_string) {
+    tree.Write<uint64_t>(num_points);
+    tree.Write<uint64_t>(line_string.size());
+    for (const auto& point : line_string) {
+      points.Write(point.x());
+      points.Write(point.y());
+      points.Write(point.z());
+    }
+    num_points += line_string.size();
+  };
+  const auto write_lane_ends = [&](const std::unordered_map<maliput_sparse::parser::Lane::Id,
+                                                            maliput_sparse::parser::LaneEnd>& lane_ends) {
+    tree.Write<uint64_t>(lane_ends.size());
+    for (const auto& [lane_id, lane_end] : lane_ends) {
+      tree.Write(strings.Intern(lane_id));
+      tree.Write(strings.Intern(lane_end.lane_id));
+      tree.Write(EncodeWhich(lane_end.end));
+    }
+  };
+
+  tree.Write<uint64_t>(junctions.size());
+  for (const auto& [junction_id, junction] : junctions) {
+    tree.Write(strings.Intern(junction_id));
+    tree.Write<uint64_t>(junction.segments.size());
+    for (const auto& [segment_id, segment] : junction.segments) {
+      tree.Write(strings.Intern(segment_id));
+      tree.Write<uint64_t>(segment.lanes.size());
+      for (const auto& lane : segment.lanes) {
+        tree.Write(strings.Intern(lane.id));
+        tree.Write(lane.left_lane_id.has_value() ? strings.Intern(lane.left_lane_id.value()) : kNoString);
+        tree.Write(lane.right_lane_id.has_value() ? strings.Intern(lane.right_lane_id.value()) : kNoString);
+        write_line_string(lane.left);
+        write_line_string(lane.right);
+        write_lane_ends(lane.successors);
+        write_lane_ends(lane.predecessors);
+      }
+    }
+  }
+  tree.Write<uint64_t>(connections.size());
+  for (const auto& connection : connections) {
+    tree.Write(strings.Intern(connection.from.lane_id));
+    tree.Write(EncodeWhich(connection.from.end));
+    tree.Write(strings.Intern(connection.to.lane_id));
+    tree.Write(EncodeWhich(connection.to.end));
+  }
+
+  Writer payload;
+  strings.Write(&payload);
+  payload.Write<uint64_t>(num_points);
+  return payload.buffer() + points.buffer() + tree.buffer();
+}
+
+/// Rebuilds junctions and connections from `payload`.
+/// @throws std::runtime_error if the payload is malformed.
+void DeserializePayload(
+    Reader* payload,
+    std::unordered_map<maliput_sparse::parser::Junction::Id, maliput_sparse::parser::Junction>* junctions,
+    std::vector<maliput_sparse::parser::Connection>* connections) {
+  std::vector<std::string> strings(payload->ReadCount(sizeof(uint32_t)));
+  for (auto& value : strings) {
+    value = payload->ReadBytes(payload->Read<uint32_t>());
+  }
+  const auto read_string = [&]() -> const std::string& {
+    const uint32_t index = payload->Read<uint32_t>();
+    if (index >= strings.size()) {
+      throw std::runtime_error("Invalid string index in snapshot.");
+    }
+    return strings[index];
+  };
+  const auto read_optional_string = [&]() -> std::optional<std::string> {
+    const uint32_t index = payload->Read<uint32_t>();
+    if (index == kNoString) {
+      return std::nullopt;
+    }
+    if (index >= strings.size()) {
+      throw std::runtime_error("Invalid string index in snapshot.");
+    }
+    return strings[index];
+  };
+
+  // Points stay in the mapped payload; each line string decodes its own range through a single reused buffer, so
+  // the geometry is not held twice.
+  constexpr size_t kPointSize{3 * sizeof(double)};
+  const uint64_t num_points = payload->ReadCount(kPointSize);
+  const uint8_t* point_bytes = payload->Skip(num_points * kPointSize);
+  std::vector<maliput::math::Vector3> line_points;
+  const auto read_line_string = [&]() {
+    const uint64_t first = payload->Read<uint64_t>();
+    const uint64_t count = payload->Read<uint64_t>();
+    if (first > num_points || count > num_points - first) {
+      throw std::runtime_error("Invalid point range in snapshot.");
+    }
+    line_points.clear();
+    line_points.reserve(count);
+    double xyz[3];
+    for (const uint8_t* point = point_bytes + first * kPointSize; point != point_bytes + (first + count) * kPointSize;
+         point += kPointSize) {
+      std::memcpy(xyz, point, kPointSize);
+      line_points.emplace_back(xyz[0], xyz[1], xyz[2]);
+    }
+    return maliput_sparse::geometry::LineString3d(line_points);
+  };
+  const auto read_lane_ends = [&]() {
+    std::unordered_map<maliput_sparse::parser::Lane::Id, maliput_sparse::parser::LaneEnd> lane_ends;
+    const uint64_t num_lane_ends = payload->ReadCount(2 * sizeof(uint32_t) + sizeof(uint8_t));
+    for (uint64_t i = 0; i < num_lane_ends; ++i) {
+      const std::string& key = read_string();
+      const std::string& lane_id = read_string();
+      lane_ends.emplace(key, maliput_sparse::parser::LaneEnd{lane_id, DecodeWhich(payload->Read<uint8_t>())});
+    }
+    return lane_ends;
+  };
+
+  std::unordered_map<maliput_sparse::parser::Junction::Id, maliput_sparse::parser::Junction> result_junctions;
+  const uint64_t num_junctions = payload->ReadCount(sizeof(uint32_t) + sizeof(uint64_t));
+  for (uint64_t i = 0; i < num_junctions; ++i) {
+    maliput_sparse::parser::Junction junction;
+    junction.id = read_string();
+    const uint64_t num_segments = payload->ReadCount(sizeof(uint32_t) + sizeof(uint64_t));
+    for (uint64_t j = 0; j < num_segments; ++j) {
+      maliput_sparse::parser::Segment segment;
+      segment.id = read_string();
+      const uint64_t num_lanes = payload->ReadCount(3 * sizeof(uint32_t) + 6 * sizeof(uint64_t));
+      segment.lanes.reserve(num_lanes);
+      for (uint64_t k = 0; k < num_lanes; ++k) {
+        const std::string& lane_id = read_string();
+        std::optional<std::string> left_lane_id = read_optional_string();
+        std::optional<std::string> right_lane_id = read_optional_string();
+        auto left = read_line_string();
+        auto right = read_line_string();
+        auto successors = read_lane_ends();
+        auto predecessors = read_lane_ends();
+        segment.lanes.push_back(maliput_sparse::parser::Lane{lane_id, std::move(left), std::move(right),
+                                                             std::move(left_lane_id), std::move(right_lane_id),
+                                                             std::move(successors), std::move(predecessors)});
+      }
+      const auto segment_id = segment.id;
+      junction.segments.emplace(segment_id, std::move(segment));
+    }
+    const auto junction_id = junction.id;
+    result_junctions.emplace(junction_id, std::move(junction));
+  }
+
+  std::vector<maliput_sparse::parser::Connection> result_connections;
+  const uint64_t num_connections = payload->ReadCount(2 * sizeof(uint32_t) + 2 * sizeof(uint8_t));
+  result_connections.reserve(num_connections);
+  for (uint64_t i = 0; i < num_connections; ++i) {
+    maliput_sparse::parser::Connection connection;
+    connection.from.lane_id = read_string();
+    connection.from.end = DecodeWhich(payload->Read<uint8_t>());
+    connection.to.lane_id = read_string();
+    connection.to.end = DecodeWhich(payload->Read<uint8_t>());
+    result_connections.push_back(std::move(connection));
+  }
+  if (!payload->AtEnd()) {
+    throw std::runtime_error("Trailing bytes in snapshot.");
+  }
+
+  *junctions = std::move(result_junctions);
+  *connections = std::move(result_connections);
+}
+
+}  // namespace
+
+SnapshotKey ComputeSnapshotKey(const std::string& gpkg_file_path, const ParserConfiguration& config) {
+  SnapshotKey key;
+  std::error_code error;
+  const auto mtime = std::filesystem::last_write_time(gpkg_file_path, error);
+  if (error) {
+    throw std::runtime_error("Failed to read the modification time of '" + gpkg_file_path + "': " + error.message());
+  }
+  key.mtime = static_cast<int64_t>(mtime.time_since_epoch().count());
+
+  const MappedFile gpkg_file(gpkg_file_path);
+  key.file_size = gpkg_file.size();
+  key.content_hash = Hash64(gpkg_file.data(), gpkg_file.size());
+
+  // Only the options that change what is parsed; e.g. parser_threads does not.
+  Writer options;
+  options.Write<uint8_t>(config.load_region.has_value());
+  if (config.load_region.has_value()) {
+    options.Write(config.load_region->min_x);
+    options.Write(config.load_region->min_y);
+    options.Write(config.load_region->max_x);
+    options.Write(config.load_region->max_y);
+  }
+  for (const auto* ids : {&config.junction_ids, &config.lane_types}) {
+    options.Write<uint64_t>(ids->size());
+    for (const std::string& id : *ids) {
+      options.Write<uint64_t>(Hash64(id.data(), id.size()));
+    }
+  }
+  options.Write<int32_t>(config.expansion_hops);
+  options.Write(static_cast<uint8_t>(config.boundary_policy));
+  options.Write(static_cast<uint8_t>(config.boundary_simplification));
+  if (config.boundary_simplification != BoundarySimplification::kNone) {
+    options.Write(config.simplification_tolerance);
+  }
+  key.config_hash = Hash64(options.buffer().data(), options.buffer().size(), kSnapshotVersion);
+  return key;
+}
+
+std::string SnapshotPath(const std::string& gpkg_file_path, const std::string& cache_dir, const SnapshotKey& key) {
+  const std::string suffix = "." + ToHex(key.config_hash) + ".snapshot";
+  if (cache_dir.empty()) {
+    return gpkg_file_path + suffix;
+  }
+  // Tell apart GeoPackages sharing a file name in different directories.
+  std::error_code error;
+  std::string absolute_path = std::filesystem::absolute(gpkg_file_path, error).lexically_normal().string();
+  if (error) {
+    absolute_path = gpkg_file_path;
+  }
+  const std::string file_name = std::filesystem::path(gpkg_file_path).filename().string();
+  return (std::filesystem::path(cache_dir) /
+          (file_name + "." + ToHex(Hash64(absolute_path.data(), absolute_path.size())) + suffix))
+      .string();
+}
+
+void WriteSnapshot(const std::string& snapshot_path, const SnapshotKey& key,
+                   const std::unordered_map<maliput_sparse::parser::Junction::Id, maliput_sparse::parser::Junction>&
+                       junctions,
+                   const std::vector<maliput_sparse::parser::Connection>& connections) {
+  const std::string payload = SerializePayload(junctions, connections);
+  Header header;
+  std::memcpy(header.magic, kSnapshotMagic, sizeof(header.magic));
+  header.version = kSnapshotVersion;
+  header.byte_order = kByteOrderMark;
+  header.file_size = key.file_size;
+  header.mtime = key.mtime;
+  header.content_hash = key.content_hash;
+  header.config_hash = key.config_hash;
+  header.payload_size = payload.size();
+  header.payload_hash = Hash64(payload.data(), payload.size());
+
+  const std::filesystem::path parent = std::filesystem::path(snapshot_path).parent_path();
+  if (!parent.empty()) {
+    std::filesystem::create_directories(parent);
+  }
+  std::ostringstream temporary_path;
+  temporary_path << snapshot_path << ".tmp." << ::getpid() << "." << std::hash<std::thread::id>{}(std::this_thread::get_id());
+  {
+    std::ofstream file(temporary_path.str(), std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+    if (!file) {
+      file.close();
+      std::remove(temporary_path.str().c_str());
+      throw std::runtime_error("Failed to write snapshot '" + temporary_path.str() + "'.");
+    }
+  }
+  std::error_code error;
+  std::filesystem::rename(temporary_path.str(), snapshot_path, error);
+  if (error) {
+    std::remove(temporary_path.str().c_str());
+    throw std::runtime_error("Failed to move snapshot to '" + snapshot_path + "': " + error.message());
+  }
+}
+
+bool ReadSnapshot(const std::string& snapshot_path, const SnapshotKey& key,
+                  std::unordered_map<maliput_sparse::parser::Junction::Id, maliput_sparse::parser::Junction>* junctions,
+                  std::vector<maliput_sparse::parser::Connection>* connections) {
+  std::error_code error;
+  if (!std::filesystem::exists(snapshot_path, error)) {
+    return false;
+  }
+  try {
+    const MappedFile snapshot(snapshot_path);
+    Reader reader(snapshot.data(), snapshot.data() + snapshot.size());
+    const Header header = reader.Read<Header>();
+    if (std::memcmp(header.magic, kSnapshotMagic, sizeof(header.magic)) != 0 || header.version != kSnapshotVersion ||
+        header.byte_order != kByteOrderMark) {
+      maliput::log()->warn("Ignoring snapshot '", snapshot_path, "': unknown format.");
+      return false;
+    }
+    if (header.file_size != key.file_size || header.mtime != key.mtime || header.content_hash != key.content_hash ||
+        header.config_hash != key.config_hash) {
+      maliput::log()->debug("Ignoring stale snapshot '", snapshot_path, "'.");
+      return false;
+    }
+    const uint8_t* payload_begin = snapshot.data() + sizeof(Header);
+    if (header.payload_size != snapshot.size() - sizeof(Header) ||
+        header.payload_hash != Hash64(payload_begin, header.payload_size)) {
+      maliput::log()->warn("Ignoring corrupt snapshot '", snapshot_path, "'.");
+      return false;
+    }
+    Reader payload(payload_begin, payload_begin + header.payload_size);
+    DeserializePayload(&payload, junctions, connections);
+    return true;
+  } catch (const std::exception& e) {
+    maliput::log()->warn("Ignoring unreadable snapshot '", snapshot_path, "': ", e.what());
+    return false;
+  }
+}
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
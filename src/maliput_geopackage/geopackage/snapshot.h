@@ -0,0 +1,82 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <maliput_sparse/parser/connection.h>
+#include <maliput_sparse/parser/junction.h>
+
+#include "maliput_geopackage/geopackage/parser_configuration.h"
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+/// Identifies the GeoPackage contents and the parser options a snapshot was produced from.
+struct SnapshotKey {
+  /// Size of the GeoPackage file in bytes.
+  uint64_t file_size{0};
+  /// Last modification time of the GeoPackage file, in the file clock's ticks.
+  int64_t mtime{0};
+  /// Hash64() of the GeoPackage file contents.
+  uint64_t content_hash{0};
+  /// Hash of the ParserConfiguration fields that change the parsed data.
+  uint64_t config_hash{0};
+};
+
+/// Computes the key of the snapshot of `gpkg_file_path` parsed with `config`.
+/// The whole file is hashed, which costs a sequential read of it.
+/// @throws std::runtime_error if the file cannot be read.
+SnapshotKey ComputeSnapshotKey(const std::string& gpkg_file_path, const ParserConfiguration& config);
+
+/// @returns Where the snapshot of `gpkg_file_path` for `key` is stored: next to the GeoPackage when `cache_dir`
+/// is empty, in `cache_dir` otherwise. Different parser options map to different files.
+std::string SnapshotPath(const std::string& gpkg_file_path, const std::string& cache_dir, const SnapshotKey& key);
+
+/// Writes a snapshot of `junctions` and `connections` to `snapshot_path`.
+/// The file is written under a temporary name and renamed, so concurrent readers never see a partial snapshot.
+/// @throws std::runtime_error on failure.
+void WriteSnapshot(const std::string& snapshot_path, const SnapshotKey& key,
+                   const std::unordered_map<maliput_sparse::parser::Junction::Id, maliput_sparse::parser::Junction>&
+                       junctions,
+                   const std::vector<maliput_sparse::parser::Connection>& connections);
+
+/// Memory-maps the snapshot at `snapshot_path` and rebuilds `junctions` and `connections` from it.
+/// @returns False, leaving the outputs untouched, if the snapshot is missing, was produced for another key or is
+/// corrupt.
+bool ReadSnapshot(const std::string& snapshot_path, const SnapshotKey& key,
+                  std::unordered_map<maliput_sparse::parser::Junction::Id, maliput_sparse::parser::Junction>* junctions,
+                  std::vector<maliput_sparse::parser::Connection>* connections);
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
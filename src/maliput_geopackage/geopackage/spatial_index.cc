@@ -0,0 +1,140 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/geopackage/spatial_index.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <sqlite3.h>
+
+#include "maliput_geopackage/geopackage/lane_decoder.h"
+#include "maliput_geopackage/geopackage/sqlite_helpers.h"
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+LaneExtent ComputeExtent(const std::vector<maliput::math::Vector3>& points) {
+  LaneExtent extent{points.front().x(), points.front().x(), points.front().y(),
+                    points.front().y(), points.front().z(), points.front().z()};
+  for (const auto& point : points) {
+    extent.min_x = std::min(extent.min_x, point.x());
+    extent.max_x = std::max(extent.max_x, point.x());
+    extent.min_y = std::min(extent.min_y, point.y());
+    extent.max_y = std::max(extent.max_y, point.y());
+    extent.min_z = std::min(extent.min_z, point.z());
+    extent.max_z = std::max(extent.max_z, point.z());
+  }
+  return extent;
+}
+
+bool Intersects(const LaneExtent& extent, const Region2d& region) {
+  return extent.min_x <= region.max_x && extent.max_x >= region.min_x && extent.min_y <= region.max_y &&
+         extent.max_y >= region.min_y;
+}
+
+void ForEachLaneExtent(sqlite3* db, const std::function<void(const std::string&, const LaneExtent&)>& callback) {
+  // Lanes referencing a row of the boundaries table use it in place of their own boundary.
+  const bool shared_boundaries =
+      HasTable(db, "boundaries") && HasColumns(db, "lanes", {"left_boundary_id", "right_boundary_id"});
+  const char* sql = shared_boundaries
+                        ? "SELECT lanes.lane_id, COALESCE(left_shared.geometry, lanes.left_boundary), "
+                          "  COALESCE(right_shared.geometry, lanes.right_boundary) FROM lanes "
+                          "LEFT JOIN boundaries AS left_shared ON left_shared.boundary_id = lanes.left_boundary_id "
+                          "LEFT JOIN boundaries AS right_shared ON right_shared.boundary_id = lanes.right_boundary_id"
+                        : "SELECT lane_id, left_boundary, right_boundary FROM lanes";
+  sqlite3_stmt* stmt;
+  if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
+    throw std::runtime_error("Failed to query lanes table: " + std::string(sqlite3_errmsg(db)));
+  }
+  std::vector<maliput::math::Vector3> points;
+  try {
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+      if (sqlite3_column_type(stmt, 0) == SQLITE_NULL || sqlite3_column_type(stmt, 1) == SQLITE_NULL ||
+          sqlite3_column_type(stmt, 2) == SQLITE_NULL) {
+        continue;
+      }
+      points.clear();
+      for (int col : {1, 2}) {
+        const bool is_blob = sqlite3_column_type(stmt, col) == SQLITE_BLOB;
+        const void* data = is_blob ? sqlite3_column_blob(stmt, col) : sqlite3_column_text(stmt, col);
+        DecodeLineStringZ(static_cast<const uint8_t*>(data), static_cast<size_t>(sqlite3_column_bytes(stmt, col)),
+                          is_blob, &points);
+      }
+      if (points.empty()) {
+        continue;
+      }
+      callback(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0)), ComputeExtent(points));
+    }
+  } catch (...) {
+    sqlite3_finalize(stmt);
+    throw;
+  }
+  sqlite3_finalize(stmt);
+}
+
+bool HasLaneSpatialIndex(sqlite3* db) { return HasTable(db, kLaneSpatialIndexTable); }
+
+void BuildLaneSpatialIndex(sqlite3* db) {
+  Execute(db, "BEGIN IMMEDIATE");
+  sqlite3_stmt* insert_stmt{nullptr};
+  try {
+    Execute(db, std::string("CREATE VIRTUAL TABLE ") + kLaneSpatialIndexTable +
+                    " USING rtree(id, min_x, max_x, min_y, max_y, min_z, max_z, +lane_id TEXT)");
+    const std::string sql = std::string("INSERT INTO ") + kLaneSpatialIndexTable +
+                            " (min_x, max_x, min_y, max_y, min_z, max_z, lane_id) VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?7)";
+    if (sqlite3_prepare_v2(db, sql.c_str(), -1, &insert_stmt, nullptr) != SQLITE_OK) {
+      throw std::runtime_error("Failed to prepare lane spatial index insertion: " + std::string(sqlite3_errmsg(db)));
+    }
+    ForEachLaneExtent(db, [db, insert_stmt](const std::string& lane_id, const LaneExtent& extent) {
+      sqlite3_bind_double(insert_stmt, 1, extent.min_x);
+      sqlite3_bind_double(insert_stmt, 2, extent.max_x);
+      sqlite3_bind_double(insert_stmt, 3, extent.min_y);
+      sqlite3_bind_double(insert_stmt, 4, extent.max_y);
+      sqlite3_bind_double(insert_stmt, 5, extent.min_z);
+      sqlite3_bind_double(insert_stmt, 6, extent.max_z);
+      sqlite3_bind_text(insert_stmt, 7, lane_id.c_str(), static_cast<int>(lane_id.size()), SQLITE_STATIC);
+      const int rc = sqlite3_step(insert_stmt);
+      sqlite3_reset(insert_stmt);
+      if (rc != SQLITE_DONE) {
+        throw std::runtime_error("Failed to index lane '" + lane_id + "': " + std::string(sqlite3_errmsg(db)));
+      }
+    });
+    sqlite3_finalize(insert_stmt);
+    insert_stmt = nullptr;
+    Execute(db, "COMMIT");
+  } catch (...) {
+    sqlite3_finalize(insert_stmt);
+    sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr);
+    throw;
+  }
+}
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
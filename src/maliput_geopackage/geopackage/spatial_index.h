@@ -0,0 +1,87 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <maliput/math/vector.h>
+
+#include "maliput_geopackage/geopackage/parser_configuration.h"
+
+// Forward declaration for SQLite
+struct sqlite3;
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+/// Name of the SQLite R*Tree virtual table indexing lane extents.
+///
+/// It is declared as:
+/// @code{sql}
+/// CREATE VIRTUAL TABLE rtree_lanes USING rtree(id, min_x, max_x, min_y, max_y, min_z, max_z, +lane_id TEXT);
+/// @endcode
+/// `lane_id` is an auxiliary column referencing `lanes.lane_id`; `id` carries no meaning.
+static constexpr char const* kLaneSpatialIndexTable{"rtree_lanes"};
+
+/// Axis-aligned 3D extent of a lane, covering both of its boundaries.
+struct LaneExtent {
+  double min_x{0.};
+  double max_x{0.};
+  double min_y{0.};
+  double max_y{0.};
+  double min_z{0.};
+  double max_z{0.};
+};
+
+/// @returns The extent of `points`, which must not be empty.
+LaneExtent ComputeExtent(const std::vector<maliput::math::Vector3>& points);
+
+/// @returns True if the projection of `extent` onto the xy plane intersects `region`. Touching counts as intersecting.
+bool Intersects(const LaneExtent& extent, const Region2d& region);
+
+/// Decodes both boundaries of every row of the lanes table and calls `callback` with the lane ID and extent.
+/// Boundaries referenced in the optional boundaries table are read from there. Rows with a NULL lane ID or
+/// boundary are skipped.
+/// @throws std::runtime_error if the lanes table cannot be queried or a boundary is malformed.
+void ForEachLaneExtent(sqlite3* db, const std::function<void(const std::string&, const LaneExtent&)>& callback);
+
+/// @returns True if `db` holds the @ref kLaneSpatialIndexTable table.
+bool HasLaneSpatialIndex(sqlite3* db);
+
+/// Creates the @ref kLaneSpatialIndexTable table in `db` and fills it with the extent of every lane.
+/// Everything happens in a single transaction, so a failure leaves `db` untouched.
+/// @pre `db` is writable and does not hold the index yet.
+/// @throws std::runtime_error on failure.
+void BuildLaneSpatialIndex(sqlite3* db);
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
@@ -0,0 +1,92 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/geopackage/sqlite_helpers.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <sqlite3.h>
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+void Execute(sqlite3* db, const std::string& sql) {
+  char* error_msg{nullptr};
+  if (sqlite3_exec(db, sql.c_str(), nullptr, nullptr, &error_msg) != SQLITE_OK) {
+    const std::string message = error_msg ? error_msg : sqlite3_errmsg(db);
+    sqlite3_free(error_msg);
+    throw std::runtime_error("Failed to execute '" + sql + "': " + message);
+  }
+}
+
+bool HasTable(sqlite3* db, const std::string& name) {
+  const char* sql =
+      "SELECT 1 FROM sqlite_master WHERE name = ?1 "
+      "UNION ALL SELECT 1 FROM sqlite_temp_master WHERE name = ?1";
+  sqlite3_stmt* stmt;
+  if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
+    return false;
+  }
+  sqlite3_bind_text(stmt, 1, name.c_str(), -1, SQLITE_TRANSIENT);
+  const bool found = sqlite3_step(stmt) == SQLITE_ROW;
+  sqlite3_finalize(stmt);
+  return found;
+}
+
+bool HasColumns(sqlite3* db, const std::string& table, const std::vector<std::string>& columns) {
+  const std::string sql = "PRAGMA table_info(" + table + ")";
+  sqlite3_stmt* stmt;
+  if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+    return false;
+  }
+  size_t num_found{0};
+  while (sqlite3_step(stmt) == SQLITE_ROW) {
+    const char* name = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
+    if (name && std::find(columns.begin(), columns.end(), name) != columns.end()) {
+      ++num_found;
+    }
+  }
+  sqlite3_finalize(stmt);
+  return num_found == columns.size();
+}
+
+int64_t CountRows(sqlite3* db, const std::string& table) {
+  const std::string sql = "SELECT COUNT(*) FROM " + table;
+  sqlite3_stmt* stmt;
+  if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+    throw std::runtime_error("Failed to count rows of " + table + ": " + std::string(sqlite3_errmsg(db)));
+  }
+  const int64_t count = sqlite3_step(stmt) == SQLITE_ROW ? sqlite3_column_int64(stmt, 0) : 0;
+  sqlite3_finalize(stmt);
+  return count;
+}
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
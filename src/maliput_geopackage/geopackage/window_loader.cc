@@ -0,0 +1,375 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/geopackage/window_loader.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+
+#include <maliput/common/logger.h>
+
+namespace maliput_geopackage {
+namespace geopackage {
+namespace {
+
+/// Bytes assumed per lane on top of its boundary points: ids, adjacency and container overhead.
+constexpr int64_t kLaneOverheadBytes{256};
+
+/// Bytes assumed per connection on top of its lane ids.
+constexpr int64_t kConnectionOverheadBytes{96};
+
+/// Serves the junctions and connections of a window, merged from its tiles.
+class WindowParser : public maliput_sparse::parser::Parser {
+ public:
+  WindowParser(std::unordered_map<maliput_sparse::parser::Junction::Id, maliput_sparse::parser::Junction> junctions,
+               std::vector<maliput_sparse::parser::Connection> connections)
+      : junctions_(std::move(junctions)), connections_(std::move(connections)) {}
+
+ private:
+  const std::unordered_map<maliput_sparse::parser::Junction::Id, maliput_sparse::parser::Junction>& DoGetJunctions()
+      const override {
+    return junctions_;
+  }
+
+  const std::vector<maliput_sparse::parser::Connection>& DoGetConnections() const override { return connections_; }
+
+  const std::unordered_map<maliput_sparse::parser::Junction::Id, maliput_sparse::parser::Junction> junctions_;
+  const std::vector<maliput_sparse::parser::Connection> connections_;
+};
+
+/// @returns A key identifying `connection`, to drop the copies held by neighbouring tiles.
+std::string ConnectionKey(const maliput_sparse::parser::Connection& connection) {
+  std::string key = connection.from.lane_id;
+  key += '\0';
+  key += connection.from.end == maliput_sparse::parser::LaneEnd::Which::kStart ? 's' : 'f';
+  key += connection.to.lane_id;
+  key += '\0';
+  key += connection.to.end == maliput_sparse::parser::LaneEnd::Which::kStart ? 's' : 'f';
+  return key;
+}
+
+/// @returns The planar distance between `a` and `b`.
+double PlanarDistance(const maliput::math::Vector3& a, const maliput::math::Vector3& b) {
+  return std::hypot(b.x() - a.x(), b.y() - a.y());
+}
+
+}  // namespace
+
+WindowLoader::WindowLoader(ParserFactory parser_factory, const ParserConfiguration& parser_config,
+                           const WindowConfiguration& config)
+    : parser_factory_(std::move(parser_factory)),
+      parser_config_(parser_config),
+      config_(config),
+      tile_size_(config.tile_size > 0. ? config.tile_size : config.radius),
+      prefetch_distance_(config.prefetch_distance > 0. ? config.prefetch_distance : 2. * config.radius) {
+  if (!(config_.radius > 0.) || config_.tile_size < 0. || config_.prefetch_distance < 0. ||
+      config_.memory_budget_bytes < 0) {
+    throw std::runtime_error("Invalid window configuration: the radius must be positive, other sizes non-negative.");
+  }
+  prefetch_thread_ = std::thread([this]() { PrefetchLoop(); });
+}
+
+WindowLoader::~WindowLoader() {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  prefetch_cv_.notify_one();
+  prefetch_thread_.join();
+}
+
+void WindowLoader::SetRoute(std::vector<maliput::math::Vector3> route) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  route_ = std::move(route);
+  route_index_ = 0;
+  prefetch_queue_.clear();
+}
+
+void WindowLoader::AppendWindowTiles(double x, double y, std::vector<TileKey>* tiles) const {
+  const auto min_i = static_cast<int64_t>(std::floor((x - config_.radius) / tile_size_));
+  const auto max_i = static_cast<int64_t>(std::floor((x + config_.radius) / tile_size_));
+  const auto min_j = static_cast<int64_t>(std::floor((y - config_.radius) / tile_size_));
+  const auto max_j = static_cast<int64_t>(std::floor((y + config_.radius) / tile_size_));
+  for (int64_t i = min_i; i <= max_i; ++i) {
+    for (int64_t j = min_j; j <= max_j; ++j) {
+      tiles->emplace_back(i, j);
+    }
+  }
+}
+
+std::vector<WindowLoader::TileKey> WindowLoader::WindowTiles(const maliput::math::Vector3& position) const {
+  std::vector<TileKey> tiles;
+  AppendWindowTiles(position.x(), position.y(), &tiles);
+  return tiles;
+}
+
+bool WindowLoader::IsCurrentWindow(const maliput::math::Vector3& position) const {
+  const std::vector<TileKey> tiles = WindowTiles(position);
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return tiles == window_tiles_;
+}
+
+std::unique_ptr<maliput_sparse::parser::Parser> WindowLoader::Load(const maliput::math::Vector3& position) {
+  const std::vector<TileKey> tiles = WindowTiles(position);
+  {
+    // Pins the window tiles before parsing them, so they are never evicted while in use.
+    const std::lock_guard<std::mutex> lock(mutex_);
+    window_tiles_ = tiles;
+  }
+
+  std::unordered_map<maliput_sparse::parser::Junction::Id, maliput_sparse::parser::Junction> junctions;
+  std::vector<maliput_sparse::parser::Connection> connections;
+  std::unordered_set<std::string> connection_keys;
+  for (const TileKey& key : tiles) {
+    const std::shared_ptr<const Tile> tile = GetTile(key);
+    // Tiles hold whole segments, so segments found in several tiles are identical.
+    for (const auto& [junction_id, junction] : tile->junctions) {
+      const auto [it, inserted] = junctions.try_emplace(junction_id, junction);
+      if (!inserted) {
+        for (const auto& [segment_id, segment] : junction.segments) {
+          it->second.segments.try_emplace(segment_id, segment);
+        }
+      }
+    }
+    for (const auto& connection : tile->connections) {
+      if (connection_keys.insert(ConnectionKey(connection)).second) {
+        connections.push_back(connection);
+      }
+    }
+  }
+
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    EvictTiles();
+    // Only now, so prefetching does not compete with the window for the GeoPackage.
+    QueueRouteTiles(position);
+  }
+  prefetch_cv_.notify_one();
+  return std::make_unique<WindowParser>(std::move(junctions), std::move(connections));
+}
+
+void WindowLoader::Prefetch(const maliput::math::Vector3& position) {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    QueueRouteTiles(position);
+  }
+  prefetch_cv_.notify_one();
+}
+
+WindowStats WindowLoader::stats() const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  WindowStats stats = stats_;
+  stats.cached_tiles =
+      std::count_if(cache_.begin(), cache_.end(), [](const auto& key_entry) { return key_entry.second.ready; });
+  return stats;
+}
+
+std::shared_ptr<const WindowLoader::Tile> WindowLoader::GetTile(const TileKey& key) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  const auto it = cache_.find(key);
+  if (it != cache_.end()) {
+    it->second.last_use = ++use_clock_;
+    ++stats_.tile_hits;
+    const std::shared_future<std::shared_ptr<const Tile>> tile = it->second.tile;
+    lock.unlock();
+    // Waits for the prefetching thread when it is parsing this tile.
+    return tile.get();
+  }
+  std::promise<std::shared_ptr<const Tile>> promise;
+  cache_.emplace(key, CacheEntry{promise.get_future().share(), false, 0, ++use_clock_});
+  lock.unlock();
+  return ParseTile(key, &promise, false);
+}
+
+std::shared_ptr<const WindowLoader::Tile> WindowLoader::ParseTile(const TileKey& key,
+                                                                  std::promise<std::shared_ptr<const Tile>>* promise,
+                                                                  bool prefetched) {
+  auto tile = std::make_shared<Tile>();
+  try {
+    ParserConfiguration config = parser_config_;
+    config.load_region = Region2d{key.first * tile_size_, key.second * tile_size_, (key.first + 1) * tile_size_,
+                                  (key.second + 1) * tile_size_};
+    config.boundary_policy = BoundaryPolicy::kClosure;
+    config.use_snapshot_cache = false;
+    std::unique_ptr<GeoPackageParser> parser;
+    // Only the first tile builds the spatial index, other tiles wait for it.
+    std::call_once(spatial_index_once_, [&]() { parser = parser_factory_(config); });
+    if (parser == nullptr) {
+      config.build_spatial_index = false;
+      parser = parser_factory_(config);
+    }
+    tile->junctions = parser->GetJunctions();
+    tile->connections = parser->GetConnections();
+  } catch (...) {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      cache_.erase(key);
+    }
+    promise->set_exception(std::current_exception());
+    throw;
+  }
+
+  for (const auto& [junction_id, junction] : tile->junctions) {
+    for (const auto& [segment_id, segment] : junction.segments) {
+      for (const auto& lane : segment.lanes) {
+        tile->bytes += static_cast<int64_t>((lane.left.size() + lane.right.size()) * sizeof(maliput::math::Vector3)) +
+                       kLaneOverheadBytes;
+      }
+    }
+  }
+  tile->bytes += static_cast<int64_t>(tile->connections.size()) * kConnectionOverheadBytes;
+
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    CacheEntry& entry = cache_.at(key);
+    entry.ready = true;
+    entry.bytes = tile->bytes;
+    stats_.cached_bytes += tile->bytes;
+    ++stats_.tiles_loaded;
+    if (prefetched) {
+      ++stats_.tiles_prefetched;
+    }
+    EvictTiles();
+  }
+  promise->set_value(tile);
+  return tile;
+}
+
+void WindowLoader::EvictTiles() {
+  while (stats_.cached_bytes > config_.memory_budget_bytes) {
+    auto victim = cache_.end();
+    for (auto it = cache_.begin(); it != cache_.end(); ++it) {
+      if (it->second.ready && (victim == cache_.end() || it->second.last_use < victim->second.last_use) &&
+          !std::binary_search(window_tiles_.begin(), window_tiles_.end(), it->first)) {
+        victim = it;
+      }
+    }
+    if (victim == cache_.end()) {
+      // Only the current window is left.
+      return;
+    }
+    stats_.cached_bytes -= victim->second.bytes;
+    ++stats_.tiles_evicted;
+    cache_.erase(victim);
+  }
+}
+
+void WindowLoader::QueueRouteTiles(const maliput::math::Vector3& position) {
+  prefetch_queue_.clear();
+  if (route_.empty()) {
+    return;
+  }
+
+  // The pose moves forward along the route, so its closest vertex is searched from the last one onwards.
+  // A pose away from the route, e.g. after a jump, searches the whole route again.
+  const double search_distance = prefetch_distance_ + config_.radius;
+  size_t closest = route_index_;
+  double closest_distance = PlanarDistance(route_[closest], position);
+  double arc_length = 0.;
+  for (size_t i = route_index_ + 1; i < route_.size() && arc_length <= search_distance; ++i) {
+    arc_length += PlanarDistance(route_[i - 1], route_[i]);
+    const double distance = PlanarDistance(route_[i], position);
+    if (distance < closest_distance) {
+      closest = i;
+      closest_distance = distance;
+    }
+  }
+  if (closest_distance > config_.radius) {
+    for (size_t i = 0; i < route_.size(); ++i) {
+      const double distance = PlanarDistance(route_[i], position);
+      if (distance < closest_distance) {
+        closest = i;
+        closest_distance = distance;
+      }
+    }
+  }
+  route_index_ = closest;
+
+  // Samples the route ahead every half tile, so no tile along it is skipped.
+  std::vector<TileKey> tiles;
+  const double step = tile_size_ / 2.;
+  double remaining = prefetch_distance_;
+  for (size_t i = closest + 1; i < route_.size() && remaining > 0.; ++i) {
+    const maliput::math::Vector3& start = route_[i - 1];
+    const maliput::math::Vector3& end = route_[i];
+    const double length = PlanarDistance(start, end);
+    const double covered = std::min(length, remaining);
+    for (double s = std::min(step, covered); length > 0.; s = std::min(s + step, covered)) {
+      const double t = s / length;
+      AppendWindowTiles(start.x() + t * (end.x() - start.x()), start.y() + t * (end.y() - start.y()), &tiles);
+      if (s >= covered) {
+        break;
+      }
+    }
+    remaining -= length;
+  }
+
+  std::set<TileKey> queued;
+  for (const TileKey& key : tiles) {
+    if (cache_.find(key) == cache_.end() && !std::binary_search(window_tiles_.begin(), window_tiles_.end(), key) &&
+        queued.insert(key).second) {
+      prefetch_queue_.push_back(key);
+    }
+  }
+}
+
+void WindowLoader::PrefetchLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    prefetch_cv_.wait(lock, [this]() { return stop_ || !prefetch_queue_.empty(); });
+    if (stop_) {
+      return;
+    }
+    const TileKey key = prefetch_queue_.front();
+    prefetch_queue_.pop_front();
+    if (stats_.cached_bytes >= config_.memory_budget_bytes) {
+      // Prefetching more would evict tiles that may still be needed.
+      prefetch_queue_.clear();
+      continue;
+    }
+    if (cache_.find(key) != cache_.end()) {
+      continue;
+    }
+    std::promise<std::shared_ptr<const Tile>> promise;
+    cache_.emplace(key, CacheEntry{promise.get_future().share(), false, 0, ++use_clock_});
+    lock.unlock();
+    try {
+      ParseTile(key, &promise, true);
+    } catch (const std::exception& e) {
+      maliput::log()->warn("Failed to prefetch tile (", key.first, ", ", key.second, "): ", e.what());
+    }
+    lock.lock();
+  }
+}
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
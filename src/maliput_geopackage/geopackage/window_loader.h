@@ -0,0 +1,194 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/math/vector.h>
+#include <maliput_sparse/parser/connection.h>
+#include <maliput_sparse/parser/junction.h>
+#include <maliput_sparse/parser/parser.h>
+
+#include "maliput_geopackage/geopackage/geopackage_parser.h"
+#include "maliput_geopackage/geopackage/parser_configuration.h"
+#include "maliput_geopackage/geopackage/window_stats.h"
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+/// Options of a WindowLoader.
+struct WindowConfiguration {
+  /// Half the side of the square window loaded around the pose, in meters.
+  double radius{200.};
+
+  /// Side of the square tiles lanes are loaded and cached by, in meters. 0 uses `radius`.
+  double tile_size{0.};
+
+  /// Approximate number of bytes of decoded lanes to keep cached. The tiles of the current window are
+  /// always kept, so this only bounds the tiles around it.
+  int64_t memory_budget_bytes{int64_t{512} << 20};
+
+  /// Length of the route ahead of the pose whose tiles are prefetched, in meters. 0 uses twice `radius`.
+  double prefetch_distance{0.};
+};
+
+/// Loads the lanes around a moving pose, one square tile at a time.
+///
+/// Every tile is parsed on its own with ParserConfiguration::load_region set to the tile and the
+/// BoundaryPolicy::kClosure policy, so it holds whole segments and the connections among them. A window is
+/// the union of the tiles overlapping it. Parsed tiles are kept in a least-recently-used cache, so moving
+/// the window only parses the tiles it did not cover yet, and a background thread parses the tiles along
+/// the route ahead of the pose before the window reaches them.
+///
+/// Positions and routes are in the backend frame of the coordinates stored in the GeoPackage, the frame tiles are
+/// laid out in.
+///
+/// Every tile runs a region query, so the GeoPackage should have a lane spatial index or lane extent
+/// columns; see ParserConfiguration::build_spatial_index.
+class WindowLoader {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(WindowLoader)
+
+  /// Creates the parser of a tile from the configuration to parse it with.
+  using ParserFactory = std::function<std::unique_ptr<GeoPackageParser>(const ParserConfiguration&)>;
+
+  /// Identifies a tile by its column and row: tile (i, j) spans [i, i + 1) x [j, j + 1) tile sizes.
+  using TileKey = std::pair<int64_t, int64_t>;
+
+  /// Constructs a WindowLoader.
+  /// @param parser_factory Creates the parser of every tile. It is called from the calling thread and from
+  /// the prefetching thread.
+  /// @param parser_config Options tuning how tiles are parsed. Its load region, boundary policy and snapshot
+  /// cache settings are overridden for every tile.
+  /// @param config Window options.
+  /// @throws std::runtime_error if `config` holds non-positive sizes.
+  WindowLoader(ParserFactory parser_factory, const ParserConfiguration& parser_config,
+               const WindowConfiguration& config);
+
+  /// Stops the prefetching thread.
+  ~WindowLoader();
+
+  /// Sets the route the pose is expected to follow. Tiles within WindowConfiguration::prefetch_distance ahead
+  /// of the pose along `route` are prefetched. An empty route disables prefetching.
+  void SetRoute(std::vector<maliput::math::Vector3> route);
+
+  /// @returns The tiles overlapping the window around `position`, sorted.
+  std::vector<TileKey> WindowTiles(const maliput::math::Vector3& position) const;
+
+  /// @returns Whether the window around `position` covers the same tiles as the last loaded one.
+  bool IsCurrentWindow(const maliput::math::Vector3& position) const;
+
+  /// Loads the window around `position`, parsing the tiles that are not cached, and schedules the prefetch
+  /// of the route ahead of it.
+  /// @returns A parser holding the junctions and connections of the window.
+  /// @throws std::runtime_error if a tile cannot be parsed.
+  std::unique_ptr<maliput_sparse::parser::Parser> Load(const maliput::math::Vector3& position);
+
+  /// Schedules the prefetch of the route ahead of `position`, without loading its window.
+  void Prefetch(const maliput::math::Vector3& position);
+
+  /// @returns The counters so far.
+  WindowStats stats() const;
+
+ private:
+  // Junctions and connections parsed for a tile.
+  struct Tile {
+    std::unordered_map<maliput_sparse::parser::Junction::Id, maliput_sparse::parser::Junction> junctions;
+    std::vector<maliput_sparse::parser::Connection> connections;
+    int64_t bytes{0};
+  };
+
+  struct CacheEntry {
+    std::shared_future<std::shared_ptr<const Tile>> tile;
+    // Whether `tile` is ready and counted in WindowStats::cached_bytes.
+    bool ready{false};
+    // Approximate bytes of `tile` once ready.
+    int64_t bytes{0};
+    // Value of `use_clock_` when the tile was last used.
+    uint64_t last_use{0};
+  };
+
+  // @returns The tile `key`, parsing it unless it is cached or being parsed by another thread.
+  std::shared_ptr<const Tile> GetTile(const TileKey& key);
+
+  // Parses the tile `key` into a cache entry inserted by the caller. `prefetched` tells which thread parses it.
+  std::shared_ptr<const Tile> ParseTile(const TileKey& key, std::promise<std::shared_ptr<const Tile>>* promise,
+                                        bool prefetched);
+
+  // Drops least-recently-used tiles outside the current window until the cache fits the memory budget.
+  // Requires `mutex_` to be held.
+  void EvictTiles();
+
+  // Queues the tiles along the route ahead of `position` that are not cached. Requires `mutex_` to be held.
+  void QueueRouteTiles(const maliput::math::Vector3& position);
+
+  // Appends to `tiles` the tiles overlapping the window around (x, y), sorted.
+  void AppendWindowTiles(double x, double y, std::vector<TileKey>* tiles) const;
+
+  // Body of the prefetching thread.
+  void PrefetchLoop();
+
+  const ParserFactory parser_factory_;
+  const ParserConfiguration parser_config_;
+  const WindowConfiguration config_;
+  const double tile_size_;
+  const double prefetch_distance_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable prefetch_cv_;
+  std::map<TileKey, CacheEntry> cache_;
+  std::vector<TileKey> window_tiles_;
+  std::deque<TileKey> prefetch_queue_;
+  std::vector<maliput::math::Vector3> route_;
+  // Index of the route vertex closest to the last pose.
+  size_t route_index_{0};
+  uint64_t use_clock_{0};
+  WindowStats stats_{};
+  bool stop_{false};
+  // Guards the parse of the first tile, the only one allowed to build the lane spatial index.
+  std::once_flag spatial_index_once_;
+  std::thread prefetch_thread_;
+};
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
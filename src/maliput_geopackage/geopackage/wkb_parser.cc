@@ -0,0 +1,192 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/geopackage/wkb_parser.h"
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+namespace {
+
+// WKB geometry type codes for LineString with Z (and optionally M) ordinates.
+constexpr uint32_t kWkbLineStringZ{1002};
+constexpr uint32_t kWkbLineStringZM{3002};
+constexpr uint32_t kEwkbLineStringZ{0x80000002};
+constexpr uint32_t kEwkbLineStringZM{0xC0000002};
+
+// Size of the fixed part of the GeoPackage binary header: magic, version, flags and srs_id.
+constexpr size_t kGpbFixedHeaderSize{8};
+
+// Returns true if the host stores multi-byte values little-endian.
+bool IsHostLittleEndian() {
+  const uint16_t probe{1};
+  uint8_t first_byte;
+  std::memcpy(&first_byte, &probe, 1);
+  return first_byte == 1;
+}
+
+// Reads a value of type T from `data`, swapping its bytes when `swap` is true.
+template <typename T>
+T Read(const uint8_t* data, bool swap) {
+  uint8_t bytes[sizeof(T)];
+  std::memcpy(bytes, data, sizeof(T));
+  if (swap) {
+    for (size_t i = 0; i < sizeof(T) / 2; ++i) {
+      std::swap(bytes[i], bytes[sizeof(T) - 1 - i]);
+    }
+  }
+  T value;
+  std::memcpy(&value, bytes, sizeof(T));
+  return value;
+}
+
+[[noreturn]] void ThrowMalformedGpb(const std::string& reason) {
+  throw std::runtime_error("Malformed GeoPackage binary geometry: " + reason);
+}
+
+[[noreturn]] void ThrowMalformedWkb(const std::string& reason) {
+  throw std::runtime_error("Malformed WKB geometry: " + reason);
+}
+
+// Returns the number of bytes taken by the envelope for the GPB envelope contents indicator.
+size_t EnvelopeSize(int indicator) {
+  switch (indicator) {
+    case 0:
+      return 0;
+    case 1:
+      return 32;
+    case 2:
+    case 3:
+      return 48;
+    case 4:
+      return 64;
+    default:
+      ThrowMalformedGpb("invalid envelope contents indicator " + std::to_string(indicator));
+  }
+}
+
+}  // namespace
+
+bool IsGeoPackageBinary(const uint8_t* data, size_t size) {
+  return size >= 2 && data[0] == 'G' && data[1] == 'P';
+}
+
+void ParseWkbLineStringZ(const uint8_t* data, size_t size, std::vector<maliput::math::Vector3>* points) {
+  // Byte order (1) + geometry type (4) + number of points (4).
+  constexpr size_t kWkbLineStringHeaderSize{9};
+  if (size < kWkbLineStringHeaderSize) {
+    ThrowMalformedWkb("truncated header (" + std::to_string(size) + " bytes)");
+  }
+  if (data[0] > 1) {
+    ThrowMalformedWkb("invalid byte order marker " + std::to_string(data[0]));
+  }
+  const bool swap = (data[0] == 1) != IsHostLittleEndian();
+
+  const uint32_t type = Read<uint32_t>(data + 1, swap);
+  size_t dimensions{0};
+  if (type == kWkbLineStringZ || type == kEwkbLineStringZ) {
+    dimensions = 3;
+  } else if (type == kWkbLineStringZM || type == kEwkbLineStringZM) {
+    dimensions = 4;
+  } else {
+    ThrowMalformedWkb("geometry type " + std::to_string(type) + " is not a LINESTRING Z");
+  }
+
+  const uint32_t num_points = Read<uint32_t>(data + 5, swap);
+  if (num_points < 2) {
+    throw std::runtime_error("LINESTRING must have at least 2 points, got " + std::to_string(num_points));
+  }
+  const size_t stride = dimensions * sizeof(double);
+  if ((size - kWkbLineStringHeaderSize) / stride < num_points) {
+    ThrowMalformedWkb("truncated coordinates, expected " + std::to_string(num_points) + " points");
+  }
+
+  points->reserve(points->size() + num_points);
+  const uint8_t* it = data + kWkbLineStringHeaderSize;
+  for (uint32_t i = 0; i < num_points; ++i, it += stride) {
+    points->push_back(maliput::math::Vector3(Read<double>(it, swap), Read<double>(it + sizeof(double), swap),
+                                             Read<double>(it + 2 * sizeof(double), swap)));
+  }
+}
+
+void ParseGeoPackageBinaryLineStringZ(const uint8_t* data, size_t size, std::vector<maliput::math::Vector3>* points) {
+  if (size < kGpbFixedHeaderSize) {
+    ThrowMalformedGpb("truncated header (" + std::to_string(size) + " bytes)");
+  }
+  if (!IsGeoPackageBinary(data, size)) {
+    ThrowMalformedGpb("missing 'GP' magic");
+  }
+  if (data[2] != 0) {
+    ThrowMalformedGpb("unsupported version " + std::to_string(data[2]));
+  }
+
+  const uint8_t flags = data[3];
+  if (flags & 0xC0) {
+    ThrowMalformedGpb("reserved flag bits are set");
+  }
+  if (flags & 0x20) {
+    ThrowMalformedGpb("extended geometries are not supported");
+  }
+  if (flags & 0x10) {
+    ThrowMalformedGpb("geometry is empty");
+  }
+  const bool swap = static_cast<bool>(flags & 0x01) != IsHostLittleEndian();
+  const size_t envelope_size = EnvelopeSize((flags >> 1) & 0x07);
+  if (size < kGpbFixedHeaderSize + envelope_size) {
+    ThrowMalformedGpb("truncated envelope");
+  }
+
+  // The envelope is laid out as [min, max] pairs; each pair must be ordered unless it is NaN.
+  const uint8_t* envelope = data + kGpbFixedHeaderSize;
+  for (size_t offset = 0; offset < envelope_size; offset += 2 * sizeof(double)) {
+    const double min = Read<double>(envelope + offset, swap);
+    const double max = Read<double>(envelope + offset + sizeof(double), swap);
+    if (!std::isnan(min) && !std::isnan(max) && min > max) {
+      ThrowMalformedGpb("envelope minimum is greater than its maximum");
+    }
+  }
+
+  const size_t header_size = kGpbFixedHeaderSize + envelope_size;
+  ParseWkbLineStringZ(data + header_size, size - header_size, points);
+}
+
+std::vector<maliput::math::Vector3> ParseGeoPackageBinaryLineStringZ(const uint8_t* data, size_t size) {
+  std::vector<maliput::math::Vector3> points;
+  ParseGeoPackageBinaryLineStringZ(data, size, &points);
+  return points;
+}
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
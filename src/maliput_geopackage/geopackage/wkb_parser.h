@@ -0,0 +1,76 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <maliput/math/vector.h>
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+/// Parses a WKB (Well-Known Binary) LineString Z geometry and appends its 3D points to `points`.
+///
+/// Both little- and big-endian encodings are accepted, with ISO (1002, 3002) and EWKB (0x80000002,
+/// 0xC0000002) type codes. The M ordinate of ZM geometries is dropped.
+///
+/// @param data Pointer to the first byte of the WKB geometry.
+/// @param size Number of bytes available at `data`.
+/// @param points Output buffer the parsed points are appended to. It must not be nullptr.
+/// @throws std::runtime_error if the WKB is malformed, truncated or not a LineString Z.
+void ParseWkbLineStringZ(const uint8_t* data, size_t size, std::vector<maliput::math::Vector3>* points);
+
+/// Parses a GeoPackage binary geometry (GPB header followed by WKB) holding a LineString Z and
+/// appends its 3D points to `points`.
+///
+/// The header magic, version and flags are validated, and the optional envelope is skipped after
+/// checking it is well formed. Extended and empty geometries are rejected.
+///
+/// @param data Pointer to the first byte of the GeoPackage binary blob.
+/// @param size Number of bytes available at `data`.
+/// @param points Output buffer the parsed points are appended to. It must not be nullptr.
+/// @throws std::runtime_error if the blob is malformed, truncated or not a LineString Z.
+void ParseGeoPackageBinaryLineStringZ(const uint8_t* data, size_t size, std::vector<maliput::math::Vector3>* points);
+
+/// Parses a GeoPackage binary geometry holding a LineString Z into a vector of 3D points.
+///
+/// @param data Pointer to the first byte of the GeoPackage binary blob.
+/// @param size Number of bytes available at `data`.
+/// @returns A vector of 3D points.
+/// @throws std::runtime_error if the blob is malformed, truncated or not a LineString Z.
+std::vector<maliput::math::Vector3> ParseGeoPackageBinaryLineStringZ(const uint8_t* data, size_t size);
+
+/// @returns True when `data` starts with the GeoPackage binary magic "GP".
+bool IsGeoPackageBinary(const uint8_t* data, size_t size);
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
@@ -30,82 +30,110 @@
 #include "maliput_geopackage/geopackage/wkt_parser.h"
 
 #include <algorithm>
-#include <regex>
-#include <sstream>
+#include <cctype>
+#include <charconv>
 #include <stdexcept>
+#include <string>
 
 namespace maliput_geopackage {
 namespace geopackage {
 
 namespace {
 
-// Trims whitespace from both ends of a string.
-std::string Trim(const std::string& str) {
-  const auto start = str.find_first_not_of(" \t\n\r");
-  if (start == std::string::npos) return "";
-  const auto end = str.find_last_not_of(" \t\n\r");
-  return str.substr(start, end - start + 1);
+// Returns true if `c` is a whitespace character.
+bool IsSpace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v'; }
+
+// Returns true if `str` contains `keyword`, ignoring case. `keyword` must be uppercase.
+bool ContainsKeyword(std::string_view str, std::string_view keyword) {
+  if (keyword.size() > str.size()) return false;
+  for (size_t i = 0; i + keyword.size() <= str.size(); ++i) {
+    size_t j = 0;
+    while (j < keyword.size() && std::toupper(static_cast<unsigned char>(str[i + j])) == keyword[j]) {
+      ++j;
+    }
+    if (j == keyword.size()) return true;
+  }
+  return false;
 }
 
 // Extracts the content between parentheses from a WKT string.
-std::string ExtractParenthesesContent(const std::string& wkt) {
+std::string_view ExtractParenthesesContent(std::string_view wkt) {
   const auto open_paren = wkt.find('(');
   const auto close_paren = wkt.rfind(')');
-  if (open_paren == std::string::npos || close_paren == std::string::npos || open_paren >= close_paren) {
-    throw std::runtime_error("Malformed WKT: missing or mismatched parentheses in '" + wkt + "'");
+  if (open_paren == std::string_view::npos || close_paren == std::string_view::npos || open_paren >= close_paren) {
+    throw std::runtime_error("Malformed WKT: missing or mismatched parentheses in '" + std::string(wkt) + "'");
   }
   return wkt.substr(open_paren + 1, close_paren - open_paren - 1);
 }
 
+// Parses a double starting at `*first`, skipping leading whitespace. On success `*first` is moved past the number.
+bool ParseDouble(const char** first, const char* last, double* value) {
+  const char* it = *first;
+  while (it != last && IsSpace(*it)) ++it;
+  // std::from_chars rejects an explicit plus sign, which stream extraction accepts.
+  if (it != last && *it == '+' && (it + 1) != last && *(it + 1) != '-' && *(it + 1) != '+') ++it;
+  const auto result = std::from_chars(it, last, *value);
+  if (result.ec != std::errc()) return false;
+  *first = result.ptr;
+  return true;
+}
+
 // Parses a single point from a space-separated string "x y z".
-maliput::math::Vector3 ParseSinglePoint(const std::string& point_str) {
-  std::istringstream iss(Trim(point_str));
+maliput::math::Vector3 ParseSinglePoint(std::string_view point_str) {
+  const char* it = point_str.data();
+  const char* const last = point_str.data() + point_str.size();
   double x, y, z;
-  if (!(iss >> x >> y >> z)) {
-    throw std::runtime_error("Malformed WKT point: '" + point_str + "'");
+  if (!ParseDouble(&it, last, &x) || !ParseDouble(&it, last, &y) || !ParseDouble(&it, last, &z)) {
+    throw std::runtime_error("Malformed WKT point: '" + std::string(point_str) + "'");
   }
   return maliput::math::Vector3(x, y, z);
 }
 
 }  // namespace
 
-std::vector<maliput::math::Vector3> ParseLineStringZ(const std::string& wkt) {
-  // Check for LINESTRINGZ or LINESTRING Z prefix
-  std::string upper_wkt = wkt;
-  std::transform(upper_wkt.begin(), upper_wkt.end(), upper_wkt.begin(), ::toupper);
+std::vector<maliput::math::Vector3> ParseLineStringZ(std::string_view wkt) {
+  std::vector<maliput::math::Vector3> points;
+  ParseLineStringZ(wkt, &points);
+  return points;
+}
 
-  if (upper_wkt.find("LINESTRING") == std::string::npos) {
-    throw std::runtime_error("WKT string is not a LINESTRING: '" + wkt + "'");
+void ParseLineStringZ(std::string_view wkt, std::vector<maliput::math::Vector3>* points) {
+  // Check for LINESTRINGZ or LINESTRING Z prefix
+  if (!ContainsKeyword(wkt, "LINESTRING")) {
+    throw std::runtime_error("WKT string is not a LINESTRING: '" + std::string(wkt) + "'");
   }
 
-  const std::string content = ExtractParenthesesContent(wkt);
-
-  std::vector<maliput::math::Vector3> points;
-  std::istringstream iss(content);
-  std::string point_str;
+  const std::string_view content = ExtractParenthesesContent(wkt);
 
-  // Split by comma
-  while (std::getline(iss, point_str, ',')) {
-    points.push_back(ParseSinglePoint(point_str));
+  // Pre-size the output from the number of separators.
+  const size_t initial_size = points->size();
+  const size_t required = initial_size + static_cast<size_t>(std::count(content.begin(), content.end(), ',')) + 1;
+  if (required > points->capacity()) {
+    points->reserve(std::max(required, 2 * points->capacity()));
   }
 
-  if (points.size() < 2) {
-    throw std::runtime_error("LINESTRING must have at least 2 points, got " + std::to_string(points.size()));
+  // Split by comma. A trailing empty field is ignored, as std::getline did.
+  size_t start = 0;
+  while (start < content.size()) {
+    size_t comma = content.find(',', start);
+    if (comma == std::string_view::npos) comma = content.size();
+    points->push_back(ParseSinglePoint(content.substr(start, comma - start)));
+    start = comma + 1;
   }
 
-  return points;
+  const size_t num_points = points->size() - initial_size;
+  if (num_points < 2) {
+    throw std::runtime_error("LINESTRING must have at least 2 points, got " + std::to_string(num_points));
+  }
 }
 
-maliput::math::Vector3 ParsePointZ(const std::string& wkt) {
+maliput::math::Vector3 ParsePointZ(std::string_view wkt) {
   // Check for POINTZ or POINT Z prefix
-  std::string upper_wkt = wkt;
-  std::transform(upper_wkt.begin(), upper_wkt.end(), upper_wkt.begin(), ::toupper);
-
-  if (upper_wkt.find("POINT") == std::string::npos) {
-    throw std::runtime_error("WKT string is not a POINT: '" + wkt + "'");
+  if (!ContainsKeyword(wkt, "POINT")) {
+    throw std::runtime_error("WKT string is not a POINT: '" + std::string(wkt) + "'");
   }
 
-  const std::string content = ExtractParenthesesContent(wkt);
+  const std::string_view content = ExtractParenthesesContent(wkt);
   return ParseSinglePoint(content);
 }
 
@@ -29,7 +29,7 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
-#include <string>
+#include <string_view>
 #include <vector>
 
 #include <maliput/math/vector.h>
@@ -42,14 +42,24 @@ namespace geopackage {
 /// @param wkt The WKT string, e.g., "LINESTRINGZ(0 0 0, 10 5 1, 20 10 2)"
 /// @returns A vector of 3D points.
 /// @throws std::runtime_error if the WKT string is malformed.
-std::vector<maliput::math::Vector3> ParseLineStringZ(const std::string& wkt);
+std::vector<maliput::math::Vector3> ParseLineStringZ(std::string_view wkt);
+
+/// Parses a WKT (Well-Known Text) LINESTRINGZ geometry string and appends its 3D points to `points`.
+///
+/// The string is read in place, so `wkt` may point straight into a SQLite column buffer. Reusing
+/// `points` across calls avoids any heap allocation once its capacity suffices.
+///
+/// @param wkt The WKT string, e.g., "LINESTRINGZ(0 0 0, 10 5 1, 20 10 2)"
+/// @param points Output buffer the parsed points are appended to. It must not be nullptr.
+/// @throws std::runtime_error if the WKT string is malformed. `points` contents are unspecified then.
+void ParseLineStringZ(std::string_view wkt, std::vector<maliput::math::Vector3>* points);
 
 /// Parses a WKT (Well-Known Text) POINTZ geometry string into a 3D point.
 ///
 /// @param wkt The WKT string, e.g., "POINTZ(10 5 1)" or "POINT Z(10 5 1)"
 /// @returns A 3D point.
 /// @throws std::runtime_error if the WKT string is malformed.
-maliput::math::Vector3 ParsePointZ(const std::string& wkt);
+maliput::math::Vector3 ParsePointZ(std::string_view wkt);
 
 }  // namespace geopackage
 }  // namespace maliput_geopackage
@@ -0,0 +1,145 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "maliput_geopackage/geopackage/work_stealing_pool.h"
+
+#include <algorithm>
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+WorkStealingPool::WorkStealingPool(int num_threads)
+    : num_threads_(std::max(num_threads, 1)), shares_(std::make_unique<Share[]>(num_threads_)) {
+  threads_.reserve(num_threads_ - 1);
+  for (int thread = 1; thread < num_threads_; ++thread) {
+    threads_.emplace_back(&WorkStealingPool::Loop, this, thread);
+  }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  run_started_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void WorkStealingPool::Run(size_t count, size_t chunk_size,
+                           const std::function<void(int thread, size_t begin, size_t end)>& work) {
+  if (count == 0) return;
+  chunk_size_ = std::max<size_t>(chunk_size, 1);
+  const size_t num_chunks = (count + chunk_size_ - 1) / chunk_size_;
+  for (int thread = 0; thread < num_threads_; ++thread) {
+    std::lock_guard<std::mutex> lock(shares_[thread].mutex);
+    shares_[thread].begin = num_chunks * thread / num_threads_;
+    shares_[thread].end = num_chunks * (thread + 1) / num_threads_;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    work_ = &work;
+    count_ = count;
+    failed_ = false;
+    error_ = nullptr;
+    running_ = num_threads_ - 1;
+    ++generation_;
+  }
+  run_started_.notify_all();
+
+  Drain(0);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  run_finished_.wait(lock, [this] { return running_ == 0; });
+  work_ = nullptr;
+  if (error_) std::rethrow_exception(error_);
+}
+
+void WorkStealingPool::Loop(int thread) {
+  uint64_t generation{0};
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    run_started_.wait(lock, [&] { return stopping_ || generation_ != generation; });
+    if (stopping_) return;
+    generation = generation_;
+    lock.unlock();
+    Drain(thread);
+    lock.lock();
+    if (--running_ == 0) run_finished_.notify_one();
+  }
+}
+
+void WorkStealingPool::Drain(int thread) {
+  size_t chunk{0};
+  while (!failed_ && (Pop(thread, &chunk) || Steal(thread, &chunk))) {
+    const size_t begin = chunk * chunk_size_;
+    try {
+      (*work_)(thread, begin, std::min(begin + chunk_size_, count_));
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!error_) error_ = std::current_exception();
+      failed_ = true;
+    }
+  }
+}
+
+bool WorkStealingPool::Pop(int thread, size_t* chunk) {
+  Share& share = shares_[thread];
+  std::lock_guard<std::mutex> lock(share.mutex);
+  if (share.begin == share.end) return false;
+  *chunk = share.begin++;
+  return true;
+}
+
+bool WorkStealingPool::Steal(int thread, size_t* chunk) {
+  for (int offset = 1; offset < num_threads_; ++offset) {
+    size_t begin{0};
+    size_t end{0};
+    {
+      Share& victim = shares_[(thread + offset) % num_threads_];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if (victim.begin == victim.end) continue;
+      end = victim.end;
+      victim.end -= (victim.end - victim.begin + 1) / 2;
+      begin = victim.end;
+    }
+    // Only the owner adds chunks to its share, and it is empty when stealing.
+    Share& share = shares_[thread];
+    std::lock_guard<std::mutex> lock(share.mutex);
+    share.begin = begin + 1;
+    share.end = end;
+    *chunk = begin;
+    return true;
+  }
+  return false;
+}
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
@@ -0,0 +1,119 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <maliput/common/maliput_copyable.h>
+
+namespace maliput_geopackage {
+namespace geopackage {
+
+/// Runs loops over many independent items on a fixed set of threads that balance their load by stealing work.
+///
+/// Every Run() splits its items into chunks and gives each thread a contiguous share of them, so that threads
+/// work on neighbouring items. A thread takes its chunks from the front of its share and, once it runs out,
+/// steals the back half of the chunks another thread has left. The threads are started once and reused by every
+/// Run(), the calling thread being one of them.
+class WorkStealingPool {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(WorkStealingPool)
+
+  /// Constructs the pool and starts its threads.
+  /// @param num_threads Number of threads running the work, including the one calling Run(). It must be positive.
+  explicit WorkStealingPool(int num_threads);
+
+  /// Stops and joins the threads.
+  ~WorkStealingPool();
+
+  /// Runs `work(thread, begin, end)` over consecutive ranges of at most `chunk_size` items covering [0, `count`),
+  /// and returns once every range is done. `thread` is the index in [0, num_threads()) of the thread running the
+  /// range, 0 being the calling one, so that `work` can keep state per thread. Run() must not be called again
+  /// before it returns.
+  /// @throws The first exception raised by `work`, if any, once every thread stopped. Ranges not started yet
+  ///         are skipped.
+  void Run(size_t count, size_t chunk_size, const std::function<void(int thread, size_t begin, size_t end)>& work);
+
+  /// @returns The number of threads running the work, including the one calling Run().
+  int num_threads() const { return num_threads_; }
+
+ private:
+  // Chunks [begin, end) left to a thread. The owner takes them from the front, thieves from the back.
+  struct Share {
+    std::mutex mutex;
+    size_t begin{0};
+    size_t end{0};
+  };
+
+  // Thread loop: runs its share of every Run() until the pool is destroyed.
+  void Loop(int thread);
+
+  // Runs chunks from the share of `thread`, then from those of the other threads, until none is left.
+  void Drain(int thread);
+
+  // Takes the front chunk of the share of `thread` into `chunk`. @returns False when the share is empty.
+  bool Pop(int thread, size_t* chunk);
+
+  // Moves the back half of another thread's share into the share of `thread` and takes its front chunk into
+  // `chunk`. @returns False when every share is empty.
+  bool Steal(int thread, size_t* chunk);
+
+  const int num_threads_;
+  std::unique_ptr<Share[]> shares_;
+
+  // State of the current Run(), set before the threads are woken up.
+  const std::function<void(int thread, size_t begin, size_t end)>* work_{nullptr};
+  size_t count_{0};
+  size_t chunk_size_{1};
+  std::atomic<bool> failed_{false};
+  std::exception_ptr error_;
+
+  std::mutex mutex_;
+  std::condition_variable run_started_;
+  std::condition_variable run_finished_;
+  // Incremented by every Run(), so that threads tell a new one apart from the one they finished.
+  uint64_t generation_{0};
+  // Threads other than the caller still running the current Run().
+  int running_{0};
+  bool stopping_{false};
+  std::vector<std::thread> threads_;
+};
+
+}  // namespace geopackage
+}  // namespace maliput_geopackage
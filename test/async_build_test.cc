@@ -0,0 +1,148 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+#include "maliput_geopackage/builder/async_build.h"
+
+#include <chrono>
+#include <future>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/road_network.h>
+
+#include "maliput_geopackage/builder/load_stats.h"
+#include "maliput_geopackage/builder/road_network_builder.h"
+
+namespace maliput_geopackage {
+namespace builder {
+namespace test {
+namespace {
+
+// Long enough for any thread to be scheduled, so that tests fail rather than hang.
+constexpr std::chrono::seconds kTimeout{10};
+
+class AsyncBuildTest : public ::testing::Test {
+ protected:
+  static std::map<std::string, std::string> Config(const std::string& gpkg_file) {
+    return {{"gpkg_file", gpkg_file}, {"linear_tolerance", "0.01"}};
+  }
+
+  const std::string kTwoLaneRoad{TEST_RESOURCES_DIR "two_lane_road.gpkg"};
+  const std::string kTShapeRoad{TEST_RESOURCES_DIR "t_shape_road.gpkg"};
+};
+
+TEST_F(AsyncBuildTest, ReportsProgress) {
+  // Only read once Get() returns, which synchronizes with the build thread.
+  std::vector<BuildProgress> progress;
+  AsyncBuild build =
+      RoadNetworkBuilder(Config(kTShapeRoad)).BuildAsync([&](const BuildProgress& p) { progress.push_back(p); });
+  LoadStats load_stats;
+  const std::unique_ptr<maliput::api::RoadNetwork> road_network = build.Get(&load_stats);
+  ASSERT_NE(road_network, nullptr);
+  EXPECT_TRUE(build.IsReady());
+  EXPECT_EQ(road_network->road_geometry()->num_junctions(), 4);
+
+  // One report per phase, in order.
+  ASSERT_EQ(progress.size(), load_stats.phases.size());
+  for (size_t i = 0; i < progress.size(); ++i) {
+    EXPECT_EQ(progress[i].phase, load_stats.phases[i].name);
+    if (i > 0) {
+      EXPECT_GE(progress[i].rows, progress[i - 1].rows);
+    }
+  }
+  EXPECT_EQ(progress.front().rows, 0);
+  EXPECT_EQ(progress.back().phase, "road_network_loader");
+  const geopackage::ParserStats& parser_stats = load_stats.parser;
+  EXPECT_EQ(progress.back().rows, parser_stats.junction_rows + parser_stats.boundary_rows + parser_stats.segment_rows +
+                                      parser_stats.lane_rows + parser_stats.branch_point_lane_rows +
+                                      parser_stats.adjacent_lane_rows);
+
+  EXPECT_THROW(build.Get(), std::runtime_error);
+}
+
+TEST_F(AsyncBuildTest, Cancel) {
+  // The build waits in its progress callback until it is cancelled, so it stops part way through reading rows.
+  std::promise<void> reading;
+  std::promise<void> cancelled;
+  std::future<void> cancelled_future = cancelled.get_future();
+  std::vector<std::string> phases;
+  AsyncBuild build = RoadNetworkBuilder(Config(kTShapeRoad)).BuildAsync([&](const BuildProgress& progress) {
+    phases.push_back(progress.phase);
+    if (progress.phase == "parse_junctions") {
+      reading.set_value();
+      cancelled_future.wait_for(kTimeout);
+    }
+  });
+  ASSERT_EQ(reading.get_future().wait_for(kTimeout), std::future_status::ready);
+  EXPECT_FALSE(build.IsReady());
+  build.Cancel();
+  cancelled.set_value();
+
+  EXPECT_THROW(build.Get(), BuildCancelled);
+  EXPECT_EQ(phases.back(), "parse_junctions");
+
+  // Cancelling a completed build has no effect.
+  AsyncBuild completed = RoadNetworkBuilder(Config(kTShapeRoad)).BuildAsync();
+  completed.Wait();
+  completed.Cancel();
+  EXPECT_NE(completed.Get(), nullptr);
+}
+
+TEST_F(AsyncBuildTest, DestroyingCancelsTheBuild) {
+  std::promise<void> reading;
+  std::promise<void> leaving_scope;
+  std::future<void> leaving_scope_future = leaving_scope.get_future();
+  std::vector<std::string> phases;
+  bool callback_returned{false};
+  {
+    const AsyncBuild build = RoadNetworkBuilder(Config(kTShapeRoad)).BuildAsync([&](const BuildProgress& progress) {
+      phases.push_back(progress.phase);
+      if (progress.phase == "parse_junctions") {
+        reading.set_value();
+        leaving_scope_future.wait_for(kTimeout);
+        callback_returned = true;
+      }
+    });
+    ASSERT_EQ(reading.get_future().wait_for(kTimeout), std::future_status::ready);
+    leaving_scope.set_value();
+  }
+  // The destructor waited for the build thread, which stopped at the next row.
+  EXPECT_TRUE(callback_returned);
+  EXPECT_EQ(phases.back(), "parse_junctions");
+}
+
+TEST_F(AsyncBuildTest, OverlapsBuilds) {
+  // Each build waits in its first report for the other to start, which only completes if both run at once.
+  std::promise<void> first_started;
+  std::promise<void> second_started;
+  const auto wait_for_other = [](std::promise<void>* started, std::shared_future<void> other) {
+    return [started, other, reported = false](const BuildProgress&) mutable {
+      if (reported) return;
+      reported = true;
+      started->set_value();
+      EXPECT_EQ(other.wait_for(kTimeout), std::future_status::ready);
+    };
+  };
+  AsyncBuild first = RoadNetworkBuilder(Config(kTwoLaneRoad))
+                         .BuildAsync(wait_for_other(&first_started, second_started.get_future().share()));
+  AsyncBuild second = RoadNetworkBuilder(Config(kTShapeRoad))
+                          .BuildAsync(wait_for_other(&second_started, first_started.get_future().share()));
+
+  const std::unique_ptr<maliput::api::RoadNetwork> two_lane_road = first.Get();
+  const std::unique_ptr<maliput::api::RoadNetwork> t_shape_road = second.Get();
+  ASSERT_NE(two_lane_road, nullptr);
+  ASSERT_NE(t_shape_road, nullptr);
+  EXPECT_EQ(two_lane_road->road_geometry()->num_junctions(), 1);
+  EXPECT_EQ(t_shape_road->road_geometry()->num_junctions(), 4);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace builder
+}  // namespace maliput_geopackage
@@ -0,0 +1,107 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+#include "maliput_geopackage/builder/batch_query_runner.h"
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_geometry.h>
+
+#include "indexed_city_grid_fixture.h"
+
+namespace maliput_geopackage {
+namespace builder {
+namespace test {
+namespace {
+
+using maliput::api::InertialPosition;
+using maliput::api::LanePosition;
+using maliput::api::RoadPositionResult;
+
+using BatchQueryRunnerTest = IndexedCityGridTest;
+
+TEST_F(BatchQueryRunnerTest, MatchesSingleQueries) {
+  std::mt19937 generator(5);
+  std::uniform_real_distribution<double> coordinate(-20., 320.);
+  std::uniform_real_distribution<double> fraction(0., 1.);
+  std::uniform_int_distribution<size_t> lane_index(0, lanes_.size() - 1);
+  for (const int num_threads : {1, 4}) {
+    BatchQueryRunner runner(indexed_.road_position_index.get(), num_threads);
+    EXPECT_EQ(runner.num_threads(), num_threads);
+    // The runner is reused across batches of different sizes.
+    for (const size_t count : {0, 1, 3000}) {
+      std::vector<InertialPosition> inertial_positions;
+      std::vector<LanePositionQuery> queries;
+      for (size_t i = 0; i < count; ++i) {
+        inertial_positions.emplace_back(coordinate(generator), coordinate(generator), 0.5);
+        const maliput::api::Lane* lane = lanes_[lane_index(generator)];
+        queries.push_back({lane, LanePosition(fraction(generator) * lane->length(), 0.5, 0.)});
+      }
+      std::vector<RoadPositionResult> road_positions(count);
+      std::vector<InertialPosition> results(count);
+      runner.ToRoadPosition(inertial_positions.data(), count, road_positions.data());
+      runner.ToInertialPosition(queries.data(), count, results.data());
+
+      for (size_t i = 0; i < count; ++i) {
+        const RoadPositionResult expected = road_geometry_->ToRoadPosition(inertial_positions[i]);
+        ASSERT_EQ(road_positions[i].road_position.lane, expected.road_position.lane) << i;
+        EXPECT_EQ(road_positions[i].nearest_position.xyz(), expected.nearest_position.xyz());
+        EXPECT_EQ(road_positions[i].distance, expected.distance);
+        EXPECT_EQ(results[i].xyz(), queries[i].lane->ToInertialPosition(queries[i].lane_position).xyz());
+      }
+    }
+  }
+}
+
+// Once the query buffers fit a batch, running it again does not grow them.
+TEST_F(BatchQueryRunnerTest, ReusesQueryBuffers) {
+  std::mt19937 generator(11);
+  std::uniform_real_distribution<double> coordinate(-20., 320.);
+  std::vector<InertialPosition> inertial_positions;
+  for (int i = 0; i < 1000; ++i) {
+    inertial_positions.emplace_back(coordinate(generator), coordinate(generator), 0.5);
+  }
+  std::vector<RoadPositionResult> road_positions(inertial_positions.size());
+  BatchQueryRunner runner(indexed_.road_position_index.get(), 1);
+  EXPECT_EQ(runner.num_scratch_allocations(), 0);
+  runner.ToRoadPosition(inertial_positions.data(), inertial_positions.size(), road_positions.data());
+  const int64_t num_allocations = runner.num_scratch_allocations();
+  EXPECT_GT(num_allocations, 0);
+  runner.ToRoadPosition(inertial_positions.data(), inertial_positions.size(), road_positions.data());
+  EXPECT_EQ(runner.num_scratch_allocations(), num_allocations);
+}
+
+TEST_F(BatchQueryRunnerTest, RequiresQueryLanes) {
+  BatchQueryRunner runner(indexed_.road_position_index.get(), 2);
+  std::vector<LanePositionQuery> queries{{lanes_.front(), LanePosition(0., 0., 0.)}, {}};
+  std::vector<InertialPosition> results(queries.size());
+  EXPECT_THROW(runner.ToInertialPosition(queries.data(), queries.size(), results.data()), std::runtime_error);
+}
+
+TEST_F(BatchQueryRunnerTest, RequiresFiniteInertialPositions) {
+  BatchQueryRunner runner(indexed_.road_position_index.get(), 2);
+  for (const double value : {std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::infinity()}) {
+    for (int coordinate = 0; coordinate < 3; ++coordinate) {
+      double xyz[3]{10., 10., 0.};
+      xyz[coordinate] = value;
+      std::vector<InertialPosition> inertial_positions(3, InertialPosition(10., 10., 0.));
+      inertial_positions[1] = InertialPosition(xyz[0], xyz[1], xyz[2]);
+      std::vector<RoadPositionResult> road_positions(inertial_positions.size());
+      EXPECT_THROW(runner.ToRoadPosition(inertial_positions.data(), inertial_positions.size(), road_positions.data()),
+                   std::runtime_error);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace builder
+}  // namespace maliput_geopackage
@@ -0,0 +1,344 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+#include "tools/city_grid.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <sqlite3.h>
+
+#include "maliput_geopackage/geopackage/geopackage_parser.h"
+#include "maliput_geopackage/geopackage/spatial_index.h"
+
+namespace maliput_geopackage {
+namespace tools {
+namespace test {
+
+class CityGridTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    path_ = (std::filesystem::temp_directory_path() /
+             ("city_grid_test_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) +
+              ".gpkg"))
+                .string();
+  }
+
+  void TearDown() override { std::filesystem::remove(path_); }
+
+  std::string path_;
+};
+
+// @returns The point halfway between the `end` points of both boundaries of `lane`.
+maliput::math::Vector3 CenterlineEnd(const maliput_sparse::parser::Lane& lane,
+                                     maliput_sparse::parser::LaneEnd::Which end) {
+  const bool start = end == maliput_sparse::parser::LaneEnd::Which::kStart;
+  return 0.5 * ((start ? lane.left.first() : lane.left.last()) + (start ? lane.right.first() : lane.right.last()));
+}
+
+TEST_F(CityGridTest, TopologyWithTurns) {
+  CityGridOptions options;
+  options.blocks_x = 2;
+  options.blocks_y = 2;
+  const CityGridStats stats = GenerateCityGrid(options, path_);
+
+  // 12 roads and 9 intersections. Corner intersections have 2 turns, edge ones 1 through segment and 4 turns,
+  // the center one 2 through segments and 8 turns.
+  EXPECT_EQ(stats.junctions, 21);
+  EXPECT_EQ(stats.segments, 12 + 6 + 32);
+  EXPECT_EQ(stats.lanes, 12 * 2 + 6 * 2 + 32);
+  EXPECT_EQ(stats.adjacent_lanes, (12 + 6) * 2);
+
+  const geopackage::GeoPackageParser parser(path_);
+  EXPECT_EQ(static_cast<int64_t>(parser.GetJunctions().size()), stats.junctions);
+  std::map<std::string, const maliput_sparse::parser::Lane*> lanes;
+  for (const auto& [junction_id, junction] : parser.GetJunctions()) {
+    for (const auto& [segment_id, segment] : junction.segments) {
+      for (const auto& lane : segment.lanes) {
+        lanes.emplace(lane.id, &lane);
+      }
+    }
+  }
+  EXPECT_EQ(static_cast<int64_t>(lanes.size()), stats.lanes);
+
+  // Every connecting lane joins two road lanes.
+  EXPECT_EQ(parser.GetConnections().size(), 2u * (6 * 2 + 32));
+  for (const auto& connection : parser.GetConnections()) {
+    const auto from = CenterlineEnd(*lanes.at(connection.from.lane_id), connection.from.end);
+    const auto to = CenterlineEnd(*lanes.at(connection.to.lane_id), connection.to.end);
+    EXPECT_LT((from - to).norm(), 1e-3) << connection.from.lane_id << " -> " << connection.to.lane_id;
+  }
+
+  // Lanes of a road are numbered right to left.
+  const auto& road_lane = *lanes.at("h_0_0_s_l0");
+  EXPECT_EQ(road_lane.left_lane_id.value(), "h_0_0_s_l1");
+  EXPECT_FALSE(road_lane.right_lane_id.has_value());
+}
+
+TEST_F(CityGridTest, StraightIntersections) {
+  CityGridOptions options;
+  options.blocks_x = 2;
+  options.blocks_y = 2;
+  options.lanes_per_direction = 2;
+  options.intersection_style = IntersectionStyle::kStraight;
+  const CityGridStats stats = GenerateCityGrid(options, path_);
+
+  // Corner intersections have no through lanes and are left out.
+  EXPECT_EQ(stats.junctions, 12 + 5);
+  EXPECT_EQ(stats.segments, 12 + 6);
+  EXPECT_EQ(stats.lanes, (12 + 6) * 4);
+
+  const geopackage::GeoPackageParser parser(path_);
+  EXPECT_EQ(parser.GetConnections().size(), 2u * 6 * 4);
+}
+
+TEST_F(CityGridTest, ElevationIsContinuous) {
+  CityGridOptions options;
+  options.blocks_x = 3;
+  options.blocks_y = 3;
+  options.elevation = 10.;
+  GenerateCityGrid(options, path_);
+
+  const geopackage::GeoPackageParser parser(path_);
+  std::map<std::string, const maliput_sparse::parser::Lane*> lanes;
+  double max_z = 0.;
+  for (const auto& [junction_id, junction] : parser.GetJunctions()) {
+    for (const auto& [segment_id, segment] : junction.segments) {
+      for (const auto& lane : segment.lanes) {
+        lanes.emplace(lane.id, &lane);
+        for (size_t i = 0; i < lane.left.size(); ++i) max_z = std::max(max_z, lane.left.at(i).z());
+      }
+    }
+  }
+  EXPECT_GT(max_z, 1.);
+  EXPECT_LE(max_z, 10.);
+  for (const auto& connection : parser.GetConnections()) {
+    const auto from = CenterlineEnd(*lanes.at(connection.from.lane_id), connection.from.end);
+    const auto to = CenterlineEnd(*lanes.at(connection.to.lane_id), connection.to.end);
+    EXPECT_LT((from - to).norm(), 1e-3) << connection.from.lane_id << " -> " << connection.to.lane_id;
+  }
+}
+
+TEST_F(CityGridTest, BinaryGeometryMatchesWkt) {
+  CityGridOptions options;
+  options.blocks_x = 1;
+  options.blocks_y = 2;
+  options.elevation = 2.;
+  const std::string wkt_path = path_ + ".wkt.gpkg";
+  GenerateCityGrid(options, wkt_path);
+  options.geometry_format = GeometryFormat::kGeoPackageBinary;
+  GenerateCityGrid(options, path_);
+
+  const geopackage::GeoPackageParser wkt_parser(wkt_path);
+  const geopackage::GeoPackageParser gpb_parser(path_);
+  std::filesystem::remove(wkt_path);
+  ASSERT_EQ(gpb_parser.GetJunctions().size(), wkt_parser.GetJunctions().size());
+  EXPECT_EQ(gpb_parser.GetConnections().size(), wkt_parser.GetConnections().size());
+  for (const auto& [junction_id, junction] : wkt_parser.GetJunctions()) {
+    for (const auto& [segment_id, segment] : junction.segments) {
+      const auto& gpb_lanes = gpb_parser.GetJunctions().at(junction_id).segments.at(segment_id).lanes;
+      ASSERT_EQ(gpb_lanes.size(), segment.lanes.size());
+      for (size_t i = 0; i < gpb_lanes.size(); ++i) {
+        ASSERT_EQ(gpb_lanes[i].left.size(), segment.lanes[i].left.size());
+        for (size_t p = 0; p < gpb_lanes[i].left.size(); ++p) {
+          EXPECT_LT((gpb_lanes[i].left.at(p) - segment.lanes[i].left.at(p)).norm(), 1e-3);
+          EXPECT_LT((gpb_lanes[i].right.at(p) - segment.lanes[i].right.at(p)).norm(), 1e-3);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(CityGridTest, CompactGeometryMatchesWkt) {
+  CityGridOptions options;
+  options.blocks_x = 1;
+  options.blocks_y = 2;
+  options.points_per_boundary = 101;
+  options.elevation = 2.;
+  options.geometry_format = GeometryFormat::kGeoPackageBinary;
+  const std::string gpb_path = path_ + ".gpb.gpkg";
+  GenerateCityGrid(options, gpb_path);
+  options.geometry_format = GeometryFormat::kCompact;
+  GenerateCityGrid(options, path_);
+
+  const geopackage::GeoPackageParser gpb_parser(gpb_path);
+  const geopackage::GeoPackageParser compact_parser(path_);
+  std::filesystem::remove(gpb_path);
+  // Millimetre deltas of densely sampled boundaries take a few bytes instead of 24 per point.
+  EXPECT_LT(3 * compact_parser.stats().geometry_bytes_read, gpb_parser.stats().geometry_bytes_read);
+  ASSERT_EQ(compact_parser.GetJunctions().size(), gpb_parser.GetJunctions().size());
+  for (const auto& [junction_id, junction] : gpb_parser.GetJunctions()) {
+    for (const auto& [segment_id, segment] : junction.segments) {
+      const auto& lanes = compact_parser.GetJunctions().at(junction_id).segments.at(segment_id).lanes;
+      ASSERT_EQ(lanes.size(), segment.lanes.size());
+      for (size_t i = 0; i < lanes.size(); ++i) {
+        ASSERT_EQ(lanes[i].left.size(), segment.lanes[i].left.size());
+        for (size_t p = 0; p < lanes[i].left.size(); ++p) {
+          EXPECT_LT((lanes[i].left.at(p) - segment.lanes[i].left.at(p)).norm(), 1e-3);
+          EXPECT_LT((lanes[i].right.at(p) - segment.lanes[i].right.at(p)).norm(), 1e-3);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(CityGridTest, SharedBoundariesMatchInline) {
+  CityGridOptions options;
+  options.blocks_x = 2;
+  options.blocks_y = 1;
+  options.elevation = 2.;
+  const std::string inline_path = path_ + ".inline.gpkg";
+  const CityGridStats inline_stats = GenerateCityGrid(options, inline_path);
+  const geopackage::GeoPackageParser inline_parser(inline_path);
+  std::filesystem::remove(inline_path);
+  EXPECT_EQ(inline_stats.boundaries, 0);
+
+  for (const GeometryFormat format : {GeometryFormat::kWkt, GeometryFormat::kGeoPackageBinary}) {
+    options.geometry_format = format;
+    options.shared_boundaries = true;
+    const CityGridStats stats = GenerateCityGrid(options, path_);
+    // Road-wide segments hold two lanes, adjacent to each other, bounded by three shared boundaries.
+    EXPECT_EQ(stats.boundaries, 3 * stats.adjacent_lanes / 2);
+    EXPECT_EQ(stats.lanes, inline_stats.lanes);
+
+    const geopackage::GeoPackageParser parser(path_);
+    EXPECT_EQ(parser.stats().boundary_rows, stats.boundaries);
+    ASSERT_EQ(parser.GetJunctions().size(), inline_parser.GetJunctions().size());
+    EXPECT_EQ(parser.GetConnections().size(), inline_parser.GetConnections().size());
+    for (const auto& [junction_id, junction] : inline_parser.GetJunctions()) {
+      for (const auto& [segment_id, segment] : junction.segments) {
+        const auto& lanes = parser.GetJunctions().at(junction_id).segments.at(segment_id).lanes;
+        ASSERT_EQ(lanes.size(), segment.lanes.size());
+        for (size_t i = 0; i < lanes.size(); ++i) {
+          EXPECT_EQ(lanes[i].id, segment.lanes[i].id);
+          EXPECT_EQ(lanes[i].left_lane_id, segment.lanes[i].left_lane_id);
+          EXPECT_EQ(lanes[i].right_lane_id, segment.lanes[i].right_lane_id);
+          ASSERT_EQ(lanes[i].left.size(), segment.lanes[i].left.size());
+          ASSERT_EQ(lanes[i].right.size(), segment.lanes[i].right.size());
+          for (size_t p = 0; p < lanes[i].left.size(); ++p) {
+            EXPECT_LT((lanes[i].left.at(p) - segment.lanes[i].left.at(p)).norm(), 1e-3);
+            EXPECT_LT((lanes[i].right.at(p) - segment.lanes[i].right.at(p)).norm(), 1e-3);
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST_F(CityGridTest, SimplifiedSharedBoundariesStayShared) {
+  CityGridOptions options;
+  options.blocks_x = 2;
+  options.blocks_y = 1;
+  options.points_per_boundary = 101;
+  options.elevation = 2.;
+  options.shared_boundaries = true;
+  GenerateCityGrid(options, path_);
+  {
+    // The outer boundary of every road gets a bump a third of the way, where the shared one has no vertex, so
+    // matching the boundaries of the outer lane would resample the shared one.
+    const geopackage::GeoPackageParser parser(path_);
+    sqlite3* db = nullptr;
+    ASSERT_EQ(sqlite3_open(path_.c_str(), &db), SQLITE_OK);
+    sqlite3_stmt* stmt = nullptr;
+    ASSERT_EQ(sqlite3_prepare_v2(db,
+                                 "UPDATE boundaries SET geometry = ?1 WHERE boundary_id = "
+                                 "(SELECT right_boundary_id FROM lanes WHERE lane_id = ?2)",
+                                 -1, &stmt, nullptr),
+              SQLITE_OK);
+    for (const auto& [junction_id, junction] : parser.GetJunctions()) {
+      for (const auto& [segment_id, segment] : junction.segments) {
+        if (segment.lanes.size() < 2) continue;
+        const maliput_sparse::parser::Lane& outer_lane = segment.lanes.front();
+        const maliput::math::Vector3 start = outer_lane.right.first();
+        const maliput::math::Vector3 end = outer_lane.right.last();
+        const maliput::math::Vector3 bump = start + (1. / 3.) * (end - start) + maliput::math::Vector3(0., 0., 1.);
+        std::ostringstream wkt;
+        wkt.precision(17);
+        wkt << "LINESTRINGZ(" << start.x() << " " << start.y() << " " << start.z() << ", " << bump.x() << " "
+            << bump.y() << " " << bump.z() << ", " << end.x() << " " << end.y() << " " << end.z() << ")";
+        sqlite3_bind_text(stmt, 1, wkt.str().c_str(), -1, SQLITE_TRANSIENT);
+        sqlite3_bind_text(stmt, 2, outer_lane.id.c_str(), -1, SQLITE_TRANSIENT);
+        EXPECT_EQ(sqlite3_step(stmt), SQLITE_DONE);
+        EXPECT_EQ(sqlite3_changes(db), 1);
+        sqlite3_reset(stmt);
+      }
+    }
+    sqlite3_finalize(stmt);
+    sqlite3_close(db);
+  }
+
+  for (const auto simplification :
+       {geopackage::BoundarySimplification::kSimplify, geopackage::BoundarySimplification::kSimplifyAndMatch}) {
+    geopackage::ParserConfiguration config;
+    config.boundary_simplification = simplification;
+    config.simplification_tolerance = 1e-2;
+    const geopackage::GeoPackageParser parser(path_, config);
+    EXPECT_LT(parser.stats().points_kept, parser.stats().points_decoded);
+    int shared_edges{0};
+    for (const auto& [junction_id, junction] : parser.GetJunctions()) {
+      for (const auto& [segment_id, segment] : junction.segments) {
+        // Neighbouring lanes get the same simplified copy of the boundary they share.
+        for (size_t i = 1; i < segment.lanes.size(); ++i) {
+          EXPECT_EQ(segment.lanes[i - 1].left, segment.lanes[i].right) << segment_id;
+          ++shared_edges;
+        }
+      }
+    }
+    EXPECT_GT(shared_edges, 0);
+  }
+}
+
+TEST_F(CityGridTest, SpatialIndex) {
+  CityGridOptions options;
+  options.blocks_x = 1;
+  options.blocks_y = 1;
+  options.build_spatial_index = true;
+  GenerateCityGrid(options, path_);
+
+  sqlite3* db = nullptr;
+  ASSERT_EQ(sqlite3_open_v2(path_.c_str(), &db, SQLITE_OPEN_READONLY, nullptr), SQLITE_OK);
+  EXPECT_TRUE(geopackage::HasLaneSpatialIndex(db));
+  sqlite3_close(db);
+}
+
+TEST_F(CityGridTest, ReplacesExistingFile) {
+  CityGridOptions options;
+  options.blocks_x = 2;
+  options.blocks_y = 2;
+  GenerateCityGrid(options, path_);
+  options.blocks_x = 1;
+  options.blocks_y = 1;
+  const CityGridStats stats = GenerateCityGrid(options, path_);
+
+  const geopackage::GeoPackageParser parser(path_);
+  EXPECT_EQ(static_cast<int64_t>(parser.GetJunctions().size()), stats.junctions);
+}
+
+TEST_F(CityGridTest, InvalidOptionsThrow) {
+  CityGridOptions options;
+  options.blocks_x = 0;
+  EXPECT_THROW(GenerateCityGrid(options, path_), std::runtime_error);
+  options = CityGridOptions{};
+  options.points_per_boundary = 1;
+  EXPECT_THROW(GenerateCityGrid(options, path_), std::runtime_error);
+  options = CityGridOptions{};
+  options.lanes_per_direction = 20;
+  EXPECT_THROW(GenerateCityGrid(options, path_), std::runtime_error);
+  EXPECT_FALSE(std::filesystem::exists(path_));
+
+  EXPECT_THROW(IntersectionStyleFromString("roundabout"), std::runtime_error);
+  EXPECT_THROW(GeometryFormatFromString("geojson"), std::runtime_error);
+  EXPECT_EQ(IntersectionStyleFromString("straight"), IntersectionStyle::kStraight);
+  EXPECT_EQ(GeometryFormatFromString("gpb"), GeometryFormat::kGeoPackageBinary);
+  EXPECT_EQ(GeometryFormatFromString("compact"), GeometryFormat::kCompact);
+}
+
+}  // namespace test
+}  // namespace tools
+}  // namespace maliput_geopackage
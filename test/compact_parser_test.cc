@@ -0,0 +1,162 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+#include "maliput_geopackage/geopackage/compact_parser.h"
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "maliput_geopackage/geopackage/lane_decoder.h"
+
+namespace maliput_geopackage {
+namespace geopackage {
+namespace test {
+namespace {
+
+// Appends `value` to `bytes`, little-endian.
+template <typename T>
+void Append(T value, std::vector<uint8_t>* bytes) {
+  uint64_t bits{0};
+  std::memcpy(&bits, &value, sizeof(T));
+  for (size_t i = 0; i < sizeof(T); ++i) {
+    bytes->push_back(static_cast<uint8_t>(bits >> (8 * i)));
+  }
+}
+
+void AppendVarint(int32_t value, std::vector<uint8_t>* bytes) {
+  uint32_t zigzag = (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+  while (zigzag >= 0x80) {
+    bytes->push_back(static_cast<uint8_t>((zigzag & 0x7f) | 0x80));
+    zigzag >>= 7;
+  }
+  bytes->push_back(static_cast<uint8_t>(zigzag));
+}
+
+// Builds a compact geometry from `deltas`, laid out one axis after the other.
+std::vector<uint8_t> MakeCompact(bool varint, uint32_t num_points, const std::vector<double>& origin, double scale,
+                                 const std::vector<int32_t>& deltas) {
+  std::vector<uint8_t> bytes{'M', 'Q', 0, static_cast<uint8_t>(varint ? kCompactVarintFlag : 0)};
+  Append(num_points, &bytes);
+  for (const double o : origin) Append(o, &bytes);
+  Append(scale, &bytes);
+  for (const int32_t delta : deltas) {
+    if (varint) {
+      AppendVarint(delta, &bytes);
+    } else {
+      Append(delta, &bytes);
+    }
+  }
+  return bytes;
+}
+
+// Points (0, 0, 0), (10, 5, 1) and (20, 10, 2) at a 1 mm scale around (100, 200, 0).
+const std::vector<double> kOrigin{100., 200., 0.};
+const std::vector<int32_t> kDeltas{-100000, 10000, 10000, -200000, 5000, 5000, 0, 1000, 1000};
+
+void ExpectCoordinates(const std::vector<maliput::math::Vector3>& points) {
+  const std::vector<double> expected{0., 0., 0., 10., 5., 1., 20., 10., 2.};
+  ASSERT_EQ(points.size(), 3u);
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_NEAR(points[i].x(), expected[3 * i], 1e-9);
+    EXPECT_NEAR(points[i].y(), expected[3 * i + 1], 1e-9);
+    EXPECT_NEAR(points[i].z(), expected[3 * i + 2], 1e-9);
+  }
+}
+
+TEST(CompactParserTest, Int32Deltas) {
+  const auto compact = MakeCompact(false, 3, kOrigin, 1e-3, kDeltas);
+  EXPECT_EQ(compact.size(), kCompactLineStringHeaderSize + 9 * sizeof(int32_t));
+  std::vector<maliput::math::Vector3> points;
+  ParseCompactLineStringZ(compact.data(), compact.size(), &points);
+  ExpectCoordinates(points);
+}
+
+TEST(CompactParserTest, VarintDeltas) {
+  const auto compact = MakeCompact(true, 3, kOrigin, 1e-3, kDeltas);
+  EXPECT_LT(compact.size(), kCompactLineStringHeaderSize + 9 * sizeof(int32_t));
+  std::vector<maliput::math::Vector3> points;
+  ParseCompactLineStringZ(compact.data(), compact.size(), &points);
+  ExpectCoordinates(points);
+}
+
+// Long enough to cover the vectorized blocks and the scalar tail, with deltas wrapping around 32 bits.
+TEST(CompactParserTest, AccumulatesLongLines) {
+  constexpr uint32_t kNumPoints{37};
+  std::vector<int32_t> deltas(3 * kNumPoints);
+  for (size_t i = 0; i < deltas.size(); ++i) {
+    deltas[i] = static_cast<int32_t>((i * 7919) % 2001) - 1000;
+  }
+  deltas[5] = INT32_MAX;
+  deltas[6] = INT32_MAX;
+  deltas[7] = 2;
+  for (const bool varint : {false, true}) {
+    const auto compact = MakeCompact(varint, kNumPoints, {1., -2., 3.}, 0.01, deltas);
+    std::vector<maliput::math::Vector3> points{maliput::math::Vector3(-1., -1., -1.)};
+    ParseCompactLineStringZ(compact.data(), compact.size(), &points);
+    ASSERT_EQ(points.size(), kNumPoints + 1);
+    EXPECT_DOUBLE_EQ(points[0].x(), -1.);
+    for (int axis = 0; axis < 3; ++axis) {
+      const double origin = axis == 0 ? 1. : (axis == 1 ? -2. : 3.);
+      uint32_t position{0};
+      for (uint32_t i = 0; i < kNumPoints; ++i) {
+        position += static_cast<uint32_t>(deltas[axis * kNumPoints + i]);
+        EXPECT_NEAR(points[i + 1][axis], origin + 0.01 * static_cast<int32_t>(position), 1e-6)
+            << "axis " << axis << ", point " << i;
+      }
+    }
+  }
+}
+
+TEST(CompactParserTest, DecodedByLaneDecoder) {
+  const auto compact = MakeCompact(true, 3, kOrigin, 1e-3, kDeltas);
+  EXPECT_TRUE(IsCompactLineString(compact.data(), compact.size()));
+  EXPECT_FALSE(IsCompactLineString(compact.data(), 1));
+  std::vector<maliput::math::Vector3> points;
+  DecodeLineStringZ(compact.data(), compact.size(), true, &points);
+  ExpectCoordinates(points);
+}
+
+TEST(CompactParserTest, InvalidCompactThrows) {
+  std::vector<maliput::math::Vector3> points;
+  const auto valid = MakeCompact(true, 3, kOrigin, 1e-3, kDeltas);
+
+  EXPECT_THROW(ParseCompactLineStringZ(valid.data(), kCompactLineStringHeaderSize - 1, &points), std::runtime_error);
+
+  auto bad_magic = valid;
+  bad_magic[1] = 'X';
+  EXPECT_THROW(ParseCompactLineStringZ(bad_magic.data(), bad_magic.size(), &points), std::runtime_error);
+
+  auto bad_version = valid;
+  bad_version[2] = 1;
+  EXPECT_THROW(ParseCompactLineStringZ(bad_version.data(), bad_version.size(), &points), std::runtime_error);
+
+  auto reserved_flags = valid;
+  reserved_flags[3] |= 0x80;
+  EXPECT_THROW(ParseCompactLineStringZ(reserved_flags.data(), reserved_flags.size(), &points), std::runtime_error);
+
+  const auto single_point = MakeCompact(false, 1, kOrigin, 1e-3, {0, 0, 0});
+  EXPECT_THROW(ParseCompactLineStringZ(single_point.data(), single_point.size(), &points), std::runtime_error);
+
+  const auto zero_scale = MakeCompact(false, 3, kOrigin, 0., kDeltas);
+  EXPECT_THROW(ParseCompactLineStringZ(zero_scale.data(), zero_scale.size(), &points), std::runtime_error);
+
+  const auto int32_truncated = MakeCompact(false, 3, kOrigin, 1e-3, kDeltas);
+  EXPECT_THROW(ParseCompactLineStringZ(int32_truncated.data(), int32_truncated.size() - 1, &points),
+               std::runtime_error);
+  EXPECT_THROW(ParseCompactLineStringZ(valid.data(), valid.size() - 1, &points), std::runtime_error);
+
+  // A sixth continuation byte cannot be part of a 32-bit varint.
+  auto overlong = MakeCompact(true, 2, kOrigin, 1e-3, {0, 0, 0, 0, 0});
+  for (const uint8_t byte : {0x80, 0x80, 0x80, 0x80, 0x80, 0x01}) overlong.push_back(byte);
+  EXPECT_THROW(ParseCompactLineStringZ(overlong.data(), overlong.size(), &points), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace geopackage
+}  // namespace maliput_geopackage
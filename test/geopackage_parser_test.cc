@@ -4,9 +4,33 @@
 // All rights reserved.
 #include "maliput_geopackage/geopackage/geopackage_parser.h"
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
+#include <sqlite3.h>
+
+#include "maliput_geopackage/geopackage/mapped_file.h"
+#include "maliput_geopackage/geopackage/snapshot.h"
+#include "maliput_geopackage/geopackage/spatial_index.h"
+#include "maliput_geopackage/geopackage/sqlite_helpers.h"
+#include "maliput_geopackage/geopackage/wkt_parser.h"
 
 namespace maliput_geopackage {
 namespace geopackage {
@@ -16,6 +40,8 @@ class GeoPackageParserTest : public ::testing::Test {
  protected:
   const std::string kTestResourcesDir{TEST_RESOURCES_DIR};
   const std::string kTwoLaneRoadPath{kTestResourcesDir + "two_lane_road.gpkg"};
+  const std::string kTwoLaneRoadGpbPath{kTestResourcesDir + "two_lane_road_gpb.gpkg"};
+  const std::string kTShapeRoadPath{kTestResourcesDir + "t_shape_road.gpkg"};
 };
 
 TEST_F(GeoPackageParserTest, LoadTwoLaneRoad) {
@@ -94,6 +120,846 @@ TEST_F(GeoPackageParserTest, ConnectionsAreCreated) {
   EXPECT_GE(connections.size(), 0u);
 }
 
+TEST_F(GeoPackageParserTest, BinaryGeometryMatchesWkt) {
+  const GeoPackageParser wkt_parser(kTwoLaneRoadPath);
+  const GeoPackageParser gpb_parser(kTwoLaneRoadGpbPath);
+
+  const auto& wkt_junctions = wkt_parser.GetJunctions();
+  const auto& gpb_junctions = gpb_parser.GetJunctions();
+  ASSERT_EQ(gpb_junctions.size(), wkt_junctions.size());
+
+  const auto& wkt_lanes = wkt_junctions.at("j1").segments.at("j1_s1").lanes;
+  const auto& gpb_lanes = gpb_junctions.at("j1").segments.at("j1_s1").lanes;
+  ASSERT_EQ(gpb_lanes.size(), wkt_lanes.size());
+  for (size_t i = 0; i < wkt_lanes.size(); ++i) {
+    EXPECT_EQ(gpb_lanes[i].id, wkt_lanes[i].id);
+    EXPECT_EQ(gpb_lanes[i].left, wkt_lanes[i].left);
+    EXPECT_EQ(gpb_lanes[i].right, wkt_lanes[i].right);
+  }
+}
+
+TEST_F(GeoPackageParserTest, ParallelDecodingMatchesInline) {
+  for (const auto& path : {kTwoLaneRoadPath, kTwoLaneRoadGpbPath, kTShapeRoadPath}) {
+    const GeoPackageParser inline_parser(path);
+    for (const int parser_threads : {0, 2, 4}) {
+      const GeoPackageParser parallel_parser(path, ParserConfiguration{parser_threads});
+      EXPECT_EQ(parallel_parser.GetJunctions(), inline_parser.GetJunctions()) << path;
+      EXPECT_EQ(parallel_parser.GetConnections(), inline_parser.GetConnections()) << path;
+    }
+  }
+}
+
+// Collects the ids of every parsed lane.
+std::set<std::string> LaneIds(const GeoPackageParser& parser) {
+  std::set<std::string> lane_ids;
+  for (const auto& [junction_id, junction] : parser.GetJunctions()) {
+    for (const auto& [segment_id, segment] : junction.segments) {
+      for (const auto& lane : segment.lanes) {
+        lane_ids.insert(lane.id);
+      }
+    }
+  }
+  return lane_ids;
+}
+
+TEST_F(GeoPackageParserTest, LoadRegionTruncatesConnectivity) {
+  ParserConfiguration config;
+  config.load_region = Region2d{0., -3.5, 30., 3.5};
+  config.boundary_policy = BoundaryPolicy::kTruncate;
+  const GeoPackageParser parser(kTShapeRoadPath, config);
+
+  EXPECT_EQ(LaneIds(parser), (std::set<std::string>{"west_l1", "west_l2"}));
+  ASSERT_EQ(parser.GetJunctions().size(), 1u);
+  EXPECT_EQ(parser.GetJunctions().count("j_west"), 1u);
+  // The junction-side branch point keeps no b-side lane, so no connection survives.
+  EXPECT_TRUE(parser.GetConnections().empty());
+
+  const auto& lanes = parser.GetJunctions().at("j_west").segments.at("j_west_s1").lanes;
+  for (const auto& lane : lanes) {
+    EXPECT_TRUE(lane.left_lane_id.has_value() || lane.right_lane_id.has_value());
+  }
+}
+
+TEST_F(GeoPackageParserTest, LoadRegionExpandsToClosure) {
+  ParserConfiguration config;
+  config.load_region = Region2d{0., -3.5, 30., 3.5};
+  config.boundary_policy = BoundaryPolicy::kClosure;
+  const GeoPackageParser parser(kTShapeRoadPath, config);
+
+  EXPECT_EQ(LaneIds(parser), (std::set<std::string>{"west_l1", "west_l2", "int_straight_l1", "int_straight_l2",
+                                                    "int_west_south", "int_south_west"}));
+  // Every a-side lane of bp_west_jct connects to its four b-side lanes.
+  EXPECT_EQ(parser.GetConnections().size(), 8u);
+  for (const auto& connection : parser.GetConnections()) {
+    EXPECT_EQ(LaneIds(parser).count(connection.from.lane_id), 1u);
+    EXPECT_EQ(LaneIds(parser).count(connection.to.lane_id), 1u);
+  }
+}
+
+TEST_F(GeoPackageParserTest, LoadRegionCoveringEverythingMatchesFullLoad) {
+  ParserConfiguration config;
+  config.load_region = Region2d{-1e3, -1e3, 1e3, 1e3};
+  const GeoPackageParser region_parser(kTShapeRoadPath, config);
+  const GeoPackageParser full_parser(kTShapeRoadPath);
+
+  EXPECT_EQ(region_parser.GetJunctions(), full_parser.GetJunctions());
+  EXPECT_EQ(region_parser.GetConnections().size(), full_parser.GetConnections().size());
+}
+
+// Copies `source` to `destination` and adds the bbox_* lane extent columns to it.
+void CopyDatabase(const std::string& source, const std::string& destination) {
+  std::remove(destination.c_str());
+  sqlite3* db{nullptr};
+  ASSERT_EQ(sqlite3_open(source.c_str(), &db), SQLITE_OK);
+  ASSERT_EQ(sqlite3_exec(db, ("VACUUM INTO '" + destination + "'").c_str(), nullptr, nullptr, nullptr), SQLITE_OK);
+  sqlite3_close(db);
+}
+
+void CopyWithLaneExtents(const std::string& source, const std::string& destination) {
+  CopyDatabase(source, destination);
+  sqlite3* db{nullptr};
+  ASSERT_EQ(sqlite3_open(destination.c_str(), &db), SQLITE_OK);
+  ASSERT_EQ(sqlite3_exec(db,
+                         "ALTER TABLE lanes ADD COLUMN bbox_min_x REAL;"
+                         "ALTER TABLE lanes ADD COLUMN bbox_max_x REAL;"
+                         "ALTER TABLE lanes ADD COLUMN bbox_min_y REAL;"
+                         "ALTER TABLE lanes ADD COLUMN bbox_max_y REAL;",
+                         nullptr, nullptr, nullptr),
+            SQLITE_OK);
+  sqlite3_stmt* select_stmt;
+  sqlite3_stmt* update_stmt;
+  ASSERT_EQ(sqlite3_prepare_v2(db, "SELECT lane_id, left_boundary, right_boundary FROM lanes", -1, &select_stmt, nullptr),
+            SQLITE_OK);
+  ASSERT_EQ(sqlite3_prepare_v2(db,
+                               "UPDATE lanes SET bbox_min_x = ?2, bbox_max_x = ?3, bbox_min_y = ?4, bbox_max_y = ?5 "
+                               "WHERE lane_id = ?1",
+                               -1, &update_stmt, nullptr),
+            SQLITE_OK);
+  std::vector<std::pair<std::string, std::vector<maliput::math::Vector3>>> lanes;
+  while (sqlite3_step(select_stmt) == SQLITE_ROW) {
+    auto points = ParseLineStringZ(reinterpret_cast<const char*>(sqlite3_column_text(select_stmt, 1)));
+    const auto right = ParseLineStringZ(reinterpret_cast<const char*>(sqlite3_column_text(select_stmt, 2)));
+    points.insert(points.end(), right.begin(), right.end());
+    lanes.emplace_back(reinterpret_cast<const char*>(sqlite3_column_text(select_stmt, 0)), points);
+  }
+  sqlite3_finalize(select_stmt);
+  for (const auto& [lane_id, points] : lanes) {
+    const auto [min_x, max_x] = std::minmax_element(points.begin(), points.end(),
+                                                    [](const auto& a, const auto& b) { return a.x() < b.x(); });
+    const auto [min_y, max_y] = std::minmax_element(points.begin(), points.end(),
+                                                    [](const auto& a, const auto& b) { return a.y() < b.y(); });
+    sqlite3_bind_text(update_stmt, 1, lane_id.c_str(), -1, SQLITE_TRANSIENT);
+    sqlite3_bind_double(update_stmt, 2, min_x->x());
+    sqlite3_bind_double(update_stmt, 3, max_x->x());
+    sqlite3_bind_double(update_stmt, 4, min_y->y());
+    sqlite3_bind_double(update_stmt, 5, max_y->y());
+    ASSERT_EQ(sqlite3_step(update_stmt), SQLITE_DONE);
+    sqlite3_reset(update_stmt);
+  }
+  sqlite3_finalize(update_stmt);
+  sqlite3_close(db);
+}
+
+TEST_F(GeoPackageParserTest, JunctionAllowList) {
+  ParserConfiguration config;
+  config.junction_ids = {"j_west", "j_unknown"};
+  {
+    const GeoPackageParser parser(kTShapeRoadPath, config);
+    EXPECT_EQ(LaneIds(parser), (std::set<std::string>{"west_l1", "west_l2"}));
+    ASSERT_EQ(parser.GetJunctions().size(), 1u);
+    EXPECT_TRUE(parser.GetConnections().empty());
+  }
+  {
+    config.boundary_policy = BoundaryPolicy::kClosure;
+    const GeoPackageParser parser(kTShapeRoadPath, config);
+    EXPECT_EQ(LaneIds(parser), (std::set<std::string>{"west_l1", "west_l2", "int_straight_l1", "int_straight_l2",
+                                                      "int_west_south", "int_south_west"}));
+    EXPECT_EQ(parser.GetJunctions().size(), 2u);
+  }
+}
+
+TEST_F(GeoPackageParserTest, ExpansionHops) {
+  ParserConfiguration config;
+  config.junction_ids = {"j_west"};
+  config.expansion_hops = 1;
+  {
+    // One hop reaches the lanes sharing a branch point, without completing their segments.
+    const GeoPackageParser parser(kTShapeRoadPath, config);
+    EXPECT_EQ(LaneIds(parser), (std::set<std::string>{"west_l1", "west_l2", "int_straight_l1", "int_straight_l2",
+                                                      "int_west_south", "int_south_west"}));
+    for (const auto& connection : parser.GetConnections()) {
+      EXPECT_EQ(LaneIds(parser).count(connection.from.lane_id), 1u);
+      EXPECT_EQ(LaneIds(parser).count(connection.to.lane_id), 1u);
+    }
+  }
+  {
+    // Enough hops reach the whole connected map.
+    config.expansion_hops = 10;
+    const GeoPackageParser parser(kTShapeRoadPath, config);
+    const GeoPackageParser full_parser(kTShapeRoadPath);
+    EXPECT_EQ(parser.GetJunctions(), full_parser.GetJunctions());
+    EXPECT_EQ(parser.GetConnections().size(), full_parser.GetConnections().size());
+  }
+}
+
+TEST_F(GeoPackageParserTest, LaneTypeAllowList) {
+  const std::string path = ::testing::TempDir() + "t_shape_road_lane_types.gpkg";
+  CopyDatabase(kTShapeRoadPath, path);
+  {
+    sqlite3* db{nullptr};
+    ASSERT_EQ(sqlite3_open(path.c_str(), &db), SQLITE_OK);
+    Execute(db, "UPDATE lanes SET lane_type = 'shoulder' WHERE lane_id IN ('west_l2', 'int_straight_l2')");
+    sqlite3_close(db);
+  }
+
+  ParserConfiguration config;
+  config.lane_types = {"driving"};
+  {
+    const GeoPackageParser parser(path, config);
+    const std::set<std::string> lane_ids = LaneIds(parser);
+    EXPECT_EQ(lane_ids.size(), 10u);
+    EXPECT_EQ(lane_ids.count("west_l2"), 0u);
+    EXPECT_EQ(lane_ids.count("int_straight_l2"), 0u);
+    // Branch points and adjacencies keep the loaded lanes only.
+    for (const auto& connection : parser.GetConnections()) {
+      EXPECT_EQ(lane_ids.count(connection.from.lane_id), 1u);
+      EXPECT_EQ(lane_ids.count(connection.to.lane_id), 1u);
+    }
+    const auto& west_lanes = parser.GetJunctions().at("j_west").segments.at("j_west_s1").lanes;
+    ASSERT_EQ(west_lanes.size(), 1u);
+    EXPECT_FALSE(west_lanes[0].left_lane_id.has_value());
+    EXPECT_FALSE(west_lanes[0].right_lane_id.has_value());
+  }
+  {
+    // Expansions skip the other types too.
+    config.junction_ids = {"j_west"};
+    config.boundary_policy = BoundaryPolicy::kClosure;
+    const GeoPackageParser parser(path, config);
+    EXPECT_EQ(LaneIds(parser),
+              (std::set<std::string>{"west_l1", "int_straight_l1", "int_west_south", "int_south_west"}));
+  }
+  std::remove(path.c_str());
+}
+
+TEST_F(GeoPackageParserTest, LoadRegionUsesLaneExtentColumns) {
+  const std::string path = ::testing::TempDir() + "t_shape_road_extents.gpkg";
+  CopyWithLaneExtents(kTShapeRoadPath, path);
+
+  for (const auto policy : {BoundaryPolicy::kTruncate, BoundaryPolicy::kClosure}) {
+    ParserConfiguration config;
+    config.load_region = Region2d{45., -10., 55., 1.};
+    config.boundary_policy = policy;
+    const GeoPackageParser extents_parser(path, config);
+    const GeoPackageParser decoding_parser(kTShapeRoadPath, config);
+
+    EXPECT_FALSE(LaneIds(extents_parser).empty());
+    EXPECT_EQ(LaneIds(extents_parser), LaneIds(decoding_parser));
+    EXPECT_EQ(extents_parser.GetConnections().size(), decoding_parser.GetConnections().size());
+  }
+  std::remove(path.c_str());
+}
+
+TEST_F(GeoPackageParserTest, LaneIndexColumnOrdersLanes) {
+  const std::string path = ::testing::TempDir() + "two_lane_road_lane_index.gpkg";
+  CopyDatabase(kTwoLaneRoadPath, path);
+  const auto execute = [&path](const std::string& sql) {
+    sqlite3* db{nullptr};
+    ASSERT_EQ(sqlite3_open(path.c_str(), &db), SQLITE_OK);
+    Execute(db, sql);
+    sqlite3_close(db);
+  };
+  // j1_s1_lane2 is the rightmost lane. Adjacency rows are dropped to show they are not read.
+  execute(
+      "ALTER TABLE lanes ADD COLUMN lane_index INTEGER;"
+      "UPDATE lanes SET lane_index = 0 WHERE lane_id = 'j1_s1_lane2';"
+      "UPDATE lanes SET lane_index = 1 WHERE lane_id = 'j1_s1_lane1';"
+      "DELETE FROM adjacent_lanes;");
+  {
+    const GeoPackageParser parser(path);
+    const GeoPackageParser expected_parser(kTwoLaneRoadPath);
+    EXPECT_EQ(parser.GetJunctions(), expected_parser.GetJunctions());
+    const auto& lanes = parser.GetJunctions().at("j1").segments.at("j1_s1").lanes;
+    ASSERT_EQ(lanes.size(), 2u);
+    EXPECT_EQ(lanes[0].id, "j1_s1_lane2");
+    EXPECT_EQ(lanes[0].left_lane_id.value(), "j1_s1_lane1");
+    EXPECT_EQ(lanes[1].right_lane_id.value(), "j1_s1_lane2");
+    EXPECT_EQ(parser.stats().adjacent_lane_rows, 0);
+  }
+  {
+    // Positions that are not consecutive are not adjacent.
+    execute("UPDATE lanes SET lane_index = 2 WHERE lane_id = 'j1_s1_lane1'");
+    const GeoPackageParser parser(path);
+    const auto& lanes = parser.GetJunctions().at("j1").segments.at("j1_s1").lanes;
+    ASSERT_EQ(lanes.size(), 2u);
+    EXPECT_EQ(lanes[0].id, "j1_s1_lane2");
+    EXPECT_FALSE(lanes[0].left_lane_id.has_value());
+    EXPECT_FALSE(lanes[1].right_lane_id.has_value());
+  }
+  {
+    // A NULL position falls back to adjacent_lanes, which is empty now.
+    execute("UPDATE lanes SET lane_index = NULL WHERE lane_id = 'j1_s1_lane1'");
+    const GeoPackageParser parser(path);
+    for (const auto& lane : parser.GetJunctions().at("j1").segments.at("j1_s1").lanes) {
+      EXPECT_FALSE(lane.left_lane_id.has_value());
+      EXPECT_FALSE(lane.right_lane_id.has_value());
+    }
+  }
+  std::remove(path.c_str());
+}
+
+TEST_F(GeoPackageParserTest, LaneIndexAdjacencySkipsFilteredLanes) {
+  const std::string path = ::testing::TempDir() + "two_lane_road_filtered_lane_index.gpkg";
+  CopyDatabase(kTwoLaneRoadPath, path);
+  {
+    // A shoulder is inserted between both lanes, reusing the geometry of j1_s1_lane1.
+    sqlite3* db{nullptr};
+    ASSERT_EQ(sqlite3_open(path.c_str(), &db), SQLITE_OK);
+    Execute(db,
+            "ALTER TABLE lanes ADD COLUMN lane_index INTEGER;"
+            "UPDATE lanes SET lane_index = 0 WHERE lane_id = 'j1_s1_lane2';"
+            "UPDATE lanes SET lane_index = 2 WHERE lane_id = 'j1_s1_lane1';"
+            "CREATE TEMP TABLE shoulder AS SELECT * FROM lanes WHERE lane_id = 'j1_s1_lane1';"
+            "UPDATE shoulder SET lane_id = 'j1_s1_shoulder', lane_type = 'shoulder', lane_index = 1;"
+            "INSERT INTO lanes SELECT * FROM shoulder;"
+            "DELETE FROM adjacent_lanes;");
+    sqlite3_close(db);
+  }
+  {
+    const GeoPackageParser parser(path);
+    const auto& lanes = parser.GetJunctions().at("j1").segments.at("j1_s1").lanes;
+    ASSERT_EQ(lanes.size(), 3u);
+    EXPECT_EQ(lanes[0].left_lane_id.value(), "j1_s1_shoulder");
+    EXPECT_EQ(lanes[1].right_lane_id.value(), "j1_s1_lane2");
+    EXPECT_EQ(lanes[1].left_lane_id.value(), "j1_s1_lane1");
+    EXPECT_EQ(lanes[2].right_lane_id.value(), "j1_s1_shoulder");
+  }
+  {
+    // Dropping the shoulder leaves a gap in the positions, so the lanes around it are not adjacent.
+    ParserConfiguration config;
+    config.lane_types = {"driving"};
+    const GeoPackageParser parser(path, config);
+    const auto& lanes = parser.GetJunctions().at("j1").segments.at("j1_s1").lanes;
+    ASSERT_EQ(lanes.size(), 2u);
+    EXPECT_EQ(lanes[0].id, "j1_s1_lane2");
+    EXPECT_EQ(lanes[1].id, "j1_s1_lane1");
+    for (const auto& lane : lanes) {
+      EXPECT_FALSE(lane.left_lane_id.has_value());
+      EXPECT_FALSE(lane.right_lane_id.has_value());
+    }
+  }
+  std::remove(path.c_str());
+}
+
+TEST_F(GeoPackageParserTest, NullLaneIndexOnlyUnordersItsSegment) {
+  const std::string path = ::testing::TempDir() + "t_shape_road_null_lane_index.gpkg";
+  CopyDatabase(kTShapeRoadPath, path);
+  {
+    sqlite3* db{nullptr};
+    ASSERT_EQ(sqlite3_open(path.c_str(), &db), SQLITE_OK);
+    // Only the adjacency rows of j_west_s1, whose west_l1 has no position, are kept.
+    Execute(db,
+            "ALTER TABLE lanes ADD COLUMN lane_index INTEGER DEFAULT 0;"
+            "UPDATE lanes SET lane_index = 1 WHERE lane_id IN ('east_l1', 'south_l2', 'int_straight_l1');"
+            "UPDATE lanes SET lane_index = NULL WHERE lane_id = 'west_l1';"
+            "DELETE FROM adjacent_lanes WHERE lane_id NOT IN ('west_l1', 'west_l2');");
+    sqlite3_close(db);
+  }
+  const GeoPackageParser parser(path);
+  const GeoPackageParser expected_parser(kTShapeRoadPath);
+  EXPECT_EQ(parser.GetJunctions(), expected_parser.GetJunctions());
+  EXPECT_EQ(parser.stats().adjacent_lane_rows, 2);
+  std::remove(path.c_str());
+}
+
+TEST_F(GeoPackageParserTest, SharedBoundaries) {
+  // Moves every distinct boundary to the boundaries table, except the left one of west_l1.
+  const std::string path = ::testing::TempDir() + "t_shape_road_shared_boundaries.gpkg";
+  CopyDatabase(kTShapeRoadPath, path);
+  {
+    sqlite3* db{nullptr};
+    ASSERT_EQ(sqlite3_open(path.c_str(), &db), SQLITE_OK);
+    Execute(db,
+            "CREATE TABLE boundaries (boundary_id TEXT PRIMARY KEY, geometry TEXT NOT NULL);"
+            "INSERT INTO boundaries (boundary_id, geometry) SELECT 'b' || ROW_NUMBER() OVER (), geometry FROM "
+            "  (SELECT left_boundary AS geometry FROM lanes UNION SELECT right_boundary FROM lanes);"
+            "ALTER TABLE lanes RENAME TO inline_lanes;"
+            "CREATE TABLE lanes (lane_id TEXT PRIMARY KEY, segment_id TEXT NOT NULL, lane_type TEXT, direction TEXT, "
+            "  left_boundary TEXT, right_boundary TEXT, left_boundary_id TEXT, right_boundary_id TEXT);"
+            "INSERT INTO lanes SELECT lane_id, segment_id, lane_type, direction, "
+            "  CASE WHEN lane_id = 'west_l1' THEN left_boundary END, NULL, "
+            "  CASE WHEN lane_id = 'west_l1' THEN NULL "
+            "    ELSE (SELECT boundary_id FROM boundaries WHERE geometry = left_boundary) END, "
+            "  (SELECT boundary_id FROM boundaries WHERE geometry = right_boundary) "
+            "  FROM inline_lanes ORDER BY rowid;"
+            "DROP TABLE inline_lanes;");
+    sqlite3_close(db);
+  }
+
+  const GeoPackageParser expected_parser(kTShapeRoadPath);
+  for (const int threads : {1, 2}) {
+    ParserConfiguration config;
+    config.parser_threads = threads;
+    const GeoPackageParser parser(path, config);
+    EXPECT_EQ(parser.GetJunctions(), expected_parser.GetJunctions());
+    EXPECT_EQ(parser.GetConnections(), expected_parser.GetConnections());
+    EXPECT_EQ(parser.stats().boundary_rows, 20);
+    EXPECT_LT(parser.stats().geometry_bytes_read, expected_parser.stats().geometry_bytes_read);
+  }
+
+  // Partial loads only decode the boundaries of the selected lanes.
+  ParserConfiguration config;
+  config.junction_ids = {"j_west"};
+  const GeoPackageParser parser(path, config);
+  EXPECT_EQ(parser.GetJunctions(), GeoPackageParser(kTShapeRoadPath, config).GetJunctions());
+  EXPECT_EQ(parser.stats().boundary_rows, 2);
+
+  // Lanes referencing an unknown boundary are skipped.
+  {
+    sqlite3* db{nullptr};
+    ASSERT_EQ(sqlite3_open(path.c_str(), &db), SQLITE_OK);
+    Execute(db, "UPDATE lanes SET right_boundary_id = 'unknown' WHERE lane_id = 'west_l2'");
+    sqlite3_close(db);
+  }
+  EXPECT_EQ(LaneIds(GeoPackageParser(path)).count("west_l2"), 0u);
+  std::remove(path.c_str());
+}
+
+// @returns The distance from `p` to the polyline through `line`.
+double DistanceToLineString(const maliput::math::Vector3& p, const maliput_sparse::geometry::LineString3d& line) {
+  double distance = std::numeric_limits<double>::infinity();
+  for (size_t i = 1; i < line.size(); ++i) {
+    const maliput::math::Vector3 ab = line.at(i) - line.at(i - 1);
+    const double length_squared = ab.dot(ab);
+    const double t = length_squared > 0. ? std::clamp((p - line.at(i - 1)).dot(ab) / length_squared, 0., 1.) : 0.;
+    distance = std::min(distance, (p - (line.at(i - 1) + t * ab)).norm());
+  }
+  return distance;
+}
+
+TEST_F(GeoPackageParserTest, SimplifyBoundaries) {
+  // Resamples every boundary every few centimetres, with a millimetre of noise, as surveyed maps are.
+  const std::string path = ::testing::TempDir() + "t_shape_road_dense.gpkg";
+  CopyDatabase(kTShapeRoadPath, path);
+  std::map<std::string, std::vector<maliput::math::Vector3>> dense_boundaries;
+  {
+    sqlite3* db{nullptr};
+    ASSERT_EQ(sqlite3_open(path.c_str(), &db), SQLITE_OK);
+    std::map<std::pair<std::string, std::string>, std::string> updates;
+    sqlite3_stmt* stmt{nullptr};
+    ASSERT_EQ(sqlite3_prepare_v2(db, "SELECT lane_id, left_boundary, right_boundary FROM lanes", -1, &stmt, nullptr),
+              SQLITE_OK);
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+      const std::string lane_id = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+      for (const int col : {1, 2}) {
+        const auto points = ParseLineStringZ(reinterpret_cast<const char*>(sqlite3_column_text(stmt, col)));
+        auto& dense = dense_boundaries[lane_id + (col == 1 ? "/left" : "/right")];
+        for (size_t i = 0; i + 1 < points.size(); ++i) {
+          for (int k = 0; k < 200; ++k) {
+            dense.push_back(points[i] + (k / 200.) * (points[i + 1] - points[i]) +
+                            maliput::math::Vector3(0., 0., 1e-3 * std::sin(dense.size())));
+          }
+        }
+        dense.push_back(points.back());
+        std::ostringstream wkt;
+        wkt.precision(17);
+        wkt << "LINESTRINGZ(";
+        for (size_t i = 0; i < dense.size(); ++i) {
+          wkt << (i == 0 ? "" : ", ") << dense[i].x() << " " << dense[i].y() << " " << dense[i].z();
+        }
+        wkt << ")";
+        updates[{lane_id, col == 1 ? "left_boundary" : "right_boundary"}] = wkt.str();
+      }
+    }
+    sqlite3_finalize(stmt);
+    for (const auto& [key, wkt] : updates) {
+      ASSERT_EQ(sqlite3_prepare_v2(db, ("UPDATE lanes SET " + key.second + " = ? WHERE lane_id = ?").c_str(), -1,
+                                   &stmt, nullptr),
+                SQLITE_OK);
+      sqlite3_bind_text(stmt, 1, wkt.c_str(), -1, SQLITE_TRANSIENT);
+      sqlite3_bind_text(stmt, 2, key.first.c_str(), -1, SQLITE_TRANSIENT);
+      EXPECT_EQ(sqlite3_step(stmt), SQLITE_DONE);
+      sqlite3_finalize(stmt);
+    }
+    sqlite3_close(db);
+  }
+
+  const GeoPackageParser dense_parser(path);
+  EXPECT_EQ(dense_parser.stats().points_kept, dense_parser.stats().points_decoded);
+
+  constexpr double kTolerance{1e-2};
+  for (const auto simplification : {BoundarySimplification::kSimplify, BoundarySimplification::kSimplifyAndMatch}) {
+    ParserConfiguration config;
+    config.boundary_simplification = simplification;
+    config.simplification_tolerance = kTolerance;
+    const GeoPackageParser parser(path, config);
+    EXPECT_EQ(parser.GetConnections(), dense_parser.GetConnections());
+    EXPECT_EQ(parser.stats().points_decoded, dense_parser.stats().points_decoded);
+    EXPECT_LT(10 * parser.stats().points_kept, parser.stats().points_decoded);
+    EXPECT_EQ(parser.stats().phases[5].name, "simplify_boundaries");
+
+    int64_t points_kept{0};
+    for (const auto& [junction_id, junction] : parser.GetJunctions()) {
+      for (const auto& [segment_id, segment] : junction.segments) {
+        for (const auto& lane : segment.lanes) {
+          points_kept += static_cast<int64_t>(lane.left.size() + lane.right.size());
+          if (simplification == BoundarySimplification::kSimplifyAndMatch) {
+            EXPECT_EQ(lane.left.size(), lane.right.size()) << lane.id;
+          }
+          for (const auto& point : dense_boundaries.at(lane.id + "/left")) {
+            ASSERT_LE(DistanceToLineString(point, lane.left), kTolerance) << lane.id;
+          }
+          for (const auto& point : dense_boundaries.at(lane.id + "/right")) {
+            ASSERT_LE(DistanceToLineString(point, lane.right), kTolerance) << lane.id;
+          }
+        }
+      }
+    }
+    EXPECT_EQ(points_kept, parser.stats().points_kept);
+
+    // Lanes are simplified on several threads with the same outcome.
+    config.parser_threads = 3;
+    EXPECT_EQ(GeoPackageParser(path, config).GetJunctions(), parser.GetJunctions());
+  }
+  std::remove(path.c_str());
+}
+
+TEST_F(GeoPackageParserTest, Centerlines) {
+  EXPECT_TRUE(GeoPackageParser(kTShapeRoadPath).centerlines().empty());
+
+  for (const int threads : {1, 2}) {
+    ParserConfiguration config;
+    config.parser_threads = threads;
+    config.read_centerlines = true;
+    const GeoPackageParser parser(kTShapeRoadPath, config);
+    EXPECT_EQ(parser.stats().phases[5].name, "parse_centerlines");
+    const auto& centerlines = parser.centerlines();
+    ASSERT_EQ(centerlines.size(), LaneIds(parser).size());
+    for (const auto& [junction_id, junction] : parser.GetJunctions()) {
+      for (const auto& [segment_id, segment] : junction.segments) {
+        for (const auto& lane : segment.lanes) {
+          // The stored centerlines run midway between the boundaries.
+          const LaneCenterline& centerline = centerlines.at(lane.id);
+          ASSERT_GE(centerline.points.size(), 2u);
+          ASSERT_EQ(centerline.arc_lengths.size(), centerline.points.size());
+          EXPECT_LT((centerline.points.front() - 0.5 * (lane.left.first() + lane.right.first())).norm(), 1e-9);
+          EXPECT_LT((centerline.points.back() - 0.5 * (lane.left.last() + lane.right.last())).norm(), 1e-9);
+          EXPECT_EQ(centerline.arc_lengths.front(), 0.);
+          for (size_t i = 1; i < centerline.points.size(); ++i) {
+            EXPECT_NEAR(centerline.arc_lengths[i] - centerline.arc_lengths[i - 1],
+                        (centerline.points[i] - centerline.points[i - 1]).norm(), 1e-9);
+          }
+        }
+      }
+    }
+    EXPECT_NEAR(centerlines.at("west_l2").arc_lengths.back(), 46., 1e-9);
+  }
+
+  // Only centerlines of the loaded lanes are read.
+  ParserConfiguration config;
+  config.junction_ids = {"j_west"};
+  config.read_centerlines = true;
+  const GeoPackageParser partial_parser(kTShapeRoadPath, config);
+  ASSERT_EQ(partial_parser.centerlines().size(), 2u);
+  EXPECT_EQ(partial_parser.centerlines().count("west_l1"), 1u);
+
+  // Stored arc lengths are used as they are.
+  const std::string path = ::testing::TempDir() + "t_shape_road_centerline_s.gpkg";
+  CopyDatabase(kTShapeRoadPath, path);
+  const std::vector<maliput::math::Vector3>& west_l2 = partial_parser.centerlines().at("west_l2").points;
+  std::vector<double> arc_lengths(west_l2.size());
+  for (size_t i = 0; i < arc_lengths.size(); ++i) arc_lengths[i] = 2. * static_cast<double>(i);
+  const auto set_arc_lengths = [&path](const std::vector<double>& values) {
+    sqlite3* db{nullptr};
+    ASSERT_EQ(sqlite3_open(path.c_str(), &db), SQLITE_OK);
+    Execute(db, "ALTER TABLE lanes ADD COLUMN centerline_s BLOB");
+    sqlite3_stmt* stmt{nullptr};
+    ASSERT_EQ(sqlite3_prepare_v2(db, "UPDATE lanes SET centerline_s = ?1 WHERE lane_id = 'west_l2'", -1, &stmt, nullptr),
+              SQLITE_OK);
+    // Little-endian hosts store doubles in the column's byte order.
+    std::string bytes(values.size() * sizeof(double), '\0');
+    std::memcpy(bytes.data(), values.data(), bytes.size());
+    sqlite3_bind_blob(stmt, 1, bytes.data(), static_cast<int>(bytes.size()), SQLITE_TRANSIENT);
+    EXPECT_EQ(sqlite3_step(stmt), SQLITE_DONE);
+    sqlite3_finalize(stmt);
+    sqlite3_close(db);
+  };
+  set_arc_lengths(arc_lengths);
+  for (const int threads : {1, 2}) {
+    ParserConfiguration centerline_config;
+    centerline_config.parser_threads = threads;
+    centerline_config.read_centerlines = true;
+    centerline_config.use_snapshot_cache = true;
+    centerline_config.snapshot_cache_dir = ::testing::TempDir();
+    const GeoPackageParser parser(path, centerline_config);
+    EXPECT_EQ(parser.centerlines().at("west_l2").arc_lengths, arc_lengths);
+    EXPECT_NEAR(parser.centerlines().at("west_l1").arc_lengths.back(), 46., 1e-9);
+    // Snapshots do not hold centerlines.
+    EXPECT_FALSE(parser.stats().loaded_from_snapshot);
+  }
+
+  // One arc length per vertex is required.
+  CopyDatabase(kTShapeRoadPath, path);
+  arc_lengths.pop_back();
+  set_arc_lengths(arc_lengths);
+  ParserConfiguration centerline_config;
+  centerline_config.read_centerlines = true;
+  EXPECT_THROW(GeoPackageParser(path, centerline_config), std::runtime_error);
+  std::remove(path.c_str());
+}
+
+TEST_F(GeoPackageParserTest, BuildSpatialIndexPersistsIt) {
+  const std::string path = ::testing::TempDir() + "t_shape_road_rtree.gpkg";
+  CopyDatabase(kTShapeRoadPath, path);
+  const auto count_indexed_lanes = [&path]() {
+    sqlite3* db{nullptr};
+    EXPECT_EQ(sqlite3_open(path.c_str(), &db), SQLITE_OK);
+    const int64_t count = HasLaneSpatialIndex(db) ? CountRows(db, kLaneSpatialIndexTable) : -1;
+    sqlite3_close(db);
+    return count;
+  };
+  ASSERT_EQ(count_indexed_lanes(), -1);
+
+  ParserConfiguration config;
+  config.build_spatial_index = true;
+  const GeoPackageParser full_parser(path, config);
+  EXPECT_EQ(count_indexed_lanes(), static_cast<int64_t>(LaneIds(full_parser).size()));
+  EXPECT_EQ(LaneIds(full_parser), LaneIds(GeoPackageParser(kTShapeRoadPath)));
+
+  // The index is reused rather than rebuilt, and selects the same lanes as decoding every boundary.
+  for (const auto policy : {BoundaryPolicy::kTruncate, BoundaryPolicy::kClosure}) {
+    ParserConfiguration region_config;
+    region_config.load_region = Region2d{45., -10., 55., 1.};
+    region_config.boundary_policy = policy;
+    const GeoPackageParser index_parser(path, region_config);
+    const GeoPackageParser decoding_parser(kTShapeRoadPath, region_config);
+
+    EXPECT_FALSE(LaneIds(index_parser).empty());
+    EXPECT_EQ(LaneIds(index_parser), LaneIds(decoding_parser));
+    EXPECT_EQ(index_parser.GetConnections().size(), decoding_parser.GetConnections().size());
+  }
+  EXPECT_EQ(count_indexed_lanes(), static_cast<int64_t>(LaneIds(full_parser).size()));
+  std::remove(path.c_str());
+}
+
+TEST_F(GeoPackageParserTest, SnapshotCache) {
+  const std::string path = ::testing::TempDir() + "t_shape_road_cached.gpkg";
+  CopyDatabase(kTShapeRoadPath, path);
+  ParserConfiguration config;
+  config.use_snapshot_cache = true;
+  const std::string snapshot_path = SnapshotPath(path, "", ComputeSnapshotKey(path, config));
+  std::remove(snapshot_path.c_str());
+  const GeoPackageParser reference_parser(kTShapeRoadPath);
+
+  {
+    const GeoPackageParser parser(path, config);
+    ASSERT_TRUE(std::ifstream(snapshot_path).good());
+    EXPECT_EQ(parser.GetJunctions(), reference_parser.GetJunctions());
+  }
+  {
+    const GeoPackageParser parser(path, config);
+    EXPECT_EQ(parser.GetJunctions(), reference_parser.GetJunctions());
+    EXPECT_EQ(parser.GetConnections(), reference_parser.GetConnections());
+  }
+  {
+    // A corrupt snapshot falls back to parsing, and is replaced.
+    std::ofstream(snapshot_path, std::ios::binary | std::ios::trunc) << "garbage";
+    const GeoPackageParser parser(path, config);
+    EXPECT_EQ(parser.GetJunctions(), reference_parser.GetJunctions());
+    EXPECT_EQ(parser.GetConnections(), reference_parser.GetConnections());
+    EXPECT_GT(std::ifstream(snapshot_path, std::ios::ate | std::ios::binary).tellg(), 7);
+  }
+  std::remove(snapshot_path.c_str());
+  std::remove(path.c_str());
+}
+
+TEST_F(GeoPackageParserTest, SqliteTuningMatchesDefaults) {
+  // Characters with a meaning in URIs must survive the immutable open.
+  const std::string path = ::testing::TempDir() + "t shape?road#50%.gpkg";
+  CopyDatabase(kTShapeRoadPath, path);
+  const GeoPackageParser reference_parser(kTShapeRoadPath);
+
+  ParserConfiguration config;
+  config.sqlite_immutable = true;
+  config.sqlite_mmap_size = 1 << 24;
+  config.sqlite_cache_size_kib = 8192;
+  config.read_ahead = true;
+  for (const int parser_threads : {1, 2}) {
+    config.parser_threads = parser_threads;
+    const GeoPackageParser parser(path, config);
+    EXPECT_EQ(parser.GetJunctions(), reference_parser.GetJunctions());
+    EXPECT_EQ(parser.GetConnections(), reference_parser.GetConnections());
+  }
+  std::remove(path.c_str());
+}
+
+TEST_F(GeoPackageParserTest, Stats) {
+  const GeoPackageParser parser(kTShapeRoadPath);
+  const ParserStats& stats = parser.stats();
+
+  std::vector<std::string> phase_names;
+  for (const auto& phase : stats.phases) {
+    phase_names.push_back(phase.name);
+    EXPECT_GE(phase.seconds, 0.);
+  }
+  EXPECT_EQ(phase_names, (std::vector<std::string>{"open_database", "parse_metadata", "select_lanes", "parse_junctions",
+                                                   "parse_segments_and_lanes", "build_branch_point_connections",
+                                                   "build_lane_adjacency", "materialize_junctions"}));
+  EXPECT_FALSE(stats.loaded_from_snapshot);
+  EXPECT_EQ(stats.junction_rows, 4);
+  EXPECT_EQ(stats.segment_rows, 8);
+  EXPECT_EQ(stats.lane_rows, 12);
+  EXPECT_EQ(stats.junctions, 4);
+  EXPECT_EQ(stats.segments, 8);
+  EXPECT_EQ(stats.lanes, 12);
+  EXPECT_EQ(stats.connections, static_cast<int64_t>(parser.GetConnections().size()));
+  EXPECT_GT(stats.branch_point_lane_rows, 0);
+  EXPECT_GT(stats.adjacent_lane_rows, 0);
+  EXPECT_GT(stats.geometry_bytes_read, 0);
+
+  int64_t num_points{0};
+  for (const auto& [junction_id, junction] : parser.GetJunctions()) {
+    for (const auto& [segment_id, segment] : junction.segments) {
+      for (const auto& lane : segment.lanes) {
+        num_points += static_cast<int64_t>(lane.left.size() + lane.right.size());
+      }
+    }
+  }
+  EXPECT_EQ(stats.points_decoded, num_points);
+  EXPECT_EQ(GeoPackageParser(kTShapeRoadPath, ParserConfiguration{4}).stats().geometry_bytes_read,
+            stats.geometry_bytes_read);
+}
+
+// Reads the whole file at `path`.
+std::string ReadFile(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+TEST_F(GeoPackageParserTest, ReportsProgress) {
+  std::vector<std::string> reported_phases;
+  int64_t last_rows{0};
+  ParserConfiguration config;
+  config.on_progress = [&](const ParseProgress& progress) {
+    EXPECT_GE(progress.rows, last_rows);
+    last_rows = progress.rows;
+    reported_phases.push_back(progress.phase);
+  };
+  const GeoPackageParser parser(kTShapeRoadPath, config);
+
+  std::vector<std::string> phase_names;
+  for (const auto& phase : parser.stats().phases) {
+    phase_names.push_back(phase.name);
+  }
+  // Far fewer rows than ParseProgress::kReportInterval, so only phase starts are reported.
+  EXPECT_EQ(reported_phases, phase_names);
+  // The last phase starts once every table is read.
+  const ParserStats& stats = parser.stats();
+  EXPECT_EQ(last_rows, stats.junction_rows + stats.boundary_rows + stats.segment_rows + stats.lane_rows +
+                           stats.branch_point_lane_rows + stats.adjacent_lane_rows);
+}
+
+TEST_F(GeoPackageParserTest, Cancel) {
+  for (const char* cancel_at :
+       {"open_database", "parse_junctions", "parse_segments_and_lanes", "build_lane_adjacency"}) {
+    for (const int parser_threads : {1, 2}) {
+      const auto cancelled = std::make_shared<std::atomic<bool>>(false);
+      std::vector<std::string> reported_phases;
+      ParserConfiguration config{parser_threads};
+      config.cancelled = cancelled;
+      config.on_progress = [&](const ParseProgress& progress) {
+        reported_phases.push_back(progress.phase);
+        // The phase has already started, so the parser stops at its first row or at the next phase.
+        if (progress.phase == std::string(cancel_at)) cancelled->store(true);
+      };
+      EXPECT_THROW(GeoPackageParser(kTShapeRoadPath, config), ParseCancelled) << cancel_at;
+      ASSERT_FALSE(reported_phases.empty());
+      EXPECT_EQ(reported_phases.back(), cancel_at);
+    }
+  }
+
+  // Parsing does not start once cancelled.
+  ParserConfiguration config;
+  config.cancelled = std::make_shared<std::atomic<bool>>(true);
+  const std::string bytes = ReadFile(kTShapeRoadPath);
+  EXPECT_THROW(GeoPackageParser(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size(), config), ParseCancelled);
+}
+
+TEST_F(GeoPackageParserTest, EmptyLoadRegion) {
+  ParserConfiguration config;
+  config.load_region = Region2d{500., 500., 600., 600.};
+  const GeoPackageParser parser(kTShapeRoadPath, config);
+
+  EXPECT_TRUE(parser.GetJunctions().empty());
+  EXPECT_TRUE(parser.GetConnections().empty());
+}
+
+TEST_F(GeoPackageParserTest, MalformedGeometryThrows) {
+  const std::string path = ::testing::TempDir() + "malformed_geometry.gpkg";
+  std::remove(path.c_str());
+  sqlite3* db{nullptr};
+  ASSERT_EQ(sqlite3_open(path.c_str(), &db), SQLITE_OK);
+  ASSERT_EQ(sqlite3_exec(db,
+                         "CREATE TABLE junctions (junction_id TEXT PRIMARY KEY, name TEXT);"
+                         "CREATE TABLE segments (segment_id TEXT PRIMARY KEY, junction_id TEXT, name TEXT);"
+                         "CREATE TABLE lanes (lane_id TEXT PRIMARY KEY, segment_id TEXT, lane_type TEXT, "
+                         "  direction TEXT, left_boundary TEXT, right_boundary TEXT);"
+                         "INSERT INTO junctions VALUES ('j1', '');"
+                         "INSERT INTO segments VALUES ('s1', 'j1', '');"
+                         "INSERT INTO lanes VALUES ('l1', 's1', 'driving', 'forward', "
+                         "  'LINESTRINGZ(0 1 0, 10 1 0)', 'LINESTRINGZ(0 0 0, 10 0 0)');"
+                         "INSERT INTO lanes VALUES ('l2', 's1', 'driving', 'forward', "
+                         "  'LINESTRINGZ(0 2 0, 10 2 0)', 'LINESTRINGZ(0 1 0, ten 1 0)');",
+                         nullptr, nullptr, nullptr),
+            SQLITE_OK);
+  sqlite3_close(db);
+
+  EXPECT_THROW(GeoPackageParser(path, ParserConfiguration{1}), std::runtime_error);
+  EXPECT_THROW(GeoPackageParser(path, ParserConfiguration{4}), std::runtime_error);
+  std::remove(path.c_str());
+}
+
+TEST_F(GeoPackageParserTest, LoadFromMemoryMatchesFile) {
+  for (const auto& path : {kTwoLaneRoadPath, kTwoLaneRoadGpbPath, kTShapeRoadPath}) {
+    const std::string bytes = ReadFile(path);
+    ASSERT_FALSE(bytes.empty()) << path;
+    for (const int parser_threads : {1, 2}) {
+      const ParserConfiguration config{parser_threads};
+      const GeoPackageParser file_parser(path, config);
+      const GeoPackageParser memory_parser(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size(), config);
+      EXPECT_EQ(memory_parser.GetJunctions(), file_parser.GetJunctions()) << path;
+      EXPECT_EQ(memory_parser.GetConnections(), file_parser.GetConnections()) << path;
+    }
+  }
+
+  ParserConfiguration config;
+  config.load_region = Region2d{0., -3.5, 30., 3.5};
+  config.boundary_policy = BoundaryPolicy::kTruncate;
+  const GeoPackageParser file_parser(kTShapeRoadPath, config);
+  std::string bytes = ReadFile(kTShapeRoadPath);
+  const GeoPackageParser memory_parser(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size(), config);
+  // The bytes are no longer needed once constructed.
+  bytes.assign(bytes.size(), '\0');
+  EXPECT_EQ(memory_parser.GetJunctions(), file_parser.GetJunctions());
+  EXPECT_EQ(memory_parser.GetConnections(), file_parser.GetConnections());
+}
+
+TEST_F(GeoPackageParserTest, LoadFromFileDescriptor) {
+  const int fd = ::open(kTShapeRoadPath.c_str(), O_RDONLY | O_CLOEXEC);
+  ASSERT_GE(fd, 0);
+  const MappedFile mapping(fd);
+  ::close(fd);
+  const GeoPackageParser fd_parser(mapping.data(), mapping.size());
+  const GeoPackageParser file_parser(kTShapeRoadPath);
+  EXPECT_EQ(fd_parser.GetJunctions(), file_parser.GetJunctions());
+  EXPECT_EQ(fd_parser.GetConnections(), file_parser.GetConnections());
+}
+
+TEST_F(GeoPackageParserTest, InvalidMemoryThrows) {
+  const std::string garbage(4096, 'x');
+  EXPECT_THROW(GeoPackageParser(reinterpret_cast<const uint8_t*>(garbage.data()), garbage.size()), std::runtime_error);
+  EXPECT_THROW(GeoPackageParser(nullptr, 0), std::runtime_error);
+}
+
 TEST_F(GeoPackageParserTest, NonExistentFileThrows) {
   EXPECT_THROW(GeoPackageParser("/nonexistent/path/to/file.gpkg"), std::runtime_error);
 }
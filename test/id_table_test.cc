@@ -0,0 +1,56 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+#include "maliput_geopackage/geopackage/id_table.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace maliput_geopackage {
+namespace geopackage {
+namespace test {
+
+TEST(IdTableTest, InternAssignsConsecutiveIndices) {
+  IdTable table;
+  EXPECT_EQ(table.size(), 0u);
+  EXPECT_EQ(table.Intern("j1_s1_lane1"), 0u);
+  EXPECT_EQ(table.Intern("j1_s1_lane2"), 1u);
+  EXPECT_EQ(table.Intern("j1_s1_lane1"), 0u);
+  EXPECT_EQ(table.Intern(""), 2u);
+  EXPECT_EQ(table.size(), 3u);
+
+  EXPECT_EQ(table.str(0), "j1_s1_lane1");
+  EXPECT_EQ(table.str(1), "j1_s1_lane2");
+  EXPECT_EQ(table.str(2), "");
+}
+
+TEST(IdTableTest, Find) {
+  IdTable table;
+  table.Intern("a");
+  table.Intern("b");
+  EXPECT_EQ(table.Find("a"), 0u);
+  EXPECT_EQ(table.Find("b"), 1u);
+  EXPECT_EQ(table.Find("c"), IdTable::kNone);
+  EXPECT_EQ(table.Find("ab"), IdTable::kNone);
+  EXPECT_EQ(table.size(), 2u);
+}
+
+TEST(IdTableTest, ManyIds) {
+  constexpr uint32_t kNumIds{100000};
+  IdTable table;
+  for (uint32_t i = 0; i < kNumIds; ++i) {
+    ASSERT_EQ(table.Intern("lane_" + std::to_string(i)), i);
+  }
+  EXPECT_EQ(table.size(), kNumIds);
+  for (uint32_t i = 0; i < kNumIds; ++i) {
+    ASSERT_EQ(table.Find("lane_" + std::to_string(i)), i);
+    ASSERT_EQ(table.str(i), "lane_" + std::to_string(i));
+  }
+  EXPECT_EQ(table.Find("lane_" + std::to_string(kNumIds)), IdTable::kNone);
+}
+
+}  // namespace test
+}  // namespace geopackage
+}  // namespace maliput_geopackage
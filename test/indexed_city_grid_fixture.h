@@ -0,0 +1,72 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/road_network.h>
+#include <maliput/api/segment.h>
+
+#include "maliput_geopackage/builder/road_network_builder.h"
+#include "tools/city_grid.h"
+
+namespace maliput_geopackage {
+namespace builder {
+namespace test {
+
+/// Fixture sharing one indexed city grid, 3x3 blocks with two lanes per direction over 4 m hills, among the tests
+/// of a suite. The grid is generated and built once by SetUpTestSuite(), into a file named after the suite so that
+/// test binaries running in parallel do not overwrite each other's.
+class IndexedCityGridTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() {
+    path_ = (std::filesystem::temp_directory_path() /
+             ("indexed_city_grid_" + std::string(::testing::UnitTest::GetInstance()->current_test_suite()->name()) +
+              ".gpkg"))
+                .string();
+    tools::CityGridOptions options;
+    options.blocks_x = 3;
+    options.blocks_y = 3;
+    options.lanes_per_direction = 2;
+    options.elevation = 4.;
+    tools::GenerateCityGrid(options, path_);
+    indexed_ = RoadNetworkBuilder({{"gpkg_file", path_}, {"linear_tolerance", "0.01"}, {"angular_tolerance", "0.01"}})
+                   .BuildIndexed();
+    road_geometry_ = indexed_.road_network->road_geometry();
+    for (int i = 0; i < road_geometry_->num_junctions(); ++i) {
+      for (int j = 0; j < road_geometry_->junction(i)->num_segments(); ++j) {
+        const maliput::api::Segment* segment = road_geometry_->junction(i)->segment(j);
+        for (int k = 0; k < segment->num_lanes(); ++k) {
+          lanes_.push_back(segment->lane(k));
+        }
+      }
+    }
+  }
+
+  static void TearDownTestSuite() {
+    lanes_.clear();
+    road_geometry_ = nullptr;
+    // The index goes first, as it refers to the RoadGeometry.
+    indexed_.road_position_index.reset();
+    indexed_.road_network.reset();
+    std::filesystem::remove(path_);
+  }
+
+  inline static std::string path_;
+  inline static IndexedRoadNetwork indexed_;
+  inline static const maliput::api::RoadGeometry* road_geometry_{nullptr};
+  /// Every lane of `road_geometry_`, by junction, segment and lane.
+  inline static std::vector<const maliput::api::Lane*> lanes_;
+};
+
+}  // namespace test
+}  // namespace builder
+}  // namespace maliput_geopackage
@@ -0,0 +1,119 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+#include "maliput_geopackage/geopackage/lane_rtree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace maliput_geopackage {
+namespace geopackage {
+namespace test {
+namespace {
+
+using maliput::math::Vector3;
+
+// @returns `count` random extents of up to 50 m, spread over a 1 km square.
+std::vector<LaneExtent> RandomExtents(int count) {
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<double> position(0., 1000.);
+  std::uniform_real_distribution<double> size(0., 50.);
+  std::vector<LaneExtent> extents;
+  for (int i = 0; i < count; ++i) {
+    const double x = position(generator);
+    const double y = position(generator);
+    const double z = 0.01 * position(generator);
+    extents.push_back({x, x + size(generator), y, y + size(generator), z, z + 0.1 * size(generator)});
+  }
+  return extents;
+}
+
+TEST(LaneRTreeTest, DistanceToExtent) {
+  const LaneExtent extent{0., 10., 0., 5., 0., 1.};
+  EXPECT_EQ(Distance(extent, Vector3(3., 2., 0.5)), 0.);
+  EXPECT_DOUBLE_EQ(Distance(extent, Vector3(13., 9., 0.5)), 5.);
+  EXPECT_DOUBLE_EQ(Distance(extent, Vector3(5., -2., 3.)), std::sqrt(8.));
+}
+
+TEST(LaneRTreeTest, VisitsItemsByIncreasingDistance) {
+  for (const int count : {0, 1, 15, 16, 17, 300, 5000}) {
+    const std::vector<LaneExtent> extents = RandomExtents(count);
+    const LaneRTree tree(extents);
+    ASSERT_EQ(tree.size(), extents.size());
+    for (const Vector3& point : {Vector3(500., 500., 0.), Vector3(-100., 20., 3.), Vector3(990., 1040., 10.)}) {
+      std::vector<uint32_t> visited;
+      double previous_distance{0.};
+      tree.VisitByDistance(point, [&](uint32_t item, double distance) {
+        EXPECT_DOUBLE_EQ(distance, Distance(extents[item], point));
+        EXPECT_GE(distance, previous_distance);
+        previous_distance = distance;
+        visited.push_back(item);
+        return true;
+      });
+      std::sort(visited.begin(), visited.end());
+      ASSERT_EQ(visited.size(), extents.size()) << count;
+      for (size_t i = 0; i < visited.size(); ++i) {
+        EXPECT_EQ(visited[i], i);
+      }
+    }
+  }
+}
+
+TEST(LaneRTreeTest, StopsWhenAsked) {
+  const std::vector<LaneExtent> extents = RandomExtents(1000);
+  const LaneRTree tree(extents);
+  const Vector3 point(250., 750., 0.);
+  std::vector<double> distances;
+  for (const auto& extent : extents) distances.push_back(Distance(extent, point));
+  std::sort(distances.begin(), distances.end());
+
+  // Visiting the items within 100 m yields exactly those.
+  int visited{0};
+  tree.VisitByDistance(point, [&](uint32_t, double distance) {
+    if (distance > 100.) return false;
+    ++visited;
+    return true;
+  });
+  EXPECT_EQ(visited, std::upper_bound(distances.begin(), distances.end(), 100.) - distances.begin());
+}
+
+// A queue reused across searches is cleared by each of them and stops growing once it fits them.
+TEST(LaneRTreeTest, ReusesQueue) {
+  const std::vector<LaneExtent> extents = RandomExtents(1000);
+  const LaneRTree tree(extents);
+  std::vector<LaneRTree::QueueEntry> queue{{1., 42, true}};
+  const auto nearest_items = [&](const Vector3& point) {
+    std::vector<uint32_t> items;
+    tree.VisitByDistance(
+        point,
+        [&](uint32_t item, double) {
+          items.push_back(item);
+          return items.size() < 10;
+        },
+        &queue);
+    return items;
+  };
+  size_t capacity{0};
+  for (int pass = 0; pass < 2; ++pass) {
+    for (const Vector3& point : {Vector3(500., 500., 0.), Vector3(20., 980., 5.), Vector3(-50., 300., 0.)}) {
+      std::vector<uint32_t> expected;
+      tree.VisitByDistance(point, [&](uint32_t item, double) {
+        expected.push_back(item);
+        return expected.size() < 10;
+      });
+      EXPECT_EQ(nearest_items(point), expected);
+    }
+    if (pass == 0) capacity = queue.capacity();
+  }
+  EXPECT_EQ(queue.capacity(), capacity);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace geopackage
+}  // namespace maliput_geopackage
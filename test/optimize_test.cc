@@ -0,0 +1,267 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+#include "tools/gpkg_optimizer.h"
+
+#include <cmath>
+#include <filesystem>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include <gtest/gtest.h>
+#include <sqlite3.h>
+
+#include "maliput_geopackage/geopackage/geopackage_parser.h"
+#include "maliput_geopackage/geopackage/spatial_index.h"
+#include "maliput_geopackage/geopackage/sqlite_helpers.h"
+#include "tools/city_grid.h"
+
+namespace maliput_geopackage {
+namespace tools {
+namespace test {
+
+using geopackage::GeoPackageParser;
+
+class OptimizeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const std::string prefix =
+        (std::filesystem::temp_directory_path() /
+         ("optimize_test_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name())))
+            .string();
+    input_path_ = prefix + "_input.gpkg";
+    output_path_ = prefix + "_output.gpkg";
+  }
+
+  void TearDown() override {
+    std::filesystem::remove(input_path_);
+    std::filesystem::remove(output_path_);
+  }
+
+  // Generates a WKT city grid at input_path_.
+  void GenerateInput() {
+    CityGridOptions options;
+    options.blocks_x = 2;
+    options.blocks_y = 2;
+    options.lanes_per_direction = 2;
+    options.elevation = 5.;
+    GenerateCityGrid(options, input_path_);
+  }
+
+  static void ExpectSameRoadNetwork(const std::string& expected_path, const std::string& actual_path) {
+    const GeoPackageParser expected(expected_path);
+    const GeoPackageParser actual(actual_path);
+    EXPECT_EQ(actual.GetJunctions(), expected.GetJunctions());
+    // The connection order follows the branch point query plan, which the new indexes may change.
+    EXPECT_EQ(Connections(actual), Connections(expected));
+  }
+
+  // @returns Every connection of `parser` as a comparable tuple.
+  static std::set<std::tuple<std::string, int, std::string, int>> Connections(const GeoPackageParser& parser) {
+    std::set<std::tuple<std::string, int, std::string, int>> connections;
+    for (const auto& connection : parser.GetConnections()) {
+      connections.emplace(connection.from.lane_id, static_cast<int>(connection.from.end), connection.to.lane_id,
+                          static_cast<int>(connection.to.end));
+    }
+    return connections;
+  }
+
+  // @returns The maliput_metadata table of the GeoPackage at `path`.
+  static std::map<std::string, std::string> ReadMetadata(const std::string& path) {
+    std::map<std::string, std::string> metadata;
+    ForEachRow(path, "SELECT key, value FROM maliput_metadata", [&metadata](sqlite3_stmt* stmt) {
+      metadata.emplace(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0)),
+                       reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1)));
+    });
+    return metadata;
+  }
+
+  template <typename Callback>
+  static void ForEachRow(const std::string& path, const std::string& sql, Callback callback) {
+    sqlite3* db = nullptr;
+    ASSERT_EQ(sqlite3_open_v2(path.c_str(), &db, SQLITE_OPEN_READONLY, nullptr), SQLITE_OK);
+    sqlite3_stmt* stmt = nullptr;
+    ASSERT_EQ(sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr), SQLITE_OK) << sqlite3_errmsg(db);
+    while (sqlite3_step(stmt) == SQLITE_ROW) callback(stmt);
+    sqlite3_finalize(stmt);
+    sqlite3_close(db);
+  }
+
+  std::string input_path_;
+  std::string output_path_;
+};
+
+TEST_F(OptimizeTest, PreservesRoadNetwork) {
+  GenerateInput();
+  const OptimizeReport report = OptimizeGeoPackage(input_path_, output_path_);
+
+  EXPECT_EQ(report.junctions, 21);
+  EXPECT_EQ(report.lanes, 12 * 4 + 6 * 4 + 32);
+  EXPECT_EQ(report.geometries_converted, 2 * report.lanes);
+  EXPECT_GT(report.input_load_seconds, 0.);
+  EXPECT_GT(report.output_load_seconds, 0.);
+  ExpectSameRoadNetwork(input_path_, output_path_);
+
+  // Every boundary is binary now.
+  ForEachRow(output_path_, "SELECT COUNT(*) FROM lanes WHERE typeof(left_boundary) = 'text' OR "
+                           "typeof(right_boundary) = 'text'",
+             [](sqlite3_stmt* stmt) { EXPECT_EQ(sqlite3_column_int64(stmt, 0), 0); });
+  ForEachRow(output_path_, "PRAGMA page_size", [](sqlite3_stmt* stmt) { EXPECT_EQ(sqlite3_column_int(stmt, 0), 65536); });
+}
+
+TEST_F(OptimizeTest, PreservesSharedBoundaries) {
+  CityGridOptions options;
+  options.blocks_x = 2;
+  options.blocks_y = 1;
+  options.shared_boundaries = true;
+  const CityGridStats stats = GenerateCityGrid(options, input_path_);
+  const OptimizeReport report = OptimizeGeoPackage(input_path_, output_path_);
+
+  // Road-wide lanes reference shared boundaries, only the turn lanes keep theirs inline. With one lane per
+  // direction every road-wide lane has exactly one adjacency row.
+  EXPECT_EQ(report.geometries_converted, stats.boundaries + 2 * (stats.lanes - stats.adjacent_lanes));
+  ExpectSameRoadNetwork(input_path_, output_path_);
+  ForEachRow(output_path_, "SELECT COUNT(*) FROM boundaries WHERE typeof(geometry) = 'text'",
+             [](sqlite3_stmt* stmt) { EXPECT_EQ(sqlite3_column_int64(stmt, 0), 0); });
+  ForEachRow(output_path_, "SELECT COUNT(*) FROM lanes WHERE bbox_min_x IS NULL",
+             [](sqlite3_stmt* stmt) { EXPECT_EQ(sqlite3_column_int64(stmt, 0), 0); });
+}
+
+TEST_F(OptimizeTest, CompactsGeometry) {
+  GenerateInput();
+  OptimizeOptions options;
+  options.compact_scale = 1e-3;
+  options.measure_load_time = false;
+  const OptimizeReport report = OptimizeGeoPackage(input_path_, output_path_, options);
+  EXPECT_EQ(report.geometries_converted, 2 * report.lanes);
+  // The city grid is written with millimeter coordinates, which quantize to themselves.
+  EXPECT_LT(report.max_quantization_error, 1e-9);
+  ForEachRow(output_path_, "SELECT COUNT(*) FROM lanes WHERE substr(left_boundary, 1, 2) != X'4D51' OR "
+                           "substr(right_boundary, 1, 2) != X'4D51'",
+             [](sqlite3_stmt* stmt) { EXPECT_EQ(sqlite3_column_int64(stmt, 0), 0); });
+
+  const GeoPackageParser expected(input_path_);
+  const GeoPackageParser actual(output_path_);
+  ASSERT_EQ(actual.GetJunctions().size(), expected.GetJunctions().size());
+  for (const auto& [junction_id, junction] : expected.GetJunctions()) {
+    for (const auto& [segment_id, segment] : junction.segments) {
+      const auto& lanes = actual.GetJunctions().at(junction_id).segments.at(segment_id).lanes;
+      ASSERT_EQ(lanes.size(), segment.lanes.size());
+      for (size_t i = 0; i < lanes.size(); ++i) {
+        EXPECT_EQ(lanes[i].id, segment.lanes[i].id);
+        ASSERT_EQ(lanes[i].left.size(), segment.lanes[i].left.size());
+        for (size_t p = 0; p < lanes[i].left.size(); ++p) {
+          EXPECT_LT((lanes[i].left.at(p) - segment.lanes[i].left.at(p)).norm(), 1e-3);
+        }
+      }
+    }
+  }
+  EXPECT_EQ(Connections(actual), Connections(expected));
+
+  // Compact boundaries are left as they are.
+  const OptimizeReport compact_report = OptimizeGeoPackage(output_path_, output_path_, options);
+  EXPECT_EQ(compact_report.geometries_converted, 0);
+  EXPECT_EQ(compact_report.max_quantization_error, 0.);
+  // Binary ones are converted too.
+  options.compact_scale = 1e-2;
+  OptimizeGeoPackage(input_path_, input_path_, OptimizeOptions{});
+  const OptimizeReport coarse_report = OptimizeGeoPackage(input_path_, output_path_, options);
+  EXPECT_EQ(coarse_report.geometries_converted, 2 * report.lanes);
+  EXPECT_GT(coarse_report.max_quantization_error, 1e-3);
+  EXPECT_LE(coarse_report.max_quantization_error, std::sqrt(3.) / 2. * options.compact_scale);
+}
+
+TEST_F(OptimizeTest, PreservesFixture) {
+  const std::string fixture = std::string(TEST_RESOURCES_DIR) + "t_shape_road.gpkg";
+  const OptimizeReport report = OptimizeGeoPackage(fixture, output_path_);
+  // Both boundaries and the centerline of every lane.
+  EXPECT_EQ(report.geometries_converted, 3 * report.lanes);
+  ExpectSameRoadNetwork(fixture, output_path_);
+
+  geopackage::ParserConfiguration config;
+  config.read_centerlines = true;
+  const GeoPackageParser expected(fixture, config);
+  const GeoPackageParser actual(output_path_, config);
+  EXPECT_EQ(actual.centerlines().size(), static_cast<size_t>(report.lanes));
+  for (const auto& [lane_id, centerline] : expected.centerlines()) {
+    EXPECT_EQ(actual.centerlines().at(lane_id).points, centerline.points) << lane_id;
+    EXPECT_EQ(actual.centerlines().at(lane_id).arc_lengths, centerline.arc_lengths) << lane_id;
+  }
+}
+
+TEST_F(OptimizeTest, AddsIndexesExtentsAndLaneOrder) {
+  GenerateInput();
+  OptimizeOptions options;
+  options.page_size = 8192;
+  options.measure_load_time = false;
+  const OptimizeReport report = OptimizeGeoPackage(input_path_, output_path_, options);
+  EXPECT_EQ(report.input_load_seconds, 0.);
+
+  sqlite3* db = nullptr;
+  ASSERT_EQ(sqlite3_open_v2(output_path_.c_str(), &db, SQLITE_OPEN_READONLY, nullptr), SQLITE_OK);
+  EXPECT_TRUE(geopackage::HasLaneSpatialIndex(db));
+  EXPECT_EQ(geopackage::CountRows(db, geopackage::kLaneSpatialIndexTable), report.lanes);
+  EXPECT_TRUE(geopackage::HasTable(db, "sqlite_stat1"));
+  for (const char* index : {"idx_segments_junction", "idx_lanes_segment", "idx_lanes_segment_index",
+                            "idx_branch_point_lanes_bp", "idx_adjacent_lanes_lane"}) {
+    EXPECT_TRUE(geopackage::HasTable(db, index)) << index;
+  }
+  EXPECT_TRUE(geopackage::HasColumns(db, "lanes", {"bbox_min_x", "bbox_max_x", "bbox_min_y", "bbox_max_y", "lane_index"}));
+  sqlite3_close(db);
+
+  ForEachRow(output_path_, "PRAGMA page_size", [](sqlite3_stmt* stmt) { EXPECT_EQ(sqlite3_column_int(stmt, 0), 8192); });
+
+  // The first horizontal road spans x in [0, 100] around y = 0, its lanes numbered from the right.
+  std::map<std::string, int> lane_indices;
+  ForEachRow(output_path_, "SELECT lane_id, lane_index, bbox_min_x, bbox_max_x FROM lanes WHERE segment_id = 'h_0_0_s'",
+             [&lane_indices](sqlite3_stmt* stmt) {
+               lane_indices.emplace(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0)),
+                                    sqlite3_column_int(stmt, 1));
+               EXPECT_LT(sqlite3_column_double(stmt, 3) - sqlite3_column_double(stmt, 2), 100.);
+             });
+  const std::map<std::string, int> expected_indices{
+      {"h_0_0_s_l0", 0}, {"h_0_0_s_l1", 1}, {"h_0_0_s_l2", 2}, {"h_0_0_s_l3", 3}};
+  EXPECT_EQ(lane_indices, expected_indices);
+
+  const auto metadata = ReadMetadata(output_path_);
+  EXPECT_EQ(metadata.at("num_junctions"), std::to_string(report.junctions));
+  EXPECT_EQ(metadata.at("num_segments"), std::to_string(report.segments));
+  EXPECT_EQ(metadata.at("num_lanes"), std::to_string(report.lanes));
+  EXPECT_EQ(metadata.at("num_branch_point_lanes"), std::to_string(report.branch_point_lanes));
+  EXPECT_EQ(metadata.at("num_adjacent_lanes"), std::to_string(report.adjacent_lanes));
+}
+
+TEST_F(OptimizeTest, IsIdempotentInPlace) {
+  GenerateInput();
+  OptimizeOptions options;
+  options.measure_load_time = false;
+  OptimizeGeoPackage(input_path_, output_path_, options);
+  const auto metadata = ReadMetadata(output_path_);
+  std::filesystem::copy_file(output_path_, input_path_, std::filesystem::copy_options::overwrite_existing);
+
+  const OptimizeReport report = OptimizeGeoPackage(output_path_, output_path_, options);
+  EXPECT_EQ(report.geometries_converted, 0);
+  EXPECT_EQ(ReadMetadata(output_path_), metadata);
+  ExpectSameRoadNetwork(input_path_, output_path_);
+  EXPECT_FALSE(std::filesystem::exists(output_path_ + ".tmp"));
+}
+
+TEST_F(OptimizeTest, RejectsInvalidInput) {
+  EXPECT_THROW(OptimizeGeoPackage(input_path_, output_path_), std::runtime_error);
+  GenerateInput();
+  OptimizeOptions options;
+  options.page_size = 1000;
+  EXPECT_THROW(OptimizeGeoPackage(input_path_, output_path_, options), std::runtime_error);
+  options = OptimizeOptions{};
+  options.compact_scale = -1.;
+  EXPECT_THROW(OptimizeGeoPackage(input_path_, output_path_, options), std::runtime_error);
+  EXPECT_FALSE(std::filesystem::exists(output_path_));
+}
+
+}  // namespace test
+}  // namespace tools
+}  // namespace maliput_geopackage
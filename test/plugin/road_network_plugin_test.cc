@@ -27,9 +27,15 @@
 // CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdio>
 #include <cstdlib>
+#include <fstream>
 #include <map>
 #include <memory>
+#include <sstream>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -118,6 +124,90 @@ TEST_F(RoadNetworkPluginTest, VerifyRoadNetworkCreation) {
   EXPECT_EQ(1, rn->road_geometry()->num_junctions());
 }
 
+TEST_F(RoadNetworkPluginTest, WritesLoadStatsFile) {
+  const maliput::plugin::MaliputPlugin::Id kPluginId{"maliput_geopackage"};
+  const std::string load_stats_file{::testing::TempDir() + "maliput_geopackage_load_stats.json"};
+  std::remove(load_stats_file.c_str());
+
+  const std::map<std::string, std::string> rg_properties{
+      {"gpkg_file", kGpkgFile},
+      {"load_stats_file", load_stats_file},
+  };
+
+  maliput::plugin::MaliputPluginManager manager{};
+  const maliput::plugin::MaliputPlugin* rn_plugin{manager.GetPlugin(kPluginId)};
+  ASSERT_NE(nullptr, rn_plugin);
+  std::unique_ptr<maliput::plugin::RoadNetworkLoader> rn_loader{reinterpret_cast<maliput::plugin::RoadNetworkLoader*>(
+      rn_plugin->ExecuteSymbol<maliput::plugin::RoadNetworkLoaderPtr>(
+          maliput::plugin::RoadNetworkLoader::GetEntryPoint()))};
+  ASSERT_NE(nullptr, rn_loader);
+
+  ASSERT_NE(nullptr, (*rn_loader)(rg_properties));
+
+  std::stringstream json;
+  json << std::ifstream(load_stats_file).rdbuf();
+  EXPECT_NE(std::string::npos, json.str().find("\"parse_segments_and_lanes\""));
+  EXPECT_NE(std::string::npos, json.str().find("\"road_network_loader\""));
+  EXPECT_NE(std::string::npos, json.str().find("\"process_peak_rss_bytes\""));
+  std::remove(load_stats_file.c_str());
+}
+
+TEST_F(RoadNetworkPluginTest, LoadsFromFileDescriptor) {
+  const maliput::plugin::MaliputPlugin::Id kPluginId{"maliput_geopackage"};
+  const int fd = ::open(kGpkgFile.c_str(), O_RDONLY | O_CLOEXEC);
+  ASSERT_GE(fd, 0);
+
+  // gpkg_fd takes precedence over gpkg_file.
+  const std::map<std::string, std::string> rg_properties{
+      {"gpkg_file", "/nonexistent/path/to/file.gpkg"},
+      {"gpkg_fd", std::to_string(fd)},
+  };
+
+  maliput::plugin::MaliputPluginManager manager{};
+  const maliput::plugin::MaliputPlugin* rn_plugin{manager.GetPlugin(kPluginId)};
+  ASSERT_NE(nullptr, rn_plugin);
+  std::unique_ptr<maliput::plugin::RoadNetworkLoader> rn_loader{reinterpret_cast<maliput::plugin::RoadNetworkLoader*>(
+      rn_plugin->ExecuteSymbol<maliput::plugin::RoadNetworkLoaderPtr>(
+          maliput::plugin::RoadNetworkLoader::GetEntryPoint()))};
+  ASSERT_NE(nullptr, rn_loader);
+
+  std::unique_ptr<const maliput::api::RoadNetwork> rn = (*rn_loader)(rg_properties);
+  ::close(fd);
+  ASSERT_NE(nullptr, rn);
+  EXPECT_EQ(1, rn->road_geometry()->num_junctions());
+}
+
+TEST_F(RoadNetworkPluginTest, SharesParsedMapAcrossLoads) {
+  const maliput::plugin::MaliputPlugin::Id kPluginId{"maliput_geopackage"};
+  const std::string load_stats_file{::testing::TempDir() + "maliput_geopackage_shared_cache_stats.json"};
+  const std::map<std::string, std::string> rg_properties{
+      {"gpkg_file", kGpkgFile},
+      {"shared_cache", "true"},
+      {"load_stats_file", load_stats_file},
+  };
+
+  maliput::plugin::MaliputPluginManager manager{};
+  const maliput::plugin::MaliputPlugin* rn_plugin{manager.GetPlugin(kPluginId)};
+  ASSERT_NE(nullptr, rn_plugin);
+  std::unique_ptr<maliput::plugin::RoadNetworkLoader> rn_loader{reinterpret_cast<maliput::plugin::RoadNetworkLoader*>(
+      rn_plugin->ExecuteSymbol<maliput::plugin::RoadNetworkLoaderPtr>(
+          maliput::plugin::RoadNetworkLoader::GetEntryPoint()))};
+  ASSERT_NE(nullptr, rn_loader);
+
+  // Every load returns its own RoadNetwork, the later ones built from the map parsed by the first.
+  std::unique_ptr<const maliput::api::RoadNetwork> first = (*rn_loader)(rg_properties);
+  std::unique_ptr<const maliput::api::RoadNetwork> second = (*rn_loader)(rg_properties);
+  ASSERT_NE(nullptr, first);
+  ASSERT_NE(nullptr, second);
+  EXPECT_NE(first.get(), second.get());
+  EXPECT_EQ(first->road_geometry()->num_junctions(), second->road_geometry()->num_junctions());
+
+  std::stringstream json;
+  json << std::ifstream(load_stats_file).rdbuf();
+  EXPECT_NE(std::string::npos, json.str().find("\"loaded_from_shared_cache\": true"));
+  std::remove(load_stats_file.c_str());
+}
+
 TEST_F(RoadNetworkPluginTest, GetDefaultParameters) {
   // RoadNetworkLoader plugin id.
   const maliput::plugin::MaliputPlugin::Id kPluginId{"maliput_geopackage"};
@@ -0,0 +1,107 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+#include "maliput_geopackage/geopackage/polyline_simplifier.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace maliput_geopackage {
+namespace geopackage {
+namespace test {
+namespace {
+
+using maliput::math::Vector3;
+
+// @returns The distance from `p` to the polyline through `points`.
+double DistanceToPolyline(const Vector3& p, const std::vector<Vector3>& points) {
+  double distance = std::numeric_limits<double>::infinity();
+  for (size_t i = 1; i < points.size(); ++i) {
+    const Vector3 ab = points[i] - points[i - 1];
+    const double length_squared = ab.dot(ab);
+    const double t = length_squared > 0. ? std::clamp((p - points[i - 1]).dot(ab) / length_squared, 0., 1.) : 0.;
+    distance = std::min(distance, (p - (points[i - 1] + t * ab)).norm());
+  }
+  return distance;
+}
+
+// A boundary sampled every 10 cm along a 100 m arc of radius 200 m, climbing 1 m, with 1 mm of noise.
+std::vector<Vector3> SurveyedArc() {
+  std::vector<Vector3> points;
+  for (int i = 0; i <= 1000; ++i) {
+    const double angle = 0.5 * static_cast<double>(i) / 1000.;
+    const double noise = 1e-3 * std::sin(12.9898 * i);
+    points.emplace_back((200. + noise) * std::sin(angle), 200. - (200. + noise) * std::cos(angle), 1e-3 * i);
+  }
+  return points;
+}
+
+TEST(PolylineSimplifierTest, DropsCollinearPoints) {
+  const std::vector<Vector3> points{{0., 0., 0.}, {1., 0., 0.}, {2., 0., 0.}, {2., 0., 0.}, {3., 1., 0.}};
+  std::vector<Vector3> simplified;
+  SimplifyPolyline(points, 0., &simplified);
+  EXPECT_EQ(simplified, (std::vector<Vector3>{{0., 0., 0.}, {2., 0., 0.}, {3., 1., 0.}}));
+
+  // Too short to simplify.
+  SimplifyPolyline({{0., 0., 0.}, {1., 0., 0.}}, 1., &simplified);
+  EXPECT_EQ(simplified.size(), 2u);
+}
+
+TEST(PolylineSimplifierTest, StaysWithinTolerance) {
+  const std::vector<Vector3> points = SurveyedArc();
+  std::vector<Vector3> simplified;
+  for (const double tolerance : {5e-2, 1e-2, 5e-3}) {
+    SimplifyPolyline(points, tolerance, &simplified);
+    EXPECT_LT(simplified.size(), points.size() / 10) << tolerance;
+    EXPECT_EQ(simplified.front(), points.front());
+    EXPECT_EQ(simplified.back(), points.back());
+    for (const auto& point : points) {
+      ASSERT_LE(DistanceToPolyline(point, simplified), tolerance) << tolerance;
+    }
+  }
+}
+
+TEST(PolylineSimplifierTest, MatchVerticesPairsByArcLength) {
+  std::vector<Vector3> left{{0., 1., 0.}, {1., 1., 0.}, {4., 1., 0.}};
+  std::vector<Vector3> right{{0., 0., 0.}, {2., 0., 0.}, {3., 0., 0.}, {4., 0., 0.}};
+  const std::vector<Vector3> original_left = left;
+  const std::vector<Vector3> original_right = right;
+  MatchVertices(&left, &right);
+
+  // Left gains vertices at x = 2 and 3, right at x = 1.
+  ASSERT_EQ(left.size(), 5u);
+  ASSERT_EQ(right.size(), 5u);
+  for (size_t i = 0; i < left.size(); ++i) {
+    EXPECT_NEAR(left[i].x(), right[i].x(), 1e-12);
+    EXPECT_LT(DistanceToPolyline(left[i], original_left), 1e-12);
+    EXPECT_LT(DistanceToPolyline(right[i], original_right), 1e-12);
+  }
+  for (const auto& vertex : original_left) {
+    EXPECT_NE(std::find(left.begin(), left.end(), vertex), left.end());
+  }
+  for (const auto& vertex : original_right) {
+    EXPECT_NE(std::find(right.begin(), right.end(), vertex), right.end());
+  }
+}
+
+TEST(PolylineSimplifierTest, MatchVerticesHandlesDegeneratePolylines) {
+  std::vector<Vector3> left{{0., 0., 0.}, {0., 0., 0.}, {0., 0., 0.}};
+  std::vector<Vector3> right{{0., -1., 0.}, {5., -1., 0.}};
+  MatchVertices(&left, &right);
+  ASSERT_EQ(left.size(), right.size());
+  EXPECT_EQ(right.front(), Vector3(0., -1., 0.));
+  EXPECT_EQ(right.back(), Vector3(5., -1., 0.));
+  for (const auto& vertex : left) {
+    EXPECT_EQ(vertex, Vector3(0., 0., 0.));
+  }
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace geopackage
+}  // namespace maliput_geopackage
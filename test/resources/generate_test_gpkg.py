@@ -5,15 +5,34 @@ Generate a test GeoPackage file for maliput_geopackage.
 This script creates a simple 2-lane straight road (100m) following the
 maliput_geopackage schema.
 
+With --gpb, lane boundaries are stored as GeoPackage binary geometries
+(GPB header + little-endian WKB) instead of WKT text.
+
 Usage:
-    python3 generate_test_gpkg.py [output_path]
+    python3 generate_test_gpkg.py [--gpb] [output_path]
 """
 
 import sqlite3
+import struct
 import sys
 import os
 
 
+def wkt_to_gpb(wkt):
+    """Encode a WKT LINESTRINGZ as a GeoPackage binary blob with an XY envelope."""
+    content = wkt[wkt.index('(') + 1:wkt.rindex(')')]
+    points = [tuple(float(v) for v in p.split()) for p in content.split(',')]
+    xs = [p[0] for p in points]
+    ys = [p[1] for p in points]
+    # Magic, version 0, flags: little-endian header with a [minx, maxx, miny, maxy] envelope.
+    header = b'GP' + struct.pack('<BBi', 0, 0x03, 0)
+    envelope = struct.pack('<4d', min(xs), max(xs), min(ys), max(ys))
+    # Little-endian ISO WKB LineString Z (type 1002).
+    wkb = struct.pack('<BII', 1, 1002, len(points))
+    wkb += b''.join(struct.pack('<3d', *p) for p in points)
+    return header + envelope + wkb
+
+
 def create_schema(conn):
     """Create the maliput_geopackage schema tables."""
     cursor = conn.cursor()
@@ -99,7 +118,7 @@ def create_schema(conn):
     conn.commit()
 
 
-def populate_two_lane_road(conn):
+def populate_two_lane_road(conn, encode_geometry=lambda wkt: wkt):
     """
     Populate the database with a simple 2-lane straight road (100m).
 
@@ -144,7 +163,7 @@ def populate_two_lane_road(conn):
                            left_boundary, right_boundary, centerline)
         VALUES ('j1_s1_lane1', 'j1_s1', 'driving', 'forward', 13.89,
                 'solid_yellow', 'dashed_yellow', ?, ?, ?)
-    ''', (lane1_left, lane1_right, lane1_center))
+    ''', (encode_geometry(lane1_left), encode_geometry(lane1_right), lane1_center))
 
     # Lane 2 (Backward direction, y: -3.5 to 0)
     lane2_left = 'LINESTRINGZ(0 0 0, 25 0 0, 50 0 0, 75 0 0, 100 0 0)'
@@ -157,7 +176,7 @@ def populate_two_lane_road(conn):
                            left_boundary, right_boundary, centerline)
         VALUES ('j1_s1_lane2', 'j1_s1', 'driving', 'backward', 13.89,
                 'dashed_yellow', 'solid_yellow', ?, ?, ?)
-    ''', (lane2_left, lane2_right, lane2_center))
+    ''', (encode_geometry(lane2_left), encode_geometry(lane2_right), lane2_center))
 
     # Insert branch points
     cursor.execute("INSERT INTO branch_points (branch_point_id, location) VALUES ('bp_start', 'POINTZ(0 0 0)')")
@@ -191,7 +210,10 @@ def populate_two_lane_road(conn):
 
 
 def main():
-    output_path = sys.argv[1] if len(sys.argv) > 1 else 'two_lane_road.gpkg'
+    args = sys.argv[1:]
+    use_gpb = '--gpb' in args
+    args = [a for a in args if a != '--gpb']
+    output_path = args[0] if args else 'two_lane_road.gpkg'
 
     # Remove existing file
     if os.path.exists(output_path):
@@ -202,7 +224,7 @@ def main():
     conn = sqlite3.connect(output_path)
     try:
         create_schema(conn)
-        populate_two_lane_road(conn)
+        populate_two_lane_road(conn, wkt_to_gpb if use_gpb else (lambda wkt: wkt))
         print("Successfully created test GeoPackage with 2-lane road (100m)")
 
         # Print summary
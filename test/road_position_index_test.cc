@@ -0,0 +1,129 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+#include "maliput_geopackage/builder/road_position_index.h"
+
+#include <cmath>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/road_network.h>
+
+#include "indexed_city_grid_fixture.h"
+#include "maliput_geopackage/builder/road_network_builder.h"
+#include "tools/city_grid.h"
+
+namespace maliput_geopackage {
+namespace builder {
+namespace test {
+namespace {
+
+using maliput::api::InertialPosition;
+using maliput::api::RoadPositionResult;
+
+void ExpectSameResult(const RoadPositionResult& actual, const RoadPositionResult& expected) {
+  ASSERT_EQ(actual.road_position.lane, expected.road_position.lane);
+  EXPECT_EQ(actual.road_position.pos.srh(), expected.road_position.pos.srh());
+  EXPECT_EQ(actual.nearest_position.xyz(), expected.nearest_position.xyz());
+  EXPECT_EQ(actual.distance, expected.distance);
+}
+
+// Compares `index` with its RoadGeometry at random positions over the square [min, max]^2, some of them above
+// the roads and some exactly between two lanes.
+void ExpectSameQueries(const RoadPositionIndex& index, double min, double max) {
+  const maliput::api::RoadGeometry* road_geometry = index.road_geometry();
+  std::mt19937 generator(3);
+  std::uniform_real_distribution<double> coordinate(min, max);
+  std::uniform_real_distribution<double> height(-1., 8.);
+  std::uniform_real_distribution<double> radius(0., 10.);
+  for (int i = 0; i < 2000; ++i) {
+    const double y = i % 4 == 0 ? std::round(coordinate(generator) / 3.5) * 3.5 : coordinate(generator);
+    const InertialPosition position(coordinate(generator), y, height(generator));
+    ExpectSameResult(index.ToRoadPosition(position), road_geometry->ToRoadPosition(position));
+
+    const double query_radius = radius(generator);
+    const std::vector<RoadPositionResult> actual = index.FindRoadPositions(position, query_radius);
+    const std::vector<RoadPositionResult> expected = road_geometry->FindRoadPositions(position, query_radius);
+    ASSERT_EQ(actual.size(), expected.size()) << i;
+    for (size_t j = 0; j < actual.size(); ++j) {
+      ExpectSameResult(actual[j], expected[j]);
+    }
+  }
+}
+
+TEST(RoadPositionIndexTest, MatchesRoadGeometryOnTShape) {
+  LoadStats load_stats;
+  const IndexedRoadNetwork indexed = RoadNetworkBuilder({{"gpkg_file", TEST_RESOURCES_DIR "t_shape_road.gpkg"},
+                                                         {"linear_tolerance", "0.01"},
+                                                         {"angular_tolerance", "0.01"}})
+                                         .BuildIndexed(&load_stats);
+  ASSERT_NE(indexed.road_network, nullptr);
+  ASSERT_NE(indexed.road_position_index, nullptr);
+  EXPECT_EQ(indexed.road_position_index->road_geometry(), indexed.road_network->road_geometry());
+  EXPECT_EQ(indexed.road_position_index->num_lanes(), 12);
+  EXPECT_EQ(load_stats.phases.back().name, "build_road_position_index");
+  ExpectSameQueries(*indexed.road_position_index, -10., 110.);
+}
+
+// Lane boxes are built from backend frame boundaries and queried with inertial positions, so the translation between
+// both frames must be accounted for.
+TEST(RoadPositionIndexTest, MatchesRoadGeometryWithBackendFrameTranslation) {
+  const IndexedRoadNetwork indexed =
+      RoadNetworkBuilder({{"gpkg_file", TEST_RESOURCES_DIR "t_shape_road.gpkg"},
+                          {"linear_tolerance", "0.01"},
+                          {"angular_tolerance", "0.01"},
+                          {"inertial_to_backend_frame_translation", "{40.0, -25.0, 1.0}"}})
+          .BuildIndexed();
+  // The T shape spans [-10, 110] m in the backend frame.
+  ExpectSameQueries(*indexed.road_position_index, -50., 135.);
+}
+
+// With a linear tolerance larger than the lane width, positions beside a road tie with each of its eight lanes in
+// turn, a chain spreading over 24.5 m that the index must follow to break ties as the RoadGeometry does.
+TEST(RoadPositionIndexTest, MatchesRoadGeometryWhenTiesChain) {
+  const std::string path =
+      (std::filesystem::temp_directory_path() /
+       ("road_position_index_test_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) +
+        ".gpkg"))
+          .string();
+  tools::CityGridOptions options;
+  options.blocks_x = 2;
+  options.blocks_y = 2;
+  options.lanes_per_direction = 4;
+  tools::GenerateCityGrid(options, path);
+  const IndexedRoadNetwork indexed =
+      RoadNetworkBuilder({{"gpkg_file", path}, {"linear_tolerance", "4.0"}, {"angular_tolerance", "0.01"}})
+          .BuildIndexed();
+  ExpectSameQueries(*indexed.road_position_index, -40., 240.);
+  std::filesystem::remove(path);
+}
+
+using RoadPositionIndexCityGridTest = IndexedCityGridTest;
+
+TEST_F(RoadPositionIndexCityGridTest, MatchesRoadGeometry) {
+  ExpectSameQueries(*indexed_.road_position_index, -20., 320.);
+}
+
+TEST(RoadPositionIndexTest, RequiresEveryLaneBox) {
+  const std::unique_ptr<maliput::api::RoadNetwork> road_network = RoadNetworkBuilder(
+      {{"gpkg_file", TEST_RESOURCES_DIR "two_lane_road.gpkg"}, {"linear_tolerance", "0.01"}})();
+  std::unordered_map<std::string, LaneBox> lane_boxes{
+      {"j1_s1_lane1", {maliput::math::Vector3(0., 0., 0.), maliput::math::Vector3(100., 3.5, 0.)}}};
+  EXPECT_THROW(RoadPositionIndex(road_network->road_geometry(), lane_boxes), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace builder
+}  // namespace maliput_geopackage
@@ -0,0 +1,93 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+#include "maliput_geopackage/builder/road_position_query_session.h"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+#include <maliput/api/branch_point.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_geometry.h>
+
+#include "indexed_city_grid_fixture.h"
+
+namespace maliput_geopackage {
+namespace builder {
+namespace test {
+namespace {
+
+using maliput::api::InertialPosition;
+using maliput::api::Lane;
+using maliput::api::LaneEnd;
+using maliput::api::LanePosition;
+using maliput::api::RoadPositionResult;
+
+using RoadPositionQuerySessionTest = IndexedCityGridTest;
+
+// Drives through several lanes 5 cm at a time, following their successors and weaving within them.
+TEST_F(RoadPositionQuerySessionTest, FollowsConnectedLanes) {
+  const double linear_tolerance = road_geometry_->linear_tolerance();
+  RoadPositionQuerySession session = indexed_.NewQuerySession();
+  EXPECT_EQ(session.hinted_lane(), nullptr);
+
+  const Lane* lane = road_geometry_->junction(0)->segment(0)->lane(0);
+  int num_queries{0};
+  for (int num_lanes = 0; num_lanes < 6 && lane != nullptr; ++num_lanes) {
+    for (double s = 0.; s < lane->length(); s += 0.05, ++num_queries) {
+      const double r = 0.5 * lane->lane_bounds(s).max() * std::sin(s);
+      const InertialPosition position = lane->ToInertialPosition(LanePosition(s, r, 0.5));
+      const RoadPositionResult actual = session.ToRoadPosition(position);
+      const RoadPositionResult expected = road_geometry_->ToRoadPosition(position);
+      EXPECT_NEAR(actual.distance, expected.distance, linear_tolerance);
+      // Lanes only differ where they overlap, both holding the position.
+      if (actual.road_position.lane != expected.road_position.lane) {
+        EXPECT_LE(actual.distance, linear_tolerance);
+        EXPECT_LE(expected.distance, linear_tolerance);
+      }
+      EXPECT_EQ(session.hinted_lane(), actual.road_position.lane);
+    }
+    const maliput::api::LaneEndSet* ongoing = lane->GetOngoingBranches(LaneEnd::kFinish);
+    lane = ongoing->size() > 0 ? ongoing->get(0).lane : nullptr;
+  }
+
+  const QuerySessionStats& stats = session.stats();
+  EXPECT_EQ(stats.queries, num_queries);
+  EXPECT_EQ(stats.hinted_lane_hits + stats.connected_lane_hits + stats.fallbacks, stats.queries);
+  EXPECT_GT(stats.connected_lane_hits, 0);
+  EXPECT_GE(stats.fallbacks, 1);
+  EXPECT_GT(stats.hit_rate(), 0.99);
+}
+
+TEST_F(RoadPositionQuerySessionTest, FallsBackAfterJumps) {
+  RoadPositionQuerySession session = indexed_.NewQuerySession();
+  EXPECT_EQ(session.stats().hit_rate(), 0.);
+
+  const Lane* first = road_geometry_->junction(0)->segment(0)->lane(0);
+  const Lane* last = road_geometry_->junction(road_geometry_->num_junctions() - 1)->segment(0)->lane(0);
+  const InertialPosition near_first = first->ToInertialPosition(LanePosition(0.5 * first->length(), 0., 0.));
+  const InertialPosition near_last = last->ToInertialPosition(LanePosition(0.5 * last->length(), 0., 0.));
+
+  session.ToRoadPosition(near_first);
+  session.ToRoadPosition(near_first);
+  EXPECT_EQ(session.stats().fallbacks, 1);
+  EXPECT_EQ(session.stats().hinted_lane_hits, 1);
+
+  // A far away position is not on any lane connected to the hint.
+  const RoadPositionResult result = session.ToRoadPosition(near_last);
+  EXPECT_EQ(result.road_position.lane, road_geometry_->ToRoadPosition(near_last).road_position.lane);
+  EXPECT_EQ(session.stats().fallbacks, 2);
+
+  session.Reset();
+  EXPECT_EQ(session.hinted_lane(), nullptr);
+  session.ToRoadPosition(near_last);
+  EXPECT_EQ(session.stats().fallbacks, 3);
+  EXPECT_EQ(session.stats().queries, 4);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace builder
+}  // namespace maliput_geopackage
@@ -0,0 +1,126 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/road_network.h>
+
+#include "maliput_geopackage/builder/load_stats.h"
+#include "maliput_geopackage/builder/road_network_builder.h"
+
+namespace maliput_geopackage {
+namespace builder {
+namespace test {
+namespace {
+
+class SharedCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override { RoadNetworkBuilder::ClearSharedCache(); }
+
+  void TearDown() override { RoadNetworkBuilder::ClearSharedCache(); }
+
+  // Loads `gpkg_file` with the shared cache enabled and the given extra keys.
+  // @returns Whether the parsed map came from the cache.
+  bool Load(const std::string& gpkg_file, std::map<std::string, std::string> config = {}) {
+    config.emplace("gpkg_file", gpkg_file);
+    config.emplace("shared_cache", "true");
+    config.emplace("linear_tolerance", "0.01");
+    LoadStats load_stats;
+    const std::unique_ptr<maliput::api::RoadNetwork> road_network = RoadNetworkBuilder(config)(&load_stats);
+    EXPECT_NE(road_network, nullptr);
+    EXPECT_GT(load_stats.parser.lanes, 0);
+    return load_stats.loaded_from_shared_cache;
+  }
+
+  const std::string kTwoLaneRoad{TEST_RESOURCES_DIR "two_lane_road.gpkg"};
+  const std::string kTShapeRoad{TEST_RESOURCES_DIR "t_shape_road.gpkg"};
+};
+
+TEST_F(SharedCacheTest, ReusesParsedMap) {
+  const std::map<std::string, std::string> config{
+      {"gpkg_file", kTShapeRoad}, {"linear_tolerance", "0.01"}, {"shared_cache", "true"}};
+  LoadStats first_stats;
+  const auto first = RoadNetworkBuilder(config)(&first_stats);
+  EXPECT_FALSE(first_stats.loaded_from_shared_cache);
+
+  LoadStats second_stats;
+  const auto second = RoadNetworkBuilder(config)(&second_stats);
+  EXPECT_TRUE(second_stats.loaded_from_shared_cache);
+  ASSERT_EQ(second_stats.phases.size(), 2u);
+  EXPECT_EQ(second_stats.phases[0].name, "shared_cache");
+  EXPECT_EQ(second_stats.phases[1].name, "road_network_loader");
+  EXPECT_EQ(second_stats.parser.lanes, first_stats.parser.lanes);
+  EXPECT_NE(second_stats.ToJson().find("\"loaded_from_shared_cache\": true"), std::string::npos);
+
+  // Every load gets its own RoadNetwork.
+  EXPECT_NE(first->road_geometry(), second->road_geometry());
+  EXPECT_EQ(first->road_geometry()->num_junctions(), second->road_geometry()->num_junctions());
+
+  // The cache is opt-in.
+  LoadStats uncached_stats;
+  RoadNetworkBuilder({{"gpkg_file", kTShapeRoad}, {"linear_tolerance", "0.01"}})(&uncached_stats);
+  EXPECT_FALSE(uncached_stats.loaded_from_shared_cache);
+}
+
+TEST_F(SharedCacheTest, CoalescesConcurrentLoads) {
+  constexpr int kNumLoads{8};
+  std::vector<char> from_cache(kNumLoads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumLoads; ++i) {
+    threads.emplace_back([&, i] { from_cache[i] = Load(kTShapeRoad); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  int parses{0};
+  for (const char cached : from_cache) {
+    parses += !cached;
+  }
+  EXPECT_EQ(parses, 1);
+}
+
+TEST_F(SharedCacheTest, KeyedByFileAndConfiguration) {
+  const std::filesystem::path path = std::filesystem::temp_directory_path() / "shared_cache_test.gpkg";
+  std::filesystem::copy_file(kTwoLaneRoad, path, std::filesystem::copy_options::overwrite_existing);
+  EXPECT_FALSE(Load(path.string()));
+  EXPECT_TRUE(Load(path.string()));
+  // Keys that do not change the parsed map share it.
+  EXPECT_TRUE(Load(path.string(), {{"parser_threads", "2"}, {"shared_cache_capacity", "3"}}));
+  EXPECT_FALSE(Load(path.string(), {{"simplify_boundaries", "simplify"}}));
+  EXPECT_FALSE(Load(kTwoLaneRoad));
+
+  // A modified file is parsed again.
+  std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::seconds(1));
+  EXPECT_FALSE(Load(path.string()));
+  EXPECT_TRUE(Load(path.string()));
+  std::filesystem::remove(path);
+}
+
+TEST_F(SharedCacheTest, EvictsLeastRecentlyUsed) {
+  const std::map<std::string, std::string> kCapacityOne{{"shared_cache_capacity", "1"}};
+  EXPECT_FALSE(Load(kTwoLaneRoad, kCapacityOne));
+  EXPECT_FALSE(Load(kTShapeRoad, kCapacityOne));
+  EXPECT_FALSE(Load(kTwoLaneRoad, kCapacityOne));
+
+  const std::map<std::string, std::string> kCapacityTwo{{"shared_cache_capacity", "2"}};
+  EXPECT_FALSE(Load(kTShapeRoad, kCapacityTwo));
+  EXPECT_TRUE(Load(kTwoLaneRoad, kCapacityTwo));
+  EXPECT_TRUE(Load(kTShapeRoad, kCapacityTwo));
+
+  RoadNetworkBuilder::ClearSharedCache();
+  EXPECT_FALSE(Load(kTShapeRoad, kCapacityTwo));
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace builder
+}  // namespace maliput_geopackage
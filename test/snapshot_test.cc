@@ -0,0 +1,132 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+#include "maliput_geopackage/geopackage/snapshot.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "maliput_geopackage/geopackage/geopackage_parser.h"
+#include "maliput_geopackage/geopackage/mapped_file.h"
+
+namespace maliput_geopackage {
+namespace geopackage {
+namespace test {
+
+class SnapshotTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::filesystem::create_directories(cache_dir_);
+    key_ = ComputeSnapshotKey(kTShapeRoadPath, ParserConfiguration{});
+    snapshot_path_ = SnapshotPath(kTShapeRoadPath, cache_dir_, key_);
+  }
+
+  void TearDown() override { std::filesystem::remove_all(cache_dir_); }
+
+  // Overwrites the byte at `offset` of the snapshot with its complement.
+  void FlipByte(size_t offset) {
+    std::fstream file(snapshot_path_, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekg(offset);
+    const char byte = static_cast<char>(file.get());
+    file.seekp(offset);
+    file.put(static_cast<char>(~byte));
+  }
+
+  const std::string kTShapeRoadPath{std::string(TEST_RESOURCES_DIR) + "t_shape_road.gpkg"};
+  const std::string cache_dir_{::testing::TempDir() + "maliput_geopackage_snapshot_test"};
+  SnapshotKey key_;
+  std::string snapshot_path_;
+  std::unordered_map<maliput_sparse::parser::Junction::Id, maliput_sparse::parser::Junction> junctions_;
+  std::vector<maliput_sparse::parser::Connection> connections_;
+};
+
+TEST_F(SnapshotTest, Hash64) {
+  const std::string text{"The quick brown fox jumps over the lazy dog, 0123456789"};
+  EXPECT_EQ(Hash64(text.data(), text.size()), Hash64(text.data(), text.size()));
+  EXPECT_NE(Hash64(text.data(), text.size()), Hash64(text.data(), text.size() - 1));
+  EXPECT_NE(Hash64(text.data(), text.size()), Hash64(text.data(), text.size(), 1));
+  std::string changed = text;
+  for (size_t i = 0; i < text.size(); ++i) {
+    changed[i] ^= 0x01;
+    EXPECT_NE(Hash64(text.data(), text.size()), Hash64(changed.data(), changed.size())) << "Byte " << i;
+    changed[i] = text[i];
+  }
+}
+
+TEST_F(SnapshotTest, KeyDependsOnParsingOptions) {
+  ParserConfiguration config;
+  config.parser_threads = 4;
+  EXPECT_EQ(ComputeSnapshotKey(kTShapeRoadPath, config).config_hash, key_.config_hash);
+
+  config.load_region = Region2d{0., 0., 10., 10.};
+  const SnapshotKey region_key = ComputeSnapshotKey(kTShapeRoadPath, config);
+  EXPECT_EQ(region_key.content_hash, key_.content_hash);
+  EXPECT_NE(region_key.config_hash, key_.config_hash);
+  EXPECT_NE(SnapshotPath(kTShapeRoadPath, cache_dir_, region_key), snapshot_path_);
+
+  config.boundary_policy = BoundaryPolicy::kClosure;
+  EXPECT_NE(ComputeSnapshotKey(kTShapeRoadPath, config).config_hash, region_key.config_hash);
+}
+
+TEST_F(SnapshotTest, SnapshotPath) {
+  EXPECT_EQ(SnapshotPath("/maps/town.gpkg", "", key_).rfind("/maps/town.gpkg.", 0), 0u);
+  EXPECT_EQ(std::filesystem::path(snapshot_path_).parent_path(), std::filesystem::path(cache_dir_));
+  // Files sharing a name in different directories do not share a snapshot.
+  EXPECT_NE(SnapshotPath("/maps/a/town.gpkg", cache_dir_, key_), SnapshotPath("/maps/b/town.gpkg", cache_dir_, key_));
+}
+
+TEST_F(SnapshotTest, RoundTrip) {
+  const GeoPackageParser parser(kTShapeRoadPath);
+  WriteSnapshot(snapshot_path_, key_, parser.GetJunctions(), parser.GetConnections());
+
+  ASSERT_TRUE(ReadSnapshot(snapshot_path_, key_, &junctions_, &connections_));
+  EXPECT_EQ(junctions_, parser.GetJunctions());
+  EXPECT_EQ(connections_, parser.GetConnections());
+}
+
+TEST_F(SnapshotTest, MissingSnapshotIsRejected) {
+  EXPECT_FALSE(ReadSnapshot(snapshot_path_, key_, &junctions_, &connections_));
+}
+
+TEST_F(SnapshotTest, StaleSnapshotIsRejected) {
+  const GeoPackageParser parser(kTShapeRoadPath);
+  WriteSnapshot(snapshot_path_, key_, parser.GetJunctions(), parser.GetConnections());
+
+  for (const auto& stale_key : {SnapshotKey{key_.file_size + 1, key_.mtime, key_.content_hash, key_.config_hash},
+                                SnapshotKey{key_.file_size, key_.mtime + 1, key_.content_hash, key_.config_hash},
+                                SnapshotKey{key_.file_size, key_.mtime, key_.content_hash + 1, key_.config_hash},
+                                SnapshotKey{key_.file_size, key_.mtime, key_.content_hash, key_.config_hash + 1}}) {
+    EXPECT_FALSE(ReadSnapshot(snapshot_path_, stale_key, &junctions_, &connections_));
+  }
+  EXPECT_TRUE(junctions_.empty());
+  EXPECT_TRUE(connections_.empty());
+}
+
+TEST_F(SnapshotTest, CorruptSnapshotIsRejected) {
+  const GeoPackageParser parser(kTShapeRoadPath);
+  WriteSnapshot(snapshot_path_, key_, parser.GetJunctions(), parser.GetConnections());
+  const size_t size = std::filesystem::file_size(snapshot_path_);
+
+  // Header, payload start and payload end.
+  for (const size_t offset : {size_t{0}, size_t{10}, size_t{64}, size / 2, size - 1}) {
+    FlipByte(offset);
+    EXPECT_FALSE(ReadSnapshot(snapshot_path_, key_, &junctions_, &connections_)) << "Offset " << offset;
+    FlipByte(offset);
+  }
+  std::filesystem::resize_file(snapshot_path_, size - 3);
+  EXPECT_FALSE(ReadSnapshot(snapshot_path_, key_, &junctions_, &connections_));
+  std::filesystem::resize_file(snapshot_path_, 0);
+  EXPECT_FALSE(ReadSnapshot(snapshot_path_, key_, &junctions_, &connections_));
+  EXPECT_TRUE(junctions_.empty());
+  EXPECT_TRUE(connections_.empty());
+}
+
+}  // namespace test
+}  // namespace geopackage
+}  // namespace maliput_geopackage
@@ -0,0 +1,121 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+#include "maliput_geopackage/geopackage/spatial_index.h"
+
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <sqlite3.h>
+
+#include "maliput_geopackage/geopackage/sqlite_helpers.h"
+
+namespace maliput_geopackage {
+namespace geopackage {
+namespace test {
+
+class SpatialIndexTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_EQ(sqlite3_open(":memory:", &db_), SQLITE_OK);
+    Execute(db_,
+            "CREATE TABLE lanes (lane_id TEXT PRIMARY KEY, segment_id TEXT, lane_type TEXT, "
+            "  direction TEXT, left_boundary TEXT, right_boundary TEXT);"
+            "INSERT INTO lanes VALUES ('l1', 's1', 'driving', 'forward', "
+            "  'LINESTRINGZ(0 3.5 0, 100 3.5 1)', 'LINESTRINGZ(0 0 0, 100 0 1)');"
+            "INSERT INTO lanes VALUES ('l2', 's2', 'driving', 'forward', "
+            "  'LINESTRINGZ(200 -10 2, 200 -110 2)', 'LINESTRINGZ(203.5 -10 2, 203.5 -110 2)');");
+  }
+
+  void TearDown() override { sqlite3_close(db_); }
+
+  // @returns The lanes whose indexed extent intersects `region`.
+  std::vector<std::string> QueryIndex(const Region2d& region) {
+    sqlite3_stmt* stmt;
+    EXPECT_EQ(sqlite3_prepare_v2(db_,
+                                 "SELECT lane_id FROM rtree_lanes WHERE min_x <= ?1 AND max_x >= ?2 AND "
+                                 "min_y <= ?3 AND max_y >= ?4 ORDER BY lane_id",
+                                 -1, &stmt, nullptr),
+              SQLITE_OK);
+    sqlite3_bind_double(stmt, 1, region.max_x);
+    sqlite3_bind_double(stmt, 2, region.min_x);
+    sqlite3_bind_double(stmt, 3, region.max_y);
+    sqlite3_bind_double(stmt, 4, region.min_y);
+    std::vector<std::string> lane_ids;
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+      lane_ids.emplace_back(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0)));
+    }
+    sqlite3_finalize(stmt);
+    return lane_ids;
+  }
+
+  sqlite3* db_{nullptr};
+};
+
+TEST_F(SpatialIndexTest, ComputeExtent) {
+  const LaneExtent extent = ComputeExtent({{1., -2., 3.}, {-4., 5., 0.5}, {2., 0., 7.}});
+  EXPECT_EQ(extent.min_x, -4.);
+  EXPECT_EQ(extent.max_x, 2.);
+  EXPECT_EQ(extent.min_y, -2.);
+  EXPECT_EQ(extent.max_y, 5.);
+  EXPECT_EQ(extent.min_z, 0.5);
+  EXPECT_EQ(extent.max_z, 7.);
+}
+
+TEST_F(SpatialIndexTest, Intersects) {
+  const LaneExtent extent{0., 10., 0., 5., 0., 0.};
+  EXPECT_TRUE(Intersects(extent, Region2d{5., 1., 6., 2.}));
+  EXPECT_TRUE(Intersects(extent, Region2d{-5., -5., 50., 50.}));
+  // Touching counts as intersecting.
+  EXPECT_TRUE(Intersects(extent, Region2d{10., 5., 20., 20.}));
+  EXPECT_FALSE(Intersects(extent, Region2d{10.5, 0., 20., 5.}));
+  EXPECT_FALSE(Intersects(extent, Region2d{0., -3., 10., -0.1}));
+}
+
+TEST_F(SpatialIndexTest, ForEachLaneExtent) {
+  std::map<std::string, LaneExtent> extents;
+  ForEachLaneExtent(db_, [&extents](const std::string& lane_id, const LaneExtent& extent) { extents[lane_id] = extent; });
+
+  ASSERT_EQ(extents.size(), 2u);
+  EXPECT_EQ(extents["l1"].max_x, 100.);
+  EXPECT_EQ(extents["l1"].max_y, 3.5);
+  EXPECT_EQ(extents["l1"].max_z, 1.);
+  EXPECT_EQ(extents["l2"].min_y, -110.);
+  EXPECT_EQ(extents["l2"].max_x, 203.5);
+}
+
+TEST_F(SpatialIndexTest, BuildIndexesEveryLane) {
+  EXPECT_FALSE(HasLaneSpatialIndex(db_));
+  BuildLaneSpatialIndex(db_);
+
+  EXPECT_TRUE(HasLaneSpatialIndex(db_));
+  EXPECT_EQ(CountRows(db_, kLaneSpatialIndexTable), 2);
+  EXPECT_EQ(QueryIndex(Region2d{-1000., -1000., 1000., 1000.}), (std::vector<std::string>{"l1", "l2"}));
+  EXPECT_EQ(QueryIndex(Region2d{50., 1., 60., 2.}), (std::vector<std::string>{"l1"}));
+  EXPECT_EQ(QueryIndex(Region2d{201., -50., 202., -40.}), (std::vector<std::string>{"l2"}));
+  EXPECT_TRUE(QueryIndex(Region2d{120., 0., 150., 10.}).empty());
+}
+
+TEST_F(SpatialIndexTest, BuildingTwiceThrows) {
+  BuildLaneSpatialIndex(db_);
+  EXPECT_THROW(BuildLaneSpatialIndex(db_), std::runtime_error);
+  EXPECT_EQ(CountRows(db_, kLaneSpatialIndexTable), 2);
+}
+
+TEST_F(SpatialIndexTest, MalformedGeometryLeavesDatabaseUntouched) {
+  Execute(db_,
+          "INSERT INTO lanes VALUES ('l3', 's3', 'driving', 'forward', "
+          "  'LINESTRINGZ(0 1 0, ten 1 0)', 'LINESTRINGZ(0 0 0, 10 0 0)');");
+
+  EXPECT_THROW(BuildLaneSpatialIndex(db_), std::runtime_error);
+  EXPECT_FALSE(HasLaneSpatialIndex(db_));
+  EXPECT_TRUE(sqlite3_get_autocommit(db_));
+}
+
+}  // namespace test
+}  // namespace geopackage
+}  // namespace maliput_geopackage
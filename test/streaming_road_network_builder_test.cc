@@ -0,0 +1,91 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+#include "maliput_geopackage/builder/streaming_road_network_builder.h"
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/road_network.h>
+#include <maliput/api/segment.h>
+
+#include "tools/city_grid.h"
+
+namespace maliput_geopackage {
+namespace builder {
+namespace test {
+namespace {
+
+using maliput::math::Vector3;
+
+class StreamingRoadNetworkBuilderTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    path_ = (std::filesystem::temp_directory_path() /
+             ("streaming_road_network_builder_test_" +
+              std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) + ".gpkg"))
+                .string();
+    tools::CityGridOptions options;
+    options.blocks_x = 4;
+    options.blocks_y = 4;
+    options.build_spatial_index = true;
+    tools::GenerateCityGrid(options, path_);
+  }
+
+  void TearDown() override { std::filesystem::remove(path_); }
+
+  std::map<std::string, std::string> Config(const std::string& translation) const {
+    return {{"gpkg_file", path_},
+            {"linear_tolerance", "0.01"},
+            {"angular_tolerance", "0.01"},
+            {"inertial_to_backend_frame_translation", translation}};
+  }
+
+  std::string path_;
+};
+
+// Tiles are laid out over the stored coordinates, so positions are moved into the backend frame first.
+TEST_F(StreamingRoadNetworkBuilderTest, WindowFollowsBackendFrameTranslation) {
+  StreamingConfiguration streaming_config;
+  streaming_config.radius = 100.;
+  streaming_config.tile_size = 100.;
+  StreamingRoadNetworkBuilder builder(Config("{0.0, 0.0, 0.0}"), streaming_config);
+  StreamingRoadNetworkBuilder translated_builder(Config("{1000.0, -500.0, 0.0}"), streaming_config);
+  const Vector3 translation(1000., -500., 0.);
+  const Vector3 position(150., 150., 0.);
+
+  const std::unique_ptr<maliput::api::RoadNetwork> expected = builder.Build(position);
+  const std::unique_ptr<maliput::api::RoadNetwork> actual = translated_builder.Build(position - translation);
+  const maliput::api::RoadGeometry* expected_geometry = expected->road_geometry();
+  const maliput::api::RoadGeometry* actual_geometry = actual->road_geometry();
+  ASSERT_GT(expected_geometry->num_junctions(), 0);
+  ASSERT_EQ(actual_geometry->num_junctions(), expected_geometry->num_junctions());
+  for (int i = 0; i < expected_geometry->num_junctions(); ++i) {
+    const maliput::api::Lane* expected_lane = expected_geometry->junction(i)->segment(0)->lane(0);
+    const maliput::api::Lane* actual_lane = actual_geometry->ById().GetLane(expected_lane->id());
+    ASSERT_NE(actual_lane, nullptr) << expected_lane->id().string();
+    const maliput::api::LanePosition start(0., 0., 0.);
+    const Vector3 expected_xyz = expected_lane->ToInertialPosition(start).xyz() - translation;
+    const Vector3 actual_xyz = actual_lane->ToInertialPosition(start).xyz();
+    EXPECT_NEAR(actual_xyz.x(), expected_xyz.x(), 1e-9);
+    EXPECT_NEAR(actual_xyz.y(), expected_xyz.y(), 1e-9);
+    EXPECT_NEAR(actual_xyz.z(), expected_xyz.z(), 1e-9);
+  }
+
+  // The window around the same inertial position is the current one.
+  EXPECT_EQ(translated_builder.Update(position - translation + Vector3(1., 1., 0.)), nullptr);
+  EXPECT_EQ(translated_builder.stats().builds, 1);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace builder
+}  // namespace maliput_geopackage
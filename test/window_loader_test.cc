@@ -0,0 +1,167 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+#include "maliput_geopackage/geopackage/window_loader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <tuple>
+
+#include <gtest/gtest.h>
+
+#include "tools/city_grid.h"
+
+namespace maliput_geopackage {
+namespace geopackage {
+namespace test {
+
+using maliput::math::Vector3;
+
+class WindowLoaderTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    path_ = (std::filesystem::temp_directory_path() /
+             ("window_loader_test_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) +
+              ".gpkg"))
+                .string();
+    tools::CityGridOptions options;
+    options.blocks_x = 4;
+    options.blocks_y = 4;
+    options.build_spatial_index = true;
+    tools::GenerateCityGrid(options, path_);
+  }
+
+  void TearDown() override { std::filesystem::remove(path_); }
+
+  WindowLoader::ParserFactory Factory() const {
+    return [path = path_](const ParserConfiguration& config) { return std::make_unique<GeoPackageParser>(path, config); };
+  }
+
+  // Waits until the prefetching thread has parsed `count` tiles.
+  static void WaitForPrefetch(const WindowLoader& loader, int64_t count) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (loader.stats().tiles_prefetched < count && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+  }
+
+  std::string path_;
+};
+
+// @returns Every connection of `parser` as a comparable tuple.
+std::set<std::tuple<std::string, int, std::string, int>> Connections(const maliput_sparse::parser::Parser& parser) {
+  std::set<std::tuple<std::string, int, std::string, int>> connections;
+  for (const auto& connection : parser.GetConnections()) {
+    connections.emplace(connection.from.lane_id, static_cast<int>(connection.from.end), connection.to.lane_id,
+                        static_cast<int>(connection.to.end));
+  }
+  return connections;
+}
+
+TEST_F(WindowLoaderTest, WindowCoveringEverythingMatchesFullLoad) {
+  WindowConfiguration config;
+  config.radius = 1000.;
+  config.tile_size = 150.;
+  WindowLoader loader(Factory(), {}, config);
+  const std::unique_ptr<maliput_sparse::parser::Parser> window = loader.Load(Vector3(200., 200., 0.));
+
+  const GeoPackageParser full_parser(path_);
+  EXPECT_EQ(window->GetJunctions(), full_parser.GetJunctions());
+  EXPECT_EQ(Connections(*window), Connections(full_parser));
+  EXPECT_EQ(loader.stats().tiles_loaded, static_cast<int64_t>(loader.WindowTiles(Vector3(200., 200., 0.)).size()));
+}
+
+TEST_F(WindowLoaderTest, PartialWindowIsSelfContained) {
+  WindowConfiguration config;
+  config.radius = 60.;
+  config.tile_size = 50.;
+  WindowLoader loader(Factory(), {}, config);
+  const std::unique_ptr<maliput_sparse::parser::Parser> window = loader.Load(Vector3(100., 100., 0.));
+
+  std::set<std::string> lane_ids;
+  for (const auto& [junction_id, junction] : window->GetJunctions()) {
+    for (const auto& [segment_id, segment] : junction.segments) {
+      for (const auto& lane : segment.lanes) {
+        lane_ids.insert(lane.id);
+      }
+    }
+  }
+  EXPECT_FALSE(lane_ids.empty());
+  EXPECT_LT(window->GetJunctions().size(), GeoPackageParser(path_).GetJunctions().size());
+  for (const auto& connection : window->GetConnections()) {
+    EXPECT_EQ(lane_ids.count(connection.from.lane_id), 1u);
+    EXPECT_EQ(lane_ids.count(connection.to.lane_id), 1u);
+  }
+}
+
+TEST_F(WindowLoaderTest, MovingWindowReusesTiles) {
+  WindowConfiguration config;
+  config.radius = 50.;
+  config.tile_size = 50.;
+  WindowLoader loader(Factory(), {}, config);
+
+  // A 3x3 tile window.
+  loader.Load(Vector3(125., 125., 0.));
+  EXPECT_EQ(loader.stats().tiles_loaded, 9);
+  EXPECT_TRUE(loader.IsCurrentWindow(Vector3(130., 120., 0.)));
+  EXPECT_FALSE(loader.IsCurrentWindow(Vector3(175., 125., 0.)));
+
+  // Moving one tile east only parses the new column.
+  loader.Load(Vector3(175., 125., 0.));
+  const WindowStats stats = loader.stats();
+  EXPECT_EQ(stats.tiles_loaded, 12);
+  EXPECT_EQ(stats.tile_hits, 6);
+  EXPECT_EQ(stats.cached_tiles, 12);
+  EXPECT_EQ(stats.tiles_evicted, 0);
+}
+
+TEST_F(WindowLoaderTest, EvictsToMemoryBudget) {
+  WindowConfiguration config;
+  config.radius = 50.;
+  config.tile_size = 50.;
+  config.memory_budget_bytes = 1;
+  WindowLoader loader(Factory(), {}, config);
+
+  loader.Load(Vector3(125., 125., 0.));
+  loader.Load(Vector3(275., 275., 0.));
+  const WindowStats stats = loader.stats();
+  // Only the current window is kept.
+  EXPECT_EQ(stats.cached_tiles, 9);
+  EXPECT_EQ(stats.tiles_evicted, stats.tiles_loaded - 9);
+  EXPECT_GT(stats.tiles_evicted, 0);
+}
+
+TEST_F(WindowLoaderTest, PrefetchesAlongRoute) {
+  WindowConfiguration config;
+  config.radius = 50.;
+  config.tile_size = 50.;
+  config.prefetch_distance = 100.;
+  WindowLoader loader(Factory(), {}, config);
+  loader.SetRoute({Vector3(25., 200., 0.), Vector3(375., 200., 0.)});
+
+  loader.Load(Vector3(25., 200., 0.));
+  // Samples every half tile up to 100m ahead reach the windows around x = 50 to 125, which add
+  // the tile columns 2 and 3 to the window columns -1 to 1.
+  WaitForPrefetch(loader, 6);
+  EXPECT_EQ(loader.stats().tiles_prefetched, 6);
+  const int64_t tiles_loaded = loader.stats().tiles_loaded;
+
+  loader.Load(Vector3(125., 200., 0.));
+  EXPECT_EQ(loader.stats().tiles_loaded, tiles_loaded);
+}
+
+TEST_F(WindowLoaderTest, InvalidConfigurationThrows) {
+  WindowConfiguration config;
+  config.radius = 0.;
+  EXPECT_THROW(WindowLoader(Factory(), {}, config), std::runtime_error);
+}
+
+}  // namespace test
+}  // namespace geopackage
+}  // namespace maliput_geopackage
@@ -0,0 +1,157 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+#include "maliput_geopackage/geopackage/wkb_parser.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace maliput_geopackage {
+namespace geopackage {
+namespace test {
+namespace {
+
+// Appends `value` to `bytes` in the requested byte order.
+template <typename T>
+void Append(T value, bool little_endian, std::vector<uint8_t>* bytes) {
+  uint8_t raw[sizeof(T)];
+  std::memcpy(raw, &value, sizeof(T));
+  const uint16_t probe{1};
+  const bool host_little_endian = *reinterpret_cast<const uint8_t*>(&probe) == 1;
+  for (size_t i = 0; i < sizeof(T); ++i) {
+    bytes->push_back(raw[little_endian == host_little_endian ? i : sizeof(T) - 1 - i]);
+  }
+}
+
+// Builds a WKB LineString of type `type` from `coordinates`, laid out point by point.
+std::vector<uint8_t> MakeWkb(bool little_endian, uint32_t type, uint32_t num_points,
+                             const std::vector<double>& coordinates) {
+  std::vector<uint8_t> wkb{static_cast<uint8_t>(little_endian ? 1 : 0)};
+  Append(type, little_endian, &wkb);
+  Append(num_points, little_endian, &wkb);
+  for (const double c : coordinates) {
+    Append(c, little_endian, &wkb);
+  }
+  return wkb;
+}
+
+// Prepends a GeoPackage binary header with an XY envelope to `wkb`.
+std::vector<uint8_t> MakeGpb(bool little_endian, const std::vector<double>& envelope, const std::vector<uint8_t>& wkb) {
+  const uint8_t envelope_indicator = envelope.empty() ? 0 : 1;
+  std::vector<uint8_t> gpb{'G', 'P', 0, static_cast<uint8_t>((envelope_indicator << 1) | (little_endian ? 1 : 0))};
+  Append(int32_t{4326}, little_endian, &gpb);
+  for (const double e : envelope) {
+    Append(e, little_endian, &gpb);
+  }
+  gpb.insert(gpb.end(), wkb.begin(), wkb.end());
+  return gpb;
+}
+
+const std::vector<double> kCoordinates{0., 0., 0., 10., 5., 1., 20., 10., 2.};
+const std::vector<double> kEnvelope{0., 20., 0., 10.};
+
+void ExpectCoordinates(const std::vector<maliput::math::Vector3>& points) {
+  ASSERT_EQ(points.size(), 3u);
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_DOUBLE_EQ(points[i].x(), kCoordinates[3 * i]);
+    EXPECT_DOUBLE_EQ(points[i].y(), kCoordinates[3 * i + 1]);
+    EXPECT_DOUBLE_EQ(points[i].z(), kCoordinates[3 * i + 2]);
+  }
+}
+
+TEST(WkbParserTest, LittleEndianGeoPackageBinary) {
+  const auto gpb = MakeGpb(true, kEnvelope, MakeWkb(true, 1002, 3, kCoordinates));
+  ExpectCoordinates(ParseGeoPackageBinaryLineStringZ(gpb.data(), gpb.size()));
+}
+
+TEST(WkbParserTest, BigEndianGeoPackageBinary) {
+  const auto gpb = MakeGpb(false, kEnvelope, MakeWkb(false, 1002, 3, kCoordinates));
+  ExpectCoordinates(ParseGeoPackageBinaryLineStringZ(gpb.data(), gpb.size()));
+}
+
+TEST(WkbParserTest, MixedEndiannessWithoutEnvelope) {
+  const auto gpb = MakeGpb(false, {}, MakeWkb(true, 0x80000002, 3, kCoordinates));
+  ExpectCoordinates(ParseGeoPackageBinaryLineStringZ(gpb.data(), gpb.size()));
+}
+
+TEST(WkbParserTest, LineStringZMDropsMeasure) {
+  const std::vector<double> zm{0., 0., 0., 7., 10., 5., 1., 7., 20., 10., 2., 7.};
+  const auto wkb = MakeWkb(true, 3002, 3, zm);
+  std::vector<maliput::math::Vector3> points;
+  ParseWkbLineStringZ(wkb.data(), wkb.size(), &points);
+  ExpectCoordinates(points);
+}
+
+TEST(WkbParserTest, AppendsToBuffer) {
+  const auto gpb = MakeGpb(true, kEnvelope, MakeWkb(true, 1002, 3, kCoordinates));
+  std::vector<maliput::math::Vector3> points{maliput::math::Vector3(-1., -1., -1.)};
+  ParseGeoPackageBinaryLineStringZ(gpb.data(), gpb.size(), &points);
+  ASSERT_EQ(points.size(), 4u);
+  EXPECT_DOUBLE_EQ(points[0].x(), -1.);
+  EXPECT_DOUBLE_EQ(points[3].x(), 20.);
+}
+
+TEST(WkbParserTest, IsGeoPackageBinary) {
+  const auto gpb = MakeGpb(true, kEnvelope, MakeWkb(true, 1002, 3, kCoordinates));
+  const auto wkb = MakeWkb(true, 1002, 3, kCoordinates);
+  EXPECT_TRUE(IsGeoPackageBinary(gpb.data(), gpb.size()));
+  EXPECT_FALSE(IsGeoPackageBinary(wkb.data(), wkb.size()));
+  EXPECT_FALSE(IsGeoPackageBinary(gpb.data(), 1));
+}
+
+TEST(WkbParserTest, InvalidGeoPackageBinaryThrows) {
+  const auto wkb = MakeWkb(true, 1002, 3, kCoordinates);
+
+  auto bad_magic = MakeGpb(true, kEnvelope, wkb);
+  bad_magic[1] = 'X';
+  EXPECT_THROW(ParseGeoPackageBinaryLineStringZ(bad_magic.data(), bad_magic.size()), std::runtime_error);
+
+  auto bad_envelope_indicator = MakeGpb(true, kEnvelope, wkb);
+  bad_envelope_indicator[3] = 0x0B;
+  EXPECT_THROW(ParseGeoPackageBinaryLineStringZ(bad_envelope_indicator.data(), bad_envelope_indicator.size()),
+               std::runtime_error);
+
+  auto empty = MakeGpb(true, kEnvelope, wkb);
+  empty[3] |= 0x10;
+  EXPECT_THROW(ParseGeoPackageBinaryLineStringZ(empty.data(), empty.size()), std::runtime_error);
+
+  auto extended = MakeGpb(true, kEnvelope, wkb);
+  extended[3] |= 0x20;
+  EXPECT_THROW(ParseGeoPackageBinaryLineStringZ(extended.data(), extended.size()), std::runtime_error);
+
+  const auto inverted_envelope = MakeGpb(true, {20., 0., 0., 10.}, wkb);
+  EXPECT_THROW(ParseGeoPackageBinaryLineStringZ(inverted_envelope.data(), inverted_envelope.size()),
+               std::runtime_error);
+
+  const auto truncated = MakeGpb(true, kEnvelope, wkb);
+  EXPECT_THROW(ParseGeoPackageBinaryLineStringZ(truncated.data(), truncated.size() - 1), std::runtime_error);
+  EXPECT_THROW(ParseGeoPackageBinaryLineStringZ(truncated.data(), 20), std::runtime_error);
+}
+
+TEST(WkbParserTest, InvalidWkbThrows) {
+  const auto two_dimensional = MakeWkb(true, 2, 2, {0., 0., 1., 1.});
+  EXPECT_THROW(ParseGeoPackageBinaryLineStringZ(MakeGpb(true, {}, two_dimensional).data(),
+                                                MakeGpb(true, {}, two_dimensional).size()),
+               std::runtime_error);
+
+  std::vector<maliput::math::Vector3> points;
+  const auto single_point = MakeWkb(true, 1002, 1, {0., 0., 0.});
+  EXPECT_THROW(ParseWkbLineStringZ(single_point.data(), single_point.size(), &points), std::runtime_error);
+
+  auto bad_byte_order = MakeWkb(true, 1002, 3, kCoordinates);
+  bad_byte_order[0] = 7;
+  EXPECT_THROW(ParseWkbLineStringZ(bad_byte_order.data(), bad_byte_order.size(), &points), std::runtime_error);
+
+  // Declares more points than the buffer holds.
+  const auto short_buffer = MakeWkb(true, 1002, 4, kCoordinates);
+  EXPECT_THROW(ParseWkbLineStringZ(short_buffer.data(), short_buffer.size(), &points), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace geopackage
+}  // namespace maliput_geopackage
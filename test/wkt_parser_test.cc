@@ -4,6 +4,9 @@
 // All rights reserved.
 #include "maliput_geopackage/geopackage/wkt_parser.h"
 
+#include <string_view>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 namespace maliput_geopackage {
@@ -49,6 +52,36 @@ TEST(WktParserTest, ParseLineStringZManyPoints) {
   }
 }
 
+TEST(WktParserTest, ParseLineStringZLowercaseAndExponents) {
+  const std::string wkt = "linestring z (1e2 -2.5E-1 +3, 4 5 6)";
+  const auto points = ParseLineStringZ(wkt);
+
+  ASSERT_EQ(points.size(), 2u);
+  EXPECT_DOUBLE_EQ(points[0].x(), 100.0);
+  EXPECT_DOUBLE_EQ(points[0].y(), -0.25);
+  EXPECT_DOUBLE_EQ(points[0].z(), 3.0);
+}
+
+TEST(WktParserTest, ParseLineStringZAppendsToBuffer) {
+  std::vector<maliput::math::Vector3> points{maliput::math::Vector3(-1., -1., -1.)};
+  ParseLineStringZ(std::string_view("LINESTRINGZ(0 0 0, 10 5 1)"), &points);
+
+  ASSERT_EQ(points.size(), 3u);
+  EXPECT_DOUBLE_EQ(points[0].x(), -1.0);
+  EXPECT_DOUBLE_EQ(points[2].x(), 10.0);
+  EXPECT_DOUBLE_EQ(points[2].z(), 1.0);
+}
+
+TEST(WktParserTest, ParseLineStringZFromNonTerminatedBuffer) {
+  // Only the first 26 characters form the geometry; the rest must not be read.
+  const std::string buffer = "LINESTRINGZ(0 0 0, 10 5 1)9 9 9)";
+  std::vector<maliput::math::Vector3> points;
+  ParseLineStringZ(std::string_view(buffer.data(), 26), &points);
+
+  ASSERT_EQ(points.size(), 2u);
+  EXPECT_DOUBLE_EQ(points[1].z(), 1.0);
+}
+
 TEST(WktParserTest, ParsePointZ) {
   const std::string wkt = "POINTZ(10 5 1)";
   const auto point = ParsePointZ(wkt);
@@ -73,6 +106,21 @@ TEST(WktParserTest, InvalidLineStringThrows) {
   EXPECT_THROW(ParseLineStringZ("LINESTRINGZ()"), std::runtime_error);
 }
 
+TEST(WktParserTest, InvalidLineStringErrorMessages) {
+  try {
+    ParseLineStringZ("LINESTRINGZ(0 0 0, 1 a 0)");
+    FAIL() << "Expected std::runtime_error";
+  } catch (const std::runtime_error& e) {
+    EXPECT_STREQ(e.what(), "Malformed WKT point: ' 1 a 0'");
+  }
+  try {
+    ParseLineStringZ("LINESTRINGZ 0 0 0, 1 1 0");
+    FAIL() << "Expected std::runtime_error";
+  } catch (const std::runtime_error& e) {
+    EXPECT_STREQ(e.what(), "Malformed WKT: missing or mismatched parentheses in 'LINESTRINGZ 0 0 0, 1 1 0'");
+  }
+}
+
 TEST(WktParserTest, InvalidPointThrows) {
   EXPECT_THROW(ParsePointZ("NOT_A_POINT"), std::runtime_error);
   EXPECT_THROW(ParsePointZ("POINTZ()"), std::runtime_error);
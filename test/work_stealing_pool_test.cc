@@ -0,0 +1,78 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+#include "maliput_geopackage/geopackage/work_stealing_pool.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace maliput_geopackage {
+namespace geopackage {
+namespace test {
+namespace {
+
+TEST(WorkStealingPoolTest, RunsEveryItemOnce) {
+  for (const int num_threads : {1, 2, 5}) {
+    WorkStealingPool pool(num_threads);
+    EXPECT_EQ(pool.num_threads(), num_threads);
+    // The pool is reused across runs of different sizes.
+    for (const size_t count : {0, 1, 7, 1000, 12345}) {
+      std::vector<std::atomic<int>> visits(count);
+      pool.Run(count, 16, [&](int thread, size_t begin, size_t end) {
+        ASSERT_GE(thread, 0);
+        ASSERT_LT(thread, num_threads);
+        ASSERT_LT(begin, end);
+        ASSERT_LE(end - begin, 16u);
+        for (size_t i = begin; i < end; ++i) ++visits[i];
+      });
+      for (size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(visits[i], 1) << "threads " << num_threads << ", count " << count << ", item " << i;
+      }
+    }
+  }
+}
+
+// The first chunk waits for every other one, which only happens if other threads take the rest of its share.
+TEST(WorkStealingPoolTest, StealsFromBusyThreads) {
+  constexpr size_t kCount{400};
+  WorkStealingPool pool(4);
+  std::atomic<size_t> done{0};
+  bool share_done{false};
+  pool.Run(kCount, 1, [&](int, size_t begin, size_t) {
+    if (begin == 0) {
+      const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+      while (done < kCount - 1 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      share_done = done == kCount - 1;
+    }
+    ++done;
+  });
+  EXPECT_TRUE(share_done);
+  EXPECT_EQ(done, kCount);
+}
+
+TEST(WorkStealingPoolTest, RethrowsWorkErrors) {
+  WorkStealingPool pool(3);
+  EXPECT_THROW(pool.Run(100, 1,
+                        [](int, size_t begin, size_t) {
+                          if (begin == 42) throw std::runtime_error("Failed.");
+                        }),
+               std::runtime_error);
+  // The pool stays usable.
+  std::atomic<size_t> total{0};
+  pool.Run(100, 10, [&](int, size_t begin, size_t end) { total += end - begin; });
+  EXPECT_EQ(total, 100u);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace geopackage
+}  // namespace maliput_geopackage
@@ -0,0 +1,630 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "tools/city_grid.h"
+
+#include <sqlite3.h>
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "maliput_geopackage/geopackage/spatial_index.h"
+#include "maliput_geopackage/geopackage/sqlite_helpers.h"
+#include "tools/geometry_encoding.h"
+#include "tools/sqlite_statement.h"
+
+namespace maliput_geopackage {
+namespace tools {
+namespace {
+
+using geopackage::Execute;
+
+constexpr double kPi{3.14159265358979323846};
+
+// Bulk loading settings: the file is written from scratch and discarded on failure, so it needs no journal.
+constexpr const char* kPragmas =
+    "PRAGMA page_size = 65536;"
+    "PRAGMA journal_mode = OFF;"
+    "PRAGMA synchronous = OFF;"
+    "PRAGMA locking_mode = EXCLUSIVE;"
+    "PRAGMA temp_store = MEMORY;"
+    "PRAGMA cache_size = -262144;";
+
+// Schema of docs/geopackage_schema.md. Indexes are created once the tables are filled, which is cheaper than
+// maintaining them row by row.
+constexpr const char* kSchema =
+    "CREATE TABLE maliput_metadata (key TEXT PRIMARY KEY, value TEXT NOT NULL);"
+    "CREATE TABLE junctions (junction_id TEXT PRIMARY KEY, name TEXT);"
+    "CREATE TABLE segments (segment_id TEXT PRIMARY KEY, junction_id TEXT NOT NULL, name TEXT, "
+    "  FOREIGN KEY (junction_id) REFERENCES junctions(junction_id));"
+    "CREATE TABLE branch_point_lanes (id INTEGER PRIMARY KEY AUTOINCREMENT, branch_point_id TEXT NOT NULL, "
+    "  lane_id TEXT NOT NULL, side TEXT NOT NULL CHECK (side IN ('a', 'b')), "
+    "  lane_end TEXT NOT NULL CHECK (lane_end IN ('start', 'finish')), "
+    "  FOREIGN KEY (lane_id) REFERENCES lanes(lane_id));"
+    "CREATE TABLE adjacent_lanes (id INTEGER PRIMARY KEY AUTOINCREMENT, lane_id TEXT NOT NULL, "
+    "  adjacent_lane_id TEXT NOT NULL, side TEXT NOT NULL CHECK (side IN ('left', 'right')), "
+    "  FOREIGN KEY (lane_id) REFERENCES lanes(lane_id), "
+    "  FOREIGN KEY (adjacent_lane_id) REFERENCES lanes(lane_id));";
+
+constexpr const char* kLaneSchema =
+    "CREATE TABLE lanes (lane_id TEXT PRIMARY KEY, segment_id TEXT NOT NULL, "
+    "  lane_type TEXT DEFAULT 'driving', direction TEXT DEFAULT 'forward', "
+    "  left_boundary TEXT NOT NULL, right_boundary TEXT NOT NULL, "
+    "  FOREIGN KEY (segment_id) REFERENCES segments(segment_id));";
+
+// Lanes store either their boundaries or the IDs of shared rows of the boundaries table.
+constexpr const char* kSharedBoundaryLaneSchema =
+    "CREATE TABLE boundaries (boundary_id TEXT PRIMARY KEY, geometry TEXT NOT NULL);"
+    "CREATE TABLE lanes (lane_id TEXT PRIMARY KEY, segment_id TEXT NOT NULL, "
+    "  lane_type TEXT DEFAULT 'driving', direction TEXT DEFAULT 'forward', "
+    "  left_boundary TEXT, right_boundary TEXT, left_boundary_id TEXT, right_boundary_id TEXT, "
+    "  FOREIGN KEY (segment_id) REFERENCES segments(segment_id), "
+    "  FOREIGN KEY (left_boundary_id) REFERENCES boundaries(boundary_id), "
+    "  FOREIGN KEY (right_boundary_id) REFERENCES boundaries(boundary_id));";
+
+constexpr const char* kIndexes =
+    "CREATE INDEX idx_segments_junction ON segments(junction_id);"
+    "CREATE INDEX idx_lanes_segment ON lanes(segment_id);"
+    "CREATE INDEX idx_branch_point_lanes_bp ON branch_point_lanes(branch_point_id);"
+    "CREATE INDEX idx_branch_point_lanes_lane ON branch_point_lanes(lane_id);"
+    "CREATE INDEX idx_adjacent_lanes_lane ON adjacent_lanes(lane_id);"
+    "CREATE INDEX idx_adjacent_lanes_adjacent ON adjacent_lanes(adjacent_lane_id);";
+
+struct Vec2 {
+  double x{0.};
+  double y{0.};
+};
+
+Vec2 operator+(const Vec2& a, const Vec2& b) { return {a.x + b.x, a.y + b.y}; }
+Vec2 operator-(const Vec2& a, const Vec2& b) { return {a.x - b.x, a.y - b.y}; }
+Vec2 operator*(double s, const Vec2& v) { return {s * v.x, s * v.y}; }
+double Dot(const Vec2& a, const Vec2& b) { return a.x * b.x + a.y * b.y; }
+
+// @returns `v` rotated a quarter turn counter-clockwise.
+Vec2 Left(const Vec2& v) { return {-v.y, v.x}; }
+
+// Reference line of a segment, parameterized by u in [0, 1] and a lateral offset t, positive to the left.
+// It is either the straight line from `start` to `end`, or the arc of `radius` around `center` starting at
+// `start_angle` and sweeping `sweep` radians.
+struct ReferenceLine {
+  bool is_arc{false};
+  Vec2 start;
+  Vec2 end;
+  Vec2 center;
+  double radius{0.};
+  double start_angle{0.};
+  double sweep{0.};
+
+  Vec2 At(double u, double t) const {
+    if (!is_arc) {
+      const Vec2 direction = end - start;
+      return start + u * direction + (t / std::hypot(direction.x, direction.y)) * Left(direction);
+    }
+    const double angle = start_angle + u * sweep;
+    // The center lies to the left of counter-clockwise arcs and to the right of clockwise ones.
+    const double r = sweep > 0. ? radius - t : radius + t;
+    return {center.x + r * std::cos(angle), center.y + r * std::sin(angle)};
+  }
+};
+
+ReferenceLine StraightLine(const Vec2& start, const Vec2& end) {
+  ReferenceLine line;
+  line.start = start;
+  line.end = end;
+  return line;
+}
+
+// @returns The quarter circle from `entry`, heading `heading`, to `exit`, turning left or right.
+// @pre `exit` is as far from `entry` along `heading` as it is across it.
+ReferenceLine QuarterTurn(const Vec2& entry, const Vec2& heading, const Vec2& exit, bool left_turn) {
+  ReferenceLine line;
+  line.is_arc = true;
+  line.radius = Dot(exit - entry, heading);
+  line.center = entry + (left_turn ? line.radius : -line.radius) * Left(heading);
+  line.start_angle = std::atan2(entry.y - line.center.y, entry.x - line.center.x);
+  line.sweep = left_turn ? kPi / 2. : -kPi / 2.;
+  return line;
+}
+
+// Roads leaving an intersection, in counter-clockwise order.
+enum Arm { kEast = 0, kNorth = 1, kWest = 2, kSouth = 3 };
+constexpr int kNumArms{4};
+constexpr std::array<Vec2, kNumArms> kArmDirections{{{1., 0.}, {0., 1.}, {-1., 0.}, {0., -1.}}};
+constexpr std::array<const char*, kNumArms> kArmNames{{"e", "n", "w", "s"}};
+
+// Roads run along +x or +y, so they start at the east and north arms of an intersection.
+bool StartsAtIntersection(int arm) { return arm == kEast || arm == kNorth; }
+
+// Appends `value` rounded to millimeters to `out`, e.g. "-12.305". Formatting the integer number of millimeters is
+// several times faster than formatting the double, and dominates the generation time of WKT maps otherwise.
+void AppendCoordinate(double value, std::string* out) {
+  const long long millimeters = std::llround(value * 1000.);
+  const unsigned long long magnitude =
+      millimeters < 0 ? 0ull - static_cast<unsigned long long>(millimeters) : static_cast<unsigned long long>(millimeters);
+  char buffer[32];
+  char* p = buffer;
+  if (millimeters < 0) *p++ = '-';
+  p = std::to_chars(p, buffer + sizeof(buffer), magnitude / 1000).ptr;
+  const unsigned fraction = static_cast<unsigned>(magnitude % 1000);
+  *p++ = '.';
+  *p++ = static_cast<char>('0' + fraction / 100);
+  *p++ = static_cast<char>('0' + fraction / 10 % 10);
+  *p++ = static_cast<char>('0' + fraction % 10);
+  out->append(buffer, p);
+}
+
+// Writes the rows of a city grid through prepared statements.
+class CityGridWriter {
+ public:
+  CityGridWriter(const CityGridOptions& options, sqlite3* db)
+      : options_(options),
+        num_lanes_(2 * options.lanes_per_direction),
+        // Intersections extend one lane width beyond the roads, which leaves room for the turns.
+        half_size_((options.lanes_per_direction + 1) * options.lane_width),
+        metadata_(db, "INSERT INTO maliput_metadata (key, value) VALUES (?1, ?2)"),
+        junction_(db, "INSERT INTO junctions (junction_id) VALUES (?1)"),
+        segment_(db, "INSERT INTO segments (segment_id, junction_id) VALUES (?1, ?2)"),
+        lane_(db, options.shared_boundaries
+                      ? "INSERT INTO lanes (lane_id, segment_id, direction, left_boundary, right_boundary, "
+                        "  left_boundary_id, right_boundary_id) VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?7)"
+                      : "INSERT INTO lanes (lane_id, segment_id, direction, left_boundary, right_boundary) "
+                        "VALUES (?1, ?2, ?3, ?4, ?5)"),
+        branch_point_lane_(db,
+                           "INSERT INTO branch_point_lanes (branch_point_id, lane_id, side, lane_end) "
+                           "VALUES (?1, ?2, ?3, ?4)"),
+        adjacent_lane_(db, "INSERT INTO adjacent_lanes (lane_id, adjacent_lane_id, side) VALUES (?1, ?2, ?3)") {
+    if (options.shared_boundaries) {
+      boundary_.emplace(db, "INSERT INTO boundaries (boundary_id, geometry) VALUES (?1, ?2)");
+    }
+  }
+
+  void WriteMetadata() {
+    for (const auto& [key, value] : std::array<std::pair<std::string, std::string>, 5>{{
+             {"schema_version", "1.0"},
+             {"linear_tolerance", "0.01"},
+             {"angular_tolerance", "0.01"},
+             {"scale_length", "1.0"},
+             {"inertial_to_backend_frame_translation", "{0.0, 0.0, 0.0}"},
+         }}) {
+      metadata_.BindText(1, key);
+      metadata_.BindText(2, value);
+      metadata_.Run();
+    }
+  }
+
+  // Writes every road, with a branch point at each lane end.
+  void WriteRoads() {
+    for (int j = 0; j <= options_.blocks_y; ++j) {
+      for (int i = 0; i < options_.blocks_x; ++i) {
+        WriteRoad(RoadId(i, j, kEast), Node(i, j) + half_size_ * kArmDirections[kEast],
+                  Node(i + 1, j) - half_size_ * kArmDirections[kEast]);
+      }
+    }
+    for (int j = 0; j < options_.blocks_y; ++j) {
+      for (int i = 0; i <= options_.blocks_x; ++i) {
+        WriteRoad(RoadId(i, j, kNorth), Node(i, j) + half_size_ * kArmDirections[kNorth],
+                  Node(i, j + 1) - half_size_ * kArmDirections[kNorth]);
+      }
+    }
+  }
+
+  void WriteIntersections() {
+    for (int j = 0; j <= options_.blocks_y; ++j) {
+      for (int i = 0; i <= options_.blocks_x; ++i) {
+        WriteIntersection(i, j);
+      }
+    }
+  }
+
+  const CityGridStats& stats() const { return stats_; }
+
+ private:
+  Vec2 Node(int i, int j) const { return {i * options_.block_size, j * options_.block_size}; }
+
+  bool HasArm(int i, int j, int arm) const {
+    switch (arm) {
+      case kEast:
+        return i < options_.blocks_x;
+      case kNorth:
+        return j < options_.blocks_y;
+      case kWest:
+        return i > 0;
+      default:
+        return j > 0;
+    }
+  }
+
+  // @returns The ID of the road leaving intersection (i, j) through `arm`.
+  static std::string RoadId(int i, int j, int arm) {
+    switch (arm) {
+      case kEast:
+        return "h_" + std::to_string(i) + "_" + std::to_string(j);
+      case kNorth:
+        return "v_" + std::to_string(i) + "_" + std::to_string(j);
+      case kWest:
+        return "h_" + std::to_string(i - 1) + "_" + std::to_string(j);
+      default:
+        return "v_" + std::to_string(i) + "_" + std::to_string(j - 1);
+    }
+  }
+
+  static std::string LaneId(const std::string& segment_id, int index) {
+    return segment_id + "_l" + std::to_string(index);
+  }
+
+  // @returns The ID of the shared boundary on the right of lane `index` of a road-wide segment.
+  static std::string BoundaryId(const std::string& segment_id, int index) {
+    return segment_id + "_b" + std::to_string(index);
+  }
+
+  // @returns The ID of the branch point at the `end` of `lane_id`, where the lane is on side a.
+  static std::string BranchPointId(const std::string& lane_id, const char* end) { return lane_id + "_" + end; }
+
+  // @returns The lateral offset of the centerline of lane `index` of a road, lanes being numbered right to left.
+  double LaneOffset(int index) const { return (index + 0.5 - options_.lanes_per_direction) * options_.lane_width; }
+
+  // @returns The index of the rightmost (`outer`) or leftmost lane of the road at `arm` travelling towards
+  // (`arriving`) or away from the intersection.
+  int ArmLane(int arm, bool arriving, bool outer) const {
+    const bool forward = arriving != StartsAtIntersection(arm);
+    if (forward) return outer ? 0 : options_.lanes_per_direction - 1;
+    return outer ? num_lanes_ - 1 : options_.lanes_per_direction;
+  }
+
+  // @returns Where the centerline of lane `index` of the road at `arm` of intersection (i, j) meets it.
+  Vec2 ArmLaneEnd(int i, int j, int arm, int index) const {
+    const Vec2& direction = kArmDirections[arm];
+    const Vec2 reference = StartsAtIntersection(arm) ? direction : -1. * direction;
+    return Node(i, j) + half_size_ * direction + LaneOffset(index) * Left(reference);
+  }
+
+  static const char* ArmLaneEndName(int arm) { return StartsAtIntersection(arm) ? "start" : "finish"; }
+
+  double Elevation(const Vec2& p) const {
+    if (options_.elevation == 0.) return 0.;
+    const double k = kPi / (2. * options_.block_size);
+    return options_.elevation * std::sin(k * p.x) * std::sin(k * p.y);
+  }
+
+  // Encodes the polyline at lateral offset `t` of `line` into `out`.
+  void EncodeBoundary(const ReferenceLine& line, double t, std::string* out) {
+    out->clear();
+    const int num_points = options_.points_per_boundary;
+    if (options_.geometry_format == GeometryFormat::kWkt) {
+      out->append("LINESTRINGZ(");
+      for (int k = 0; k < num_points; ++k) {
+        const Vec2 p = line.At(static_cast<double>(k) / (num_points - 1), t);
+        if (k > 0) out->append(", ");
+        AppendCoordinate(p.x, out);
+        out->push_back(' ');
+        AppendCoordinate(p.y, out);
+        out->push_back(' ');
+        AppendCoordinate(Elevation(p), out);
+      }
+      out->push_back(')');
+      return;
+    }
+    points_.clear();
+    for (int k = 0; k < num_points; ++k) {
+      const Vec2 p = line.At(static_cast<double>(k) / (num_points - 1), t);
+      points_.emplace_back(p.x, p.y, Elevation(p));
+    }
+    if (options_.geometry_format == GeometryFormat::kCompact) {
+      AppendCompactLineStringZ(points_, CompactEncoding{}, out);
+    } else {
+      AppendGeoPackageBinaryLineStringZ(points_, out);
+    }
+  }
+
+  void WriteJunction(const std::string& junction_id) {
+    junction_.BindText(1, junction_id);
+    junction_.Run();
+    ++stats_.junctions;
+  }
+
+  void WriteSegment(const std::string& segment_id, const std::string& junction_id) {
+    segment_.BindText(1, segment_id);
+    segment_.BindText(2, junction_id);
+    segment_.Run();
+    ++stats_.segments;
+  }
+
+  void BindGeometry(Statement* statement, int index, const std::string& geometry) const {
+    if (options_.geometry_format == GeometryFormat::kWkt) {
+      statement->BindText(index, geometry);
+    } else {
+      statement->BindBlob(index, geometry);
+    }
+  }
+
+  // Writes the shared boundary at lateral offset `t` of `line`.
+  void WriteBoundary(const std::string& boundary_id, const ReferenceLine& line, double t) {
+    EncodeBoundary(line, t, &left_boundary_);
+    boundary_->BindText(1, boundary_id);
+    BindGeometry(&*boundary_, 2, left_boundary_);
+    boundary_->Run();
+    ++stats_.boundaries;
+  }
+
+  void BindLaneAttributes(const std::string& lane_id, const std::string& segment_id, bool forward) {
+    static const std::string kForward{"forward"};
+    static const std::string kBackward{"backward"};
+    lane_.BindText(1, lane_id);
+    lane_.BindText(2, segment_id);
+    lane_.BindText(3, forward ? kForward : kBackward);
+  }
+
+  // Writes a lane whose centerline is at lateral offset `t` of `line`.
+  void WriteLane(const std::string& lane_id, const std::string& segment_id, bool forward, const ReferenceLine& line,
+                 double t) {
+    EncodeBoundary(line, t + 0.5 * options_.lane_width, &left_boundary_);
+    EncodeBoundary(line, t - 0.5 * options_.lane_width, &right_boundary_);
+    BindLaneAttributes(lane_id, segment_id, forward);
+    BindGeometry(&lane_, 4, left_boundary_);
+    BindGeometry(&lane_, 5, right_boundary_);
+    if (options_.shared_boundaries) {
+      lane_.BindNull(6);
+      lane_.BindNull(7);
+    }
+    lane_.Run();
+    ++stats_.lanes;
+  }
+
+  // Writes a lane referencing the shared boundaries `left_boundary_id` and `right_boundary_id`.
+  void WriteLane(const std::string& lane_id, const std::string& segment_id, bool forward,
+                 const std::string& left_boundary_id, const std::string& right_boundary_id) {
+    BindLaneAttributes(lane_id, segment_id, forward);
+    lane_.BindNull(4);
+    lane_.BindNull(5);
+    lane_.BindText(6, left_boundary_id);
+    lane_.BindText(7, right_boundary_id);
+    lane_.Run();
+    ++stats_.lanes;
+  }
+
+  void WriteBranchPointLane(const std::string& branch_point_id, const std::string& lane_id, const char* side,
+                            const char* end) {
+    branch_point_lane_.BindText(1, branch_point_id);
+    branch_point_lane_.BindText(2, lane_id);
+    const std::string side_str{side};
+    const std::string end_str{end};
+    branch_point_lane_.BindText(3, side_str);
+    branch_point_lane_.BindText(4, end_str);
+    branch_point_lane_.Run();
+    ++stats_.branch_point_lanes;
+  }
+
+  void WriteAdjacentLane(const std::string& lane_id, const std::string& adjacent_lane_id, const char* side) {
+    adjacent_lane_.BindText(1, lane_id);
+    adjacent_lane_.BindText(2, adjacent_lane_id);
+    const std::string side_str{side};
+    adjacent_lane_.BindText(3, side_str);
+    adjacent_lane_.Run();
+    ++stats_.adjacent_lanes;
+  }
+
+  // Writes the lanes of a road-wide segment along `line`, numbered right to left, and their adjacency.
+  void WriteRoadWideSegment(const std::string& segment_id, const std::string& junction_id,
+                            const ReferenceLine& line) {
+    WriteSegment(segment_id, junction_id);
+    if (options_.shared_boundaries) {
+      for (int k = 0; k <= num_lanes_; ++k) {
+        WriteBoundary(BoundaryId(segment_id, k), line, LaneOffset(k) - 0.5 * options_.lane_width);
+      }
+    }
+    for (int k = 0; k < num_lanes_; ++k) {
+      if (options_.shared_boundaries) {
+        WriteLane(LaneId(segment_id, k), segment_id, k < options_.lanes_per_direction, BoundaryId(segment_id, k + 1),
+                  BoundaryId(segment_id, k));
+      } else {
+        WriteLane(LaneId(segment_id, k), segment_id, k < options_.lanes_per_direction, line, LaneOffset(k));
+      }
+      if (k > 0) {
+        WriteAdjacentLane(LaneId(segment_id, k), LaneId(segment_id, k - 1), "right");
+        WriteAdjacentLane(LaneId(segment_id, k - 1), LaneId(segment_id, k), "left");
+      }
+    }
+  }
+
+  void WriteRoad(const std::string& road_id, const Vec2& start, const Vec2& end) {
+    WriteJunction(road_id);
+    const std::string segment_id = road_id + "_s";
+    WriteRoadWideSegment(segment_id, road_id, StraightLine(start, end));
+    for (int k = 0; k < num_lanes_; ++k) {
+      const std::string lane_id = LaneId(segment_id, k);
+      WriteBranchPointLane(BranchPointId(lane_id, "start"), lane_id, "a", "start");
+      WriteBranchPointLane(BranchPointId(lane_id, "finish"), lane_id, "a", "finish");
+    }
+  }
+
+  // @returns The branch point at lane `index` of the road at `arm` of intersection (i, j).
+  std::string ArmBranchPointId(int i, int j, int arm, int index) const {
+    return BranchPointId(LaneId(RoadId(i, j, arm) + "_s", index), ArmLaneEndName(arm));
+  }
+
+  // Writes a segment of straight-through lanes from the road at `from_arm` to the opposite one.
+  void WriteThroughSegment(int i, int j, int from_arm, const std::string& junction_id, const std::string& segment_id) {
+    const int to_arm = (from_arm + 2) % kNumArms;
+    WriteRoadWideSegment(segment_id, junction_id,
+                         StraightLine(Node(i, j) + half_size_ * kArmDirections[from_arm],
+                                      Node(i, j) + half_size_ * kArmDirections[to_arm]));
+    for (int k = 0; k < num_lanes_; ++k) {
+      const std::string lane_id = LaneId(segment_id, k);
+      WriteBranchPointLane(ArmBranchPointId(i, j, from_arm, k), lane_id, "b", "start");
+      WriteBranchPointLane(ArmBranchPointId(i, j, to_arm, k), lane_id, "b", "finish");
+    }
+  }
+
+  // Writes the single-lane segment turning from the road at `from_arm` into the road at `to_arm`.
+  void WriteTurnSegment(int i, int j, int from_arm, int to_arm, const std::string& junction_id) {
+    const bool left_turn = to_arm == (from_arm + 3) % kNumArms;
+    const int from_lane = ArmLane(from_arm, true /* arriving */, !left_turn /* outer */);
+    const int to_lane = ArmLane(to_arm, false /* arriving */, !left_turn /* outer */);
+    const std::string segment_id = junction_id + "_" + kArmNames[from_arm] + kArmNames[to_arm];
+    const std::string lane_id = LaneId(segment_id, 0);
+    WriteSegment(segment_id, junction_id);
+    WriteLane(lane_id, segment_id, true /* forward */,
+              QuarterTurn(ArmLaneEnd(i, j, from_arm, from_lane), -1. * kArmDirections[from_arm],
+                          ArmLaneEnd(i, j, to_arm, to_lane), left_turn),
+              0.);
+    WriteBranchPointLane(ArmBranchPointId(i, j, from_arm, from_lane), lane_id, "b", "start");
+    WriteBranchPointLane(ArmBranchPointId(i, j, to_arm, to_lane), lane_id, "b", "finish");
+  }
+
+  void WriteIntersection(int i, int j) {
+    std::array<bool, kNumArms> arms;
+    for (int arm = 0; arm < kNumArms; ++arm) arms[arm] = HasArm(i, j, arm);
+    const bool through_x = arms[kWest] && arms[kEast];
+    const bool through_y = arms[kSouth] && arms[kNorth];
+    bool any_turn = false;
+    if (options_.intersection_style == IntersectionStyle::kTurns) {
+      for (int arm = 0; arm < kNumArms; ++arm) {
+        any_turn |= arms[arm] && (arms[(arm + 1) % kNumArms] || arms[(arm + 3) % kNumArms]);
+      }
+    }
+    if (!through_x && !through_y && !any_turn) return;
+
+    const std::string junction_id = "x_" + std::to_string(i) + "_" + std::to_string(j);
+    WriteJunction(junction_id);
+    if (through_x) WriteThroughSegment(i, j, kWest, junction_id, junction_id + "_h");
+    if (through_y) WriteThroughSegment(i, j, kSouth, junction_id, junction_id + "_v");
+    if (!any_turn) return;
+    for (int arm = 0; arm < kNumArms; ++arm) {
+      if (!arms[arm]) continue;
+      // Arriving from `arm`, the road to the right is the next arm counter-clockwise.
+      const int right_arm = (arm + 1) % kNumArms;
+      const int left_arm = (arm + 3) % kNumArms;
+      if (arms[right_arm]) WriteTurnSegment(i, j, arm, right_arm, junction_id);
+      if (arms[left_arm]) WriteTurnSegment(i, j, arm, left_arm, junction_id);
+    }
+  }
+
+  const CityGridOptions options_;
+  const int num_lanes_;
+  const double half_size_;
+  Statement metadata_;
+  Statement junction_;
+  Statement segment_;
+  Statement lane_;
+  Statement branch_point_lane_;
+  Statement adjacent_lane_;
+  std::optional<Statement> boundary_;
+  // Encoding buffers, reused across lanes.
+  std::string left_boundary_;
+  std::string right_boundary_;
+  std::vector<maliput::math::Vector3> points_;
+  CityGridStats stats_;
+};
+
+void ValidateOptions(const CityGridOptions& options) {
+  if (options.blocks_x < 1 || options.blocks_y < 1) {
+    throw std::runtime_error("A city grid needs at least one block along each axis.");
+  }
+  if (options.lanes_per_direction < 1) {
+    throw std::runtime_error("A city grid needs at least one lane per direction.");
+  }
+  if (options.points_per_boundary < 2) {
+    throw std::runtime_error("Lane boundaries need at least 2 points.");
+  }
+  if (!(options.lane_width > 0.)) {
+    throw std::runtime_error("The lane width must be positive.");
+  }
+  // Intersections span the road width plus one lane width on each side.
+  const double intersection_size = 2. * (options.lanes_per_direction + 1) * options.lane_width;
+  if (!(options.block_size > intersection_size)) {
+    throw std::runtime_error("The block size must exceed the intersection size of " +
+                             std::to_string(intersection_size) + " m.");
+  }
+}
+
+}  // namespace
+
+CityGridStats GenerateCityGrid(const CityGridOptions& options, const std::string& path) {
+  ValidateOptions(options);
+
+  // Write under a temporary name so an interrupted run does not leave a truncated GeoPackage behind.
+  const std::string tmp_path = path + ".tmp";
+  std::filesystem::remove(tmp_path);
+  sqlite3* db = nullptr;
+  if (sqlite3_open_v2(tmp_path.c_str(), &db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr) != SQLITE_OK) {
+    const std::string message = db != nullptr ? sqlite3_errmsg(db) : "out of memory";
+    sqlite3_close(db);
+    throw std::runtime_error("Failed to create GeoPackage '" + tmp_path + "': " + message);
+  }
+
+  CityGridStats stats;
+  try {
+    Execute(db, kPragmas);
+    Execute(db, kSchema);
+    Execute(db, options.shared_boundaries ? kSharedBoundaryLaneSchema : kLaneSchema);
+    Execute(db, "BEGIN");
+    {
+      CityGridWriter writer(options, db);
+      writer.WriteMetadata();
+      writer.WriteRoads();
+      writer.WriteIntersections();
+      stats = writer.stats();
+    }
+    Execute(db, kIndexes);
+    Execute(db, "COMMIT");
+    if (options.build_spatial_index) {
+      geopackage::BuildLaneSpatialIndex(db);
+    }
+  } catch (...) {
+    sqlite3_close(db);
+    std::filesystem::remove(tmp_path);
+    throw;
+  }
+  sqlite3_close(db);
+  std::filesystem::rename(tmp_path, path);
+  return stats;
+}
+
+IntersectionStyle IntersectionStyleFromString(const std::string& name) {
+  if (name == "straight") return IntersectionStyle::kStraight;
+  if (name == "turns") return IntersectionStyle::kTurns;
+  throw std::runtime_error("Unknown intersection style '" + name + "', expected 'straight' or 'turns'.");
+}
+
+GeometryFormat GeometryFormatFromString(const std::string& name) {
+  if (name == "wkt") return GeometryFormat::kWkt;
+  if (name == "gpb") return GeometryFormat::kGeoPackageBinary;
+  if (name == "compact") return GeometryFormat::kCompact;
+  throw std::runtime_error("Unknown geometry format '" + name + "', expected 'wkt', 'gpb' or 'compact'.");
+}
+
+}  // namespace tools
+}  // namespace maliput_geopackage
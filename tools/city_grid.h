@@ -0,0 +1,124 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace maliput_geopackage {
+namespace tools {
+
+/// How intersections connect the roads meeting at them.
+enum class IntersectionStyle {
+  /// Only straight-through lanes, one segment per crossing direction.
+  kStraight,
+  /// Straight-through lanes, plus a right turn from the rightmost lane and a left turn from the leftmost lane
+  /// of every approach, each in its own segment.
+  kTurns,
+};
+
+/// Encoding of the lane boundaries.
+enum class GeometryFormat {
+  /// WKT `LINESTRINGZ` text.
+  kWkt,
+  /// GeoPackage binary blobs (GPB header followed by little-endian WKB).
+  kGeoPackageBinary,
+  /// Compact blobs of millimetre-quantized varint deltas, see AppendCompactLineStringZ().
+  kCompact,
+};
+
+/// Parameters of a city grid, see GenerateCityGrid().
+struct CityGridOptions {
+  /// Number of blocks along the x axis.
+  int blocks_x{10};
+  /// Number of blocks along the y axis.
+  int blocks_y{10};
+  /// Number of lanes per travel direction; every road carries twice as many.
+  int lanes_per_direction{1};
+  /// Number of points of every lane boundary. Must be at least 2.
+  int points_per_boundary{11};
+  /// How intersections connect the roads.
+  IntersectionStyle intersection_style{IntersectionStyle::kTurns};
+  /// Amplitude of the terrain elevation, in meters. Zero yields a flat city.
+  double elevation{0.};
+  /// Distance between consecutive intersections, in meters.
+  double block_size{100.};
+  /// Width of every lane, in meters.
+  double lane_width{3.5};
+  /// Encoding of the lane boundaries.
+  GeometryFormat geometry_format{GeometryFormat::kWkt};
+  /// Whether to add the `rtree_lanes` spatial index.
+  bool build_spatial_index{false};
+  /// Whether neighbouring lanes of a segment reference a single row of the `boundaries` table for the boundary they
+  /// share, instead of each storing it. Turning lanes keep their own boundaries.
+  bool shared_boundaries{false};
+};
+
+/// Version of the maps written by GenerateCityGrid(). Bump it whenever their content changes, so maps cached
+/// by an older generator are not reused.
+constexpr int kCityGridVersion{1};
+
+/// Number of rows written by GenerateCityGrid().
+struct CityGridStats {
+  int64_t junctions{0};
+  int64_t segments{0};
+  int64_t lanes{0};
+  int64_t branch_point_lanes{0};
+  int64_t adjacent_lanes{0};
+  int64_t boundaries{0};
+};
+
+/// Writes a GeoPackage holding a grid city to `path`, replacing any existing file.
+///
+/// Intersections sit on a regular grid, @ref CityGridOptions::block_size apart, and every pair of neighbouring
+/// intersections is linked by a two-way road. Each road is a junction holding a single segment whose lanes run
+/// along +x or +y; lanes to the right of the reference line travel forward and lanes to its left travel backward.
+/// Each intersection is a junction holding its connecting lanes, see @ref IntersectionStyle. Branch points join
+/// every road lane end to the connecting lanes touching it, and lanes sharing a segment are adjacent.
+///
+/// With a non-zero @ref CityGridOptions::elevation, the terrain is a smooth pattern of hills with a period of four
+/// blocks, so lanes meeting at a branch point share their elevation.
+///
+/// Rows are inserted through prepared statements in a single transaction with journaling disabled, and the
+/// file is written under a temporary name and renamed once complete.
+///
+/// @throws std::runtime_error if `options` are invalid or the file cannot be written.
+CityGridStats GenerateCityGrid(const CityGridOptions& options, const std::string& path);
+
+/// @returns The IntersectionStyle called `name`: "straight" or "turns".
+/// @throws std::runtime_error if `name` is unknown.
+IntersectionStyle IntersectionStyleFromString(const std::string& name);
+
+/// @returns The GeometryFormat called `name`: "wkt", "gpb" or "compact".
+/// @throws std::runtime_error if `name` is unknown.
+GeometryFormat GeometryFormatFromString(const std::string& name);
+
+}  // namespace tools
+}  // namespace maliput_geopackage
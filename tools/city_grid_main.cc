@@ -0,0 +1,151 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @file city_grid_main.cc
+///
+/// Generates a synthetic grid city GeoPackage, for stress-testing loading, memory usage and queries on
+/// production-sized maps.
+///
+/// Usage:
+///   maliput_gpkg_city_grid [options] <output.gpkg>
+///
+/// Example:
+///   maliput_gpkg_city_grid --blocks 200x200 --lanes-per-direction 2 --geometry gpb city.gpkg
+
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+#include "tools/city_grid.h"
+
+namespace {
+
+using maliput_geopackage::tools::CityGridOptions;
+
+void PrintUsage(const char* program) {
+  const CityGridOptions defaults;
+  std::cout << "Usage: " << program << " [options] <output.gpkg>\n"
+            << "\n"
+            << "Options:\n"
+            << "  --blocks <N | NxM>             Blocks along x and y (default: " << defaults.blocks_x << "x"
+            << defaults.blocks_y << ").\n"
+            << "  --lanes-per-direction <N>      Lanes per travel direction of every road (default: "
+            << defaults.lanes_per_direction << ").\n"
+            << "  --points-per-boundary <N>      Points of every lane boundary (default: "
+            << defaults.points_per_boundary << ").\n"
+            << "  --intersections <style>        'straight' or 'turns' (default: turns).\n"
+            << "  --elevation <meters>           Amplitude of the terrain hills (default: flat).\n"
+            << "  --block-size <meters>          Distance between intersections (default: " << defaults.block_size
+            << ").\n"
+            << "  --lane-width <meters>          Width of every lane (default: " << defaults.lane_width << ").\n"
+            << "  --geometry <format>            'wkt', 'gpb' or 'compact' boundaries (default: wkt).\n"
+            << "  --spatial-index                Add the rtree_lanes spatial index.\n"
+            << "  --shared-boundaries            Store boundaries shared by neighbouring lanes once.\n"
+            << "  -h, --help                     Show this message.\n";
+}
+
+void ParseBlocks(const std::string& value, CityGridOptions* options) {
+  const size_t x = value.find('x');
+  options->blocks_x = std::stoi(value.substr(0, x));
+  options->blocks_y = x == std::string::npos ? options->blocks_x : std::stoi(value.substr(x + 1));
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  CityGridOptions options;
+  std::string output_path;
+  try {
+    for (int i = 1; i < argc; ++i) {
+      const std::string arg = argv[i];
+      if (arg == "-h" || arg == "--help") {
+        PrintUsage(argv[0]);
+        return 0;
+      }
+      if (arg == "--spatial-index") {
+        options.build_spatial_index = true;
+        continue;
+      }
+      if (arg == "--shared-boundaries") {
+        options.shared_boundaries = true;
+        continue;
+      }
+      if (arg.rfind("--", 0) == 0) {
+        if (i + 1 >= argc) throw std::runtime_error("Missing value for " + arg);
+        const std::string value = argv[++i];
+        if (arg == "--blocks") {
+          ParseBlocks(value, &options);
+        } else if (arg == "--lanes-per-direction") {
+          options.lanes_per_direction = std::stoi(value);
+        } else if (arg == "--points-per-boundary") {
+          options.points_per_boundary = std::stoi(value);
+        } else if (arg == "--intersections") {
+          options.intersection_style = maliput_geopackage::tools::IntersectionStyleFromString(value);
+        } else if (arg == "--elevation") {
+          options.elevation = std::stod(value);
+        } else if (arg == "--block-size") {
+          options.block_size = std::stod(value);
+        } else if (arg == "--lane-width") {
+          options.lane_width = std::stod(value);
+        } else if (arg == "--geometry") {
+          options.geometry_format = maliput_geopackage::tools::GeometryFormatFromString(value);
+        } else {
+          throw std::runtime_error("Unknown option " + arg);
+        }
+        continue;
+      }
+      if (!output_path.empty()) throw std::runtime_error("More than one output path given.");
+      output_path = arg;
+    }
+    if (output_path.empty()) {
+      PrintUsage(argv[0]);
+      return 1;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto stats = maliput_geopackage::tools::GenerateCityGrid(options, output_path);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "Wrote " << output_path << " (" << std::filesystem::file_size(output_path) / (1024. * 1024.)
+              << " MiB) in " << elapsed.count() << " s:\n"
+              << "  junctions:          " << stats.junctions << "\n"
+              << "  segments:           " << stats.segments << "\n"
+              << "  lanes:              " << stats.lanes << "\n"
+              << "  branch_point_lanes: " << stats.branch_point_lanes << "\n"
+              << "  adjacent_lanes:     " << stats.adjacent_lanes << "\n"
+              << "  boundaries:         " << stats.boundaries << std::endl;
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,136 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "tools/geometry_encoding.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include "maliput_geopackage/geopackage/compact_parser.h"
+
+namespace maliput_geopackage {
+namespace tools {
+namespace {
+
+// Appends the little-endian encoding of `value` to `out`.
+void AppendUint32(uint32_t value, std::string* out) {
+  char bytes[4];
+  for (int i = 0; i < 4; ++i) bytes[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+  out->append(bytes, sizeof(bytes));
+}
+void AppendDouble(double value, std::string* out) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  char bytes[8];
+  for (int i = 0; i < 8; ++i) bytes[i] = static_cast<char>((bits >> (8 * i)) & 0xff);
+  out->append(bytes, sizeof(bytes));
+}
+
+// Appends the zig-zag LEB128 varint encoding of `value` to `out`.
+void AppendVarint(int32_t value, std::string* out) {
+  uint32_t zigzag = (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+  while (zigzag >= 0x80) {
+    out->push_back(static_cast<char>((zigzag & 0x7f) | 0x80));
+    zigzag >>= 7;
+  }
+  out->push_back(static_cast<char>(zigzag));
+}
+
+}  // namespace
+
+void AppendGeoPackageBinaryLineStringZ(const std::vector<maliput::math::Vector3>& points, std::string* out) {
+  out->reserve(out->size() + 17 + 24 * points.size());
+  // GeoPackage binary header: magic, version 0, little-endian without envelope, SRS ID 0.
+  out->append("GP");
+  out->push_back('\x00');
+  out->push_back('\x01');
+  AppendUint32(0, out);
+  // Little-endian ISO WKB LineString Z.
+  out->push_back('\x01');
+  AppendUint32(1002, out);
+  AppendUint32(static_cast<uint32_t>(points.size()), out);
+  for (const auto& point : points) {
+    AppendDouble(point.x(), out);
+    AppendDouble(point.y(), out);
+    AppendDouble(point.z(), out);
+  }
+}
+
+void AppendCompactLineStringZ(const std::vector<maliput::math::Vector3>& points, const CompactEncoding& encoding,
+                              std::string* out) {
+  if (!std::isfinite(encoding.scale) || encoding.scale <= 0.) {
+    throw std::runtime_error("Compact geometry scale must be positive and finite, got " +
+                             std::to_string(encoding.scale));
+  }
+  const maliput::math::Vector3 origin = points.empty() ? maliput::math::Vector3(0., 0., 0.) : points.front();
+  // Quantized positions, one axis after the other, as the format lays out its deltas.
+  const size_t n = points.size();
+  std::vector<int32_t> quantized(3 * n);
+  for (size_t i = 0; i < n; ++i) {
+    for (int axis = 0; axis < 3; ++axis) {
+      const double q = std::round((points[i][axis] - origin[axis]) / encoding.scale);
+      if (!(std::abs(q) <= static_cast<double>(std::numeric_limits<int32_t>::max()))) {
+        throw std::runtime_error("Point " + std::to_string(i) +
+                                 " is too far from the origin to be quantized with scale " +
+                                 std::to_string(encoding.scale));
+      }
+      quantized[axis * n + i] = static_cast<int32_t>(q);
+    }
+  }
+
+  out->reserve(out->size() + geopackage::kCompactLineStringHeaderSize + (encoding.varint ? 2 : 4) * 3 * n);
+  out->append("MQ");
+  out->push_back('\x00');
+  out->push_back(static_cast<char>(encoding.varint ? geopackage::kCompactVarintFlag : 0));
+  AppendUint32(static_cast<uint32_t>(n), out);
+  AppendDouble(origin.x(), out);
+  AppendDouble(origin.y(), out);
+  AppendDouble(origin.z(), out);
+  AppendDouble(encoding.scale, out);
+  for (int axis = 0; axis < 3; ++axis) {
+    uint32_t previous{0};
+    for (size_t i = 0; i < n; ++i) {
+      // Differences wrap modulo 2^32, as the decoder accumulates them.
+      const uint32_t current = static_cast<uint32_t>(quantized[axis * n + i]);
+      const int32_t delta = static_cast<int32_t>(current - previous);
+      previous = current;
+      if (encoding.varint) {
+        AppendVarint(delta, out);
+      } else {
+        AppendUint32(static_cast<uint32_t>(delta), out);
+      }
+    }
+  }
+}
+
+}  // namespace tools
+}  // namespace maliput_geopackage
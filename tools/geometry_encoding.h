@@ -0,0 +1,61 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <maliput/math/vector.h>
+
+namespace maliput_geopackage {
+namespace tools {
+
+/// Appends to `out` the GeoPackage binary encoding of the LINESTRINGZ through `points`: a GPB header
+/// without envelope and with SRS ID 0, followed by little-endian ISO WKB. This is the format
+/// geopackage::ParseGeoPackageBinaryLineStringZ() reads.
+void AppendGeoPackageBinaryLineStringZ(const std::vector<maliput::math::Vector3>& points, std::string* out);
+
+/// Parameters of the compact LINESTRINGZ encoding, see geopackage::ParseCompactLineStringZ().
+struct CompactEncoding {
+  /// Quantization step, in meters. Every coordinate is rounded to the nearest multiple of it.
+  double scale{1e-3};
+  /// Whether deltas are stored as zig-zag varints, usually 1 to 3 bytes each, rather than as 4-byte int32 values.
+  bool varint{true};
+};
+
+/// Appends to `out` the compact encoding of the LINESTRINGZ through `points`, with the first point as origin.
+///
+/// @throws std::runtime_error if `encoding.scale` is not positive and finite, or if a point lies so far from the
+///         first one that its quantized coordinates do not fit an int32.
+void AppendCompactLineStringZ(const std::vector<maliput::math::Vector3>& points, const CompactEncoding& encoding,
+                              std::string* out);
+
+}  // namespace tools
+}  // namespace maliput_geopackage
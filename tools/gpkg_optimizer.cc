@@ -0,0 +1,398 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "tools/gpkg_optimizer.h"
+
+#include <sqlite3.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <maliput/math/vector.h>
+
+#include "maliput_geopackage/geopackage/geopackage_parser.h"
+#include "maliput_geopackage/geopackage/lane_decoder.h"
+#include "maliput_geopackage/geopackage/spatial_index.h"
+#include "maliput_geopackage/geopackage/sqlite_helpers.h"
+#include "tools/geometry_encoding.h"
+#include "tools/sqlite_statement.h"
+
+namespace maliput_geopackage {
+namespace tools {
+namespace {
+
+using geopackage::CountRows;
+using geopackage::Execute;
+using geopackage::HasColumns;
+using geopackage::HasTable;
+
+// Tables every maliput GeoPackage holds.
+constexpr const char* kRequiredTables[] = {"junctions", "segments", "lanes"};
+
+// Lookup indexes used when loading whole or partial maps, on tables that may be missing.
+struct IndexDefinition {
+  const char* table;
+  const char* sql;
+};
+constexpr IndexDefinition kIndexes[] = {
+    {"segments", "CREATE INDEX IF NOT EXISTS idx_segments_junction ON segments(junction_id)"},
+    {"lanes", "CREATE INDEX IF NOT EXISTS idx_lanes_segment ON lanes(segment_id)"},
+    {"branch_point_lanes", "CREATE INDEX IF NOT EXISTS idx_branch_point_lanes_bp ON branch_point_lanes(branch_point_id)"},
+    {"branch_point_lanes", "CREATE INDEX IF NOT EXISTS idx_branch_point_lanes_lane ON branch_point_lanes(lane_id)"},
+    {"adjacent_lanes", "CREATE INDEX IF NOT EXISTS idx_adjacent_lanes_lane ON adjacent_lanes(lane_id)"},
+    {"adjacent_lanes", "CREATE INDEX IF NOT EXISTS idx_adjacent_lanes_adjacent ON adjacent_lanes(adjacent_lane_id)"},
+};
+
+// Geometry columns converted to GeoPackage binary geometries, in tables or columns that may be missing.
+struct GeometryColumn {
+  const char* table;
+  const char* column;
+};
+constexpr GeometryColumn kGeometryColumns[] = {
+    {"lanes", "left_boundary"},
+    {"lanes", "right_boundary"},
+    {"lanes", "centerline"},
+    {"boundaries", "geometry"},
+};
+
+sqlite3* OpenDatabase(const std::string& path, int flags) {
+  sqlite3* db = nullptr;
+  if (sqlite3_open_v2(path.c_str(), &db, flags, nullptr) != SQLITE_OK) {
+    const std::string message = db != nullptr ? sqlite3_errmsg(db) : "out of memory";
+    sqlite3_close(db);
+    throw std::runtime_error("Failed to open GeoPackage '" + path + "': " + message);
+  }
+  return db;
+}
+
+// Closes the database on scope exit.
+class DatabaseCloser {
+ public:
+  explicit DatabaseCloser(sqlite3* db) : db_(db) {}
+  ~DatabaseCloser() { sqlite3_close(db_); }
+  DatabaseCloser(const DatabaseCloser&) = delete;
+  DatabaseCloser& operator=(const DatabaseCloser&) = delete;
+
+ private:
+  sqlite3* db_;
+};
+
+bool IsValidPageSize(int page_size) {
+  return page_size >= 512 && page_size <= 65536 && (page_size & (page_size - 1)) == 0;
+}
+
+// @returns The wall time of a full load of the GeoPackage at `path`, in seconds.
+double TimeLoad(const std::string& path) {
+  const auto start = std::chrono::steady_clock::now();
+  { geopackage::GeoPackageParser parser(path); }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+// State of the gpkg_encode_linestringz() SQL function: the target encoding, point buffers reused across calls and
+// the largest distance between a point and its compact encoding so far.
+struct GeometryEncoder {
+  double compact_scale{0.};
+  std::vector<maliput::math::Vector3> points;
+  std::vector<maliput::math::Vector3> decoded_points;
+  double max_quantization_error{0.};
+};
+
+// SQL function gpkg_encode_linestringz(geometry): `geometry`, a LINESTRINGZ in any format the loader reads,
+// re-encoded as a GeoPackage binary geometry or, with a positive compact scale, as a compact geometry.
+void EncodeLineStringZ(sqlite3_context* context, int, sqlite3_value** argv) {
+  auto* encoder = static_cast<GeometryEncoder*>(sqlite3_user_data(context));
+  const bool is_blob = sqlite3_value_type(argv[0]) == SQLITE_BLOB;
+  const void* data = is_blob ? sqlite3_value_blob(argv[0]) : static_cast<const void*>(sqlite3_value_text(argv[0]));
+  try {
+    encoder->points.clear();
+    geopackage::DecodeLineStringZ(static_cast<const uint8_t*>(data), static_cast<size_t>(sqlite3_value_bytes(argv[0])),
+                                  is_blob, &encoder->points);
+    std::string blob;
+    if (encoder->compact_scale > 0.) {
+      AppendCompactLineStringZ(encoder->points, CompactEncoding{encoder->compact_scale, true}, &blob);
+      // Measured on the decoded points, as the loader will see them.
+      encoder->decoded_points.clear();
+      geopackage::DecodeLineStringZ(reinterpret_cast<const uint8_t*>(blob.data()), blob.size(), true,
+                                    &encoder->decoded_points);
+      for (size_t i = 0; i < encoder->points.size(); ++i) {
+        encoder->max_quantization_error =
+            std::max(encoder->max_quantization_error, (encoder->decoded_points[i] - encoder->points[i]).norm());
+      }
+    } else {
+      AppendGeoPackageBinaryLineStringZ(encoder->points, &blob);
+    }
+    sqlite3_result_blob(context, blob.data(), static_cast<int>(blob.size()), SQLITE_TRANSIENT);
+  } catch (const std::exception& e) {
+    sqlite3_result_error(context, e.what(), -1);
+  }
+}
+
+// Rewrites every WKT boundary as a GeoPackage binary geometry or, with a positive `compact_scale`, every boundary
+// not compact yet as a compact geometry, setting `max_quantization_error` to the largest distance a point moved.
+// @returns The number of values converted.
+int64_t ConvertBoundaries(sqlite3* db, double compact_scale, double* max_quantization_error) {
+  GeometryEncoder encoder{compact_scale, {}, {}, 0.};
+  if (sqlite3_create_function(db, "gpkg_encode_linestringz", 1, SQLITE_UTF8 | SQLITE_DETERMINISTIC, &encoder,
+                              &EncodeLineStringZ, nullptr, nullptr) != SQLITE_OK) {
+    throw std::runtime_error(std::string("Failed to register the geometry conversion function: ") +
+                             sqlite3_errmsg(db));
+  }
+  int64_t converted = 0;
+  try {
+    for (const auto& [table, column] : kGeometryColumns) {
+      if (!HasTable(db, table) || !HasColumns(db, table, {column})) continue;
+      const std::string name(column);
+      // Compact geometries start with the "MQ" magic.
+      const std::string filter = compact_scale > 0.
+                                     ? "typeof(" + name + ") = 'text' OR (typeof(" + name + ") = 'blob' AND substr(" +
+                                           name + ", 1, 2) != X'4D51')"
+                                     : "typeof(" + name + ") = 'text'";
+      Execute(db, std::string("UPDATE ") + table + " SET " + name + " = gpkg_encode_linestringz(" + name +
+                      ") WHERE " + filter);
+      converted += sqlite3_changes(db);
+    }
+  } catch (...) {
+    sqlite3_create_function(db, "gpkg_encode_linestringz", 1, SQLITE_UTF8, nullptr, nullptr, nullptr, nullptr);
+    throw;
+  }
+  // Unregister the function before `encoder` goes out of scope.
+  sqlite3_create_function(db, "gpkg_encode_linestringz", 1, SQLITE_UTF8, nullptr, nullptr, nullptr, nullptr);
+  *max_quantization_error = encoder.max_quantization_error;
+  return converted;
+}
+
+// Adds the bbox_* columns to the lanes table if missing and fills them with the extent of both boundaries.
+void WriteLaneExtents(sqlite3* db) {
+  for (const char* column : {"bbox_min_x", "bbox_max_x", "bbox_min_y", "bbox_max_y"}) {
+    if (!HasColumns(db, "lanes", {column})) {
+      Execute(db, std::string("ALTER TABLE lanes ADD COLUMN ") + column + " REAL");
+    }
+  }
+  // Extents are collected first, as the lanes table cannot be updated while it is being read.
+  std::vector<std::pair<std::string, geopackage::LaneExtent>> extents;
+  geopackage::ForEachLaneExtent(db, [&extents](const std::string& lane_id, const geopackage::LaneExtent& extent) {
+    extents.emplace_back(lane_id, extent);
+  });
+  Statement update(db,
+                   "UPDATE lanes SET bbox_min_x = ?2, bbox_max_x = ?3, bbox_min_y = ?4, bbox_max_y = ?5 "
+                   "WHERE lane_id = ?1");
+  for (const auto& [lane_id, extent] : extents) {
+    update.BindText(1, lane_id);
+    update.BindDouble(2, extent.min_x);
+    update.BindDouble(3, extent.max_x);
+    update.BindDouble(4, extent.min_y);
+    update.BindDouble(5, extent.max_y);
+    update.Run();
+  }
+}
+
+// Adds the lane_index column to the lanes table if missing and numbers the lanes of every segment from right to
+// left, following the chain of left neighbours in adjacent_lanes from the lane without a right neighbour.
+//
+// GeoPackageParser derives the adjacency of whole maps from that numbering, so a segment is only numbered when
+// its adjacency is exactly that chain: each lane has the next one on its left and the previous one on its right,
+// and nothing else. Other segments get NULL, which makes the parser fall back to adjacent_lanes.
+void WriteLaneIndices(sqlite3* db) {
+  if (!HasColumns(db, "lanes", {"lane_index"})) {
+    Execute(db, "ALTER TABLE lanes ADD COLUMN lane_index INTEGER");
+  }
+
+  std::unordered_map<std::string, std::vector<std::string>> segment_lanes;
+  {
+    Statement lanes(db, "SELECT lane_id, segment_id FROM lanes WHERE lane_id IS NOT NULL ORDER BY rowid");
+    while (lanes.Step()) {
+      segment_lanes[lanes.ColumnText(1)].push_back(lanes.ColumnText(0));
+    }
+  }
+
+  // As in the parser, the last row wins when a lane lists several neighbours on one side.
+  std::unordered_map<std::string, std::string> left_lanes;
+  std::unordered_map<std::string, std::string> right_lanes;
+  if (HasTable(db, "adjacent_lanes")) {
+    Statement adjacent(db, "SELECT lane_id, adjacent_lane_id, side FROM adjacent_lanes ORDER BY rowid");
+    while (adjacent.Step()) {
+      const std::string side = adjacent.ColumnText(2);
+      if (side == "left") {
+        left_lanes[adjacent.ColumnText(0)] = adjacent.ColumnText(1);
+      } else if (side == "right") {
+        right_lanes[adjacent.ColumnText(0)] = adjacent.ColumnText(1);
+      }
+    }
+  }
+  // @returns The `side` neighbour of `lane_id`, or nullptr when it has none.
+  const auto neighbour = [](const std::unordered_map<std::string, std::string>& side, const std::string& lane_id) {
+    const auto it = side.find(lane_id);
+    return it != side.end() ? &it->second : nullptr;
+  };
+
+  Statement update(db, "UPDATE lanes SET lane_index = ?2 WHERE lane_id = ?1");
+  std::vector<std::string> ordered_lanes;
+  for (const auto& [segment_id, lanes] : segment_lanes) {
+    ordered_lanes.clear();
+    const auto rightmost = std::find_if(lanes.begin(), lanes.end(), [&](const std::string& lane_id) {
+      return neighbour(right_lanes, lane_id) == nullptr;
+    });
+    // The length bound stops on cyclic adjacency.
+    for (const std::string* current = rightmost != lanes.end() ? &*rightmost : nullptr;
+         current != nullptr && ordered_lanes.size() <= lanes.size(); current = neighbour(left_lanes, *current)) {
+      ordered_lanes.push_back(*current);
+    }
+    bool exact = ordered_lanes.size() == lanes.size() &&
+                 std::is_permutation(ordered_lanes.begin(), ordered_lanes.end(), lanes.begin());
+    for (size_t i = 0; exact && i < ordered_lanes.size(); ++i) {
+      const std::string* right = neighbour(right_lanes, ordered_lanes[i]);
+      exact = i == 0 ? right == nullptr : right != nullptr && *right == ordered_lanes[i - 1];
+    }
+    for (size_t i = 0; i < lanes.size(); ++i) {
+      update.BindText(1, exact ? ordered_lanes[i] : lanes[i]);
+      if (exact) {
+        update.BindInt64(2, static_cast<int64_t>(i));
+      } else {
+        update.BindNull(2);
+      }
+      update.Run();
+    }
+  }
+}
+
+// Stores the row count of every table in maliput_metadata and in `report`.
+void WriteRowCounts(sqlite3* db, OptimizeReport* report) {
+  const auto count = [db](const char* table) { return HasTable(db, table) ? CountRows(db, table) : int64_t{0}; };
+  report->junctions = count("junctions");
+  report->segments = count("segments");
+  report->lanes = count("lanes");
+  report->branch_point_lanes = count("branch_point_lanes");
+  report->adjacent_lanes = count("adjacent_lanes");
+
+  Execute(db, "CREATE TABLE IF NOT EXISTS maliput_metadata (key TEXT PRIMARY KEY, value TEXT NOT NULL)");
+  Statement upsert(db, "INSERT OR REPLACE INTO maliput_metadata (key, value) VALUES (?1, ?2)");
+  for (const auto& [key, value] : {std::make_pair("num_junctions", report->junctions),
+                                   std::make_pair("num_segments", report->segments),
+                                   std::make_pair("num_lanes", report->lanes),
+                                   std::make_pair("num_branch_point_lanes", report->branch_point_lanes),
+                                   std::make_pair("num_adjacent_lanes", report->adjacent_lanes)}) {
+    const std::string key_text{key};
+    const std::string value_text = std::to_string(value);
+    upsert.BindText(1, key_text);
+    upsert.BindText(2, value_text);
+    upsert.Run();
+  }
+}
+
+// Copies the GeoPackage at `input_path` to `output_path`, which must not exist.
+void CopyDatabase(const std::string& input_path, const std::string& output_path) {
+  sqlite3* db = OpenDatabase(input_path, SQLITE_OPEN_READONLY);
+  DatabaseCloser closer(db);
+  for (const char* table : kRequiredTables) {
+    if (!HasTable(db, table)) {
+      throw std::runtime_error("'" + input_path + "' is not a maliput GeoPackage: the " + table +
+                               " table is missing.");
+    }
+  }
+  Statement vacuum(db, "VACUUM INTO ?1");
+  vacuum.BindText(1, output_path);
+  vacuum.Run();
+}
+
+}  // namespace
+
+OptimizeReport OptimizeGeoPackage(const std::string& input_path, const std::string& output_path,
+                                  const OptimizeOptions& options) {
+  if (!IsValidPageSize(options.page_size)) {
+    throw std::runtime_error("The page size must be a power of two between 512 and 65536, got " +
+                             std::to_string(options.page_size) + ".");
+  }
+  if (!std::isfinite(options.compact_scale) || options.compact_scale < 0.) {
+    throw std::runtime_error("The compact geometry scale must be zero or positive, got " +
+                             std::to_string(options.compact_scale) + ".");
+  }
+  if (!std::filesystem::is_regular_file(input_path)) {
+    throw std::runtime_error("GeoPackage '" + input_path + "' does not exist.");
+  }
+
+  OptimizeReport report;
+  report.input_bytes = static_cast<int64_t>(std::filesystem::file_size(input_path));
+  if (options.measure_load_time) report.input_load_seconds = TimeLoad(input_path);
+
+  // Write under a temporary name, so an interrupted run leaves neither a truncated output nor a modified input.
+  const std::string tmp_path = output_path + ".tmp";
+  std::filesystem::remove(tmp_path);
+  try {
+    CopyDatabase(input_path, tmp_path);
+    sqlite3* db = OpenDatabase(tmp_path, SQLITE_OPEN_READWRITE);
+    DatabaseCloser closer(db);
+    // The copy is discarded on failure, so it does not need to survive a crash.
+    Execute(db,
+            "PRAGMA journal_mode = MEMORY;"
+            "PRAGMA synchronous = OFF;"
+            "PRAGMA temp_store = MEMORY;"
+            "PRAGMA cache_size = -262144;");
+
+    Execute(db, "BEGIN");
+    report.geometries_converted = ConvertBoundaries(db, options.compact_scale, &report.max_quantization_error);
+    WriteLaneExtents(db);
+    for (const auto& index : kIndexes) {
+      if (HasTable(db, index.table)) Execute(db, index.sql);
+    }
+    WriteLaneIndices(db);
+    Execute(db, "CREATE INDEX IF NOT EXISTS idx_lanes_segment_index ON lanes(segment_id, lane_index)");
+    WriteRowCounts(db, &report);
+    Execute(db, std::string("DROP TABLE IF EXISTS ") + geopackage::kLaneSpatialIndexTable);
+    Execute(db, "COMMIT");
+
+    // Rebuilt rather than kept, since the input index may be stale.
+    geopackage::BuildLaneSpatialIndex(db);
+
+    // The page size only changes on VACUUM, and not in WAL mode.
+    Execute(db, "ANALYZE");
+    Execute(db, "PRAGMA journal_mode = DELETE");
+    Execute(db, "PRAGMA page_size = " + std::to_string(options.page_size));
+    Execute(db, "VACUUM");
+  } catch (...) {
+    std::filesystem::remove(tmp_path);
+    throw;
+  }
+  std::filesystem::rename(tmp_path, output_path);
+
+  report.output_bytes = static_cast<int64_t>(std::filesystem::file_size(output_path));
+  if (options.measure_load_time) report.output_load_seconds = TimeLoad(output_path);
+  return report;
+}
+
+}  // namespace tools
+}  // namespace maliput_geopackage
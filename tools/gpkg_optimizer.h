@@ -0,0 +1,97 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace maliput_geopackage {
+namespace tools {
+
+/// Parameters of OptimizeGeoPackage().
+struct OptimizeOptions {
+  /// SQLite page size of the output, in bytes. A power of two between 512 and 65536. Large pages suit
+  /// read-mostly maps whose lane rows hold kilobytes of geometry.
+  int page_size{65536};
+  /// Whether to time a full load of the input and of the output. Loading a large map twice can take a while.
+  bool measure_load_time{true};
+  /// When positive, every boundary is re-encoded as a compact geometry quantized to this step, in meters, see
+  /// AppendCompactLineStringZ(). Zero keeps binary boundaries as they are and converts WKT ones to GeoPackage binary.
+  double compact_scale{0.};
+};
+
+/// Outcome of OptimizeGeoPackage().
+struct OptimizeReport {
+  int64_t junctions{0};
+  int64_t segments{0};
+  int64_t lanes{0};
+  int64_t branch_point_lanes{0};
+  int64_t adjacent_lanes{0};
+  /// Number of boundaries re-encoded, see @ref OptimizeOptions::compact_scale. Zero on an optimized input.
+  int64_t geometries_converted{0};
+  /// Largest distance between a boundary point and its compact re-encoding, in meters. At most
+  /// sqrt(3) / 2 times @ref OptimizeOptions::compact_scale, and zero when no boundary was quantized.
+  double max_quantization_error{0.};
+  /// File sizes, in bytes.
+  int64_t input_bytes{0};
+  int64_t output_bytes{0};
+  /// Wall time of a full load, in seconds, or zero when not measured.
+  double input_load_seconds{0.};
+  double output_load_seconds{0.};
+};
+
+/// Writes to `output_path` a copy of the maliput GeoPackage at `input_path` laid out for fast loading:
+///
+/// - WKT lane and shared boundaries are converted to GeoPackage binary geometries, which decode without text parsing,
+///   or every boundary to a compact geometry when @ref OptimizeOptions::compact_scale is positive.
+/// - `lanes` gains the `bbox_min_x`, `bbox_max_x`, `bbox_min_y` and `bbox_max_y` columns holding the extent of
+///   both boundaries, and the `rtree_lanes` spatial index is rebuilt from scratch.
+/// - The lookup indexes on `segments(junction_id)`, `lanes(segment_id)`, `branch_point_lanes(branch_point_id)`,
+///   `branch_point_lanes(lane_id)` and both `adjacent_lanes` lane columns are created if missing.
+/// - `lanes` gains the `lane_index` column: the position of every lane in its segment counting from the
+///   rightmost one, as derived from `adjacent_lanes`. It is NULL in segments whose adjacency is not a plain
+///   right-to-left chain of their lanes. The loader reads lanes in that order and derives the adjacency of the
+///   other segments from it instead of reading `adjacent_lanes`.
+/// - The row count of every table is stored in `maliput_metadata` under `num_<table>`.
+/// - The file is analyzed and vacuumed with @ref OptimizeOptions::page_size pages.
+///
+/// The loaded road network is unchanged, except that a positive @ref OptimizeOptions::compact_scale moves every
+/// re-encoded boundary point by up to @ref OptimizeReport::max_quantization_error, i.e. by up to half the step
+/// along each axis. The operation is idempotent: optimizing an optimized file yields the same content.
+/// `output_path` may equal `input_path` to optimize in place; the output is written under a temporary name and
+/// renamed once complete, so the input is never left half-written.
+///
+/// @throws std::runtime_error if `options` are invalid, the input is not a readable maliput GeoPackage or the
+///         output cannot be written.
+OptimizeReport OptimizeGeoPackage(const std::string& input_path, const std::string& output_path,
+                                  const OptimizeOptions& options = {});
+
+}  // namespace tools
+}  // namespace maliput_geopackage
@@ -0,0 +1,138 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @file optimize_main.cc
+///
+/// Rewrites a maliput GeoPackage into a copy laid out for fast loading: binary geometries, lane extents, a
+/// spatial index, lookup indexes, precomputed lane order and row counts. The loaded road network is unchanged,
+/// except with --compact, which rounds boundary points to the given step and reports how far they moved.
+///
+/// Usage:
+///   maliput_gpkg_optimize [options] <input.gpkg> [<output.gpkg>]
+///
+/// Without an output path the input is optimized in place.
+///
+/// Example:
+///   maliput_gpkg_optimize --page-size 32768 city.gpkg city_optimized.gpkg
+
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "tools/gpkg_optimizer.h"
+
+namespace {
+
+using maliput_geopackage::tools::OptimizeOptions;
+
+void PrintUsage(const char* program) {
+  const OptimizeOptions defaults;
+  std::cout << "Usage: " << program << " [options] <input.gpkg> [<output.gpkg>]\n"
+            << "\n"
+            << "Optimizes <input.gpkg> in place when no output is given.\n"
+            << "\n"
+            << "Options:\n"
+            << "  --page-size <bytes>            SQLite page size of the output (default: " << defaults.page_size
+            << ").\n"
+            << "  --compact <meters>             Re-encode boundaries as compact geometries quantized to this\n"
+            << "                                 step, e.g. 0.001.\n"
+            << "  --no-timing                    Skip timing a load of the input and of the output.\n"
+            << "  -h, --help                     Show this message.\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  OptimizeOptions options;
+  std::string input_path;
+  std::string output_path;
+  try {
+    for (int i = 1; i < argc; ++i) {
+      const std::string arg = argv[i];
+      if (arg == "-h" || arg == "--help") {
+        PrintUsage(argv[0]);
+        return 0;
+      }
+      if (arg == "--no-timing") {
+        options.measure_load_time = false;
+        continue;
+      }
+      if (arg.rfind("--", 0) == 0) {
+        if (i + 1 >= argc) throw std::runtime_error("Missing value for " + arg);
+        const std::string value = argv[++i];
+        if (arg == "--page-size") {
+          options.page_size = std::stoi(value);
+        } else if (arg == "--compact") {
+          options.compact_scale = std::stod(value);
+        } else {
+          throw std::runtime_error("Unknown option " + arg);
+        }
+        continue;
+      }
+      if (input_path.empty()) {
+        input_path = arg;
+      } else if (output_path.empty()) {
+        output_path = arg;
+      } else {
+        throw std::runtime_error("More than two paths given.");
+      }
+    }
+    if (input_path.empty()) {
+      PrintUsage(argv[0]);
+      return 1;
+    }
+    if (output_path.empty()) output_path = input_path;
+
+    const auto report = maliput_geopackage::tools::OptimizeGeoPackage(input_path, output_path, options);
+
+    std::cout << "Wrote " << output_path << ":\n"
+              << "  junctions:            " << report.junctions << "\n"
+              << "  segments:             " << report.segments << "\n"
+              << "  lanes:                " << report.lanes << "\n"
+              << "  branch_point_lanes:   " << report.branch_point_lanes << "\n"
+              << "  adjacent_lanes:       " << report.adjacent_lanes << "\n"
+              << "  geometries converted: " << report.geometries_converted << "\n"
+              << "  size:                 " << report.input_bytes / (1024. * 1024.) << " MiB -> "
+              << report.output_bytes / (1024. * 1024.) << " MiB\n";
+    if (options.compact_scale > 0.) {
+      std::cout << "  quantization error:   up to " << report.max_quantization_error << " m\n";
+    }
+    if (options.measure_load_time) {
+      std::cout << "  load time:            " << report.input_load_seconds << " s -> " << report.output_load_seconds
+                << " s\n";
+    }
+    std::cout << std::flush;
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
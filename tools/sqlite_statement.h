@@ -0,0 +1,80 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, Maliput Contributors
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+struct sqlite3;
+struct sqlite3_stmt;
+
+namespace maliput_geopackage {
+namespace tools {
+
+/// Owns a prepared SQLite statement, finalized on destruction.
+class Statement {
+ public:
+  /// Prepares `sql` on `db`.
+  /// @throws std::runtime_error if `sql` cannot be prepared.
+  Statement(sqlite3* db, const std::string& sql);
+  ~Statement();
+  Statement(const Statement&) = delete;
+  Statement& operator=(const Statement&) = delete;
+
+  /// Binds `value` to the `index`-th parameter without copying it, so `value` must outlive the next Step() or
+  /// Run(). Temporaries are rejected at compile time for that reason.
+  void BindText(int index, const std::string& value);
+  void BindText(int index, std::string&&) = delete;
+  /// Like BindText(), as a blob.
+  void BindBlob(int index, const std::string& value);
+  void BindBlob(int index, std::string&&) = delete;
+  void BindDouble(int index, double value);
+  void BindInt64(int index, int64_t value);
+  void BindNull(int index);
+
+  /// Steps the statement.
+  /// @returns True while it yields rows.
+  /// @throws std::runtime_error if the step fails.
+  bool Step();
+
+  /// Runs the statement to completion and resets it for the next bindings.
+  /// @throws std::runtime_error if a step fails.
+  void Run();
+
+  /// @returns The text of column `index` of the current row, empty when NULL.
+  std::string ColumnText(int index) const;
+
+ private:
+  sqlite3* db_{nullptr};
+  sqlite3_stmt* stmt_{nullptr};
+};
+
+}  // namespace tools
+}  // namespace maliput_geopackage